@@ -23,7 +23,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyAsset(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       Cesium3DTiles::Asset& o);
 
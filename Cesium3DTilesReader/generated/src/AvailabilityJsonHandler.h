@@ -25,7 +25,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyAvailability(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       Cesium3DTiles::Availability& o);
 
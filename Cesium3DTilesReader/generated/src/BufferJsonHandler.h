@@ -24,7 +24,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyBuffer(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       Cesium3DTiles::Buffer& o);
 
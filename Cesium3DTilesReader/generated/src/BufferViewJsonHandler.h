@@ -25,7 +25,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyBufferView(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       Cesium3DTiles::BufferView& o);
 
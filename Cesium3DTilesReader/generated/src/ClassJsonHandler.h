@@ -26,7 +26,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyClass(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       Cesium3DTiles::Class& o);
 
@@ -28,7 +28,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyClassProperty(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       Cesium3DTiles::ClassProperty& o);
 
@@ -28,7 +28,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyContent(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       Cesium3DTiles::Content& o);
 
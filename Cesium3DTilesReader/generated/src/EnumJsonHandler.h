@@ -26,7 +26,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyEnum(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       Cesium3DTiles::Enum& o);
 
@@ -37,7 +37,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyExtension3dTilesBoundingVolumeS2(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       Cesium3DTiles::Extension3dTilesBoundingVolumeS2& o);
 
@@ -66,18 +66,18 @@ void Extension3dTilesBoundingVolumeS2JsonHandler::reset(
 
 CesiumJsonReader::IJsonHandler* Extension3dTilesBoundingVolumeS2JsonHandler::
     readObjectKeyExtension3dTilesBoundingVolumeS2(
-        const std::string& objectType,
+        const std::string_view& objectType,
         const std::string_view& str,
         Cesium3DTiles::Extension3dTilesBoundingVolumeS2& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("token"s == str) {
+  if ("token"sv == str) {
     return property("token", this->_token, o.token);
   }
-  if ("minimumHeight"s == str) {
+  if ("minimumHeight"sv == str) {
     return property("minimumHeight", this->_minimumHeight, o.minimumHeight);
   }
-  if ("maximumHeight"s == str) {
+  if ("maximumHeight"sv == str) {
     return property("maximumHeight", this->_maximumHeight, o.maximumHeight);
   }
 
@@ -174,12 +174,12 @@ StatisticsJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* StatisticsJsonHandler::readObjectKeyStatistics(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     Cesium3DTiles::Statistics& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("classes"s == str) {
+  if ("classes"sv == str) {
     return property("classes", this->_classes, o.classes);
   }
 
@@ -269,15 +269,15 @@ ClassStatisticsJsonHandler::readObjectKey(const std::string_view& str) {
 
 CesiumJsonReader::IJsonHandler*
 ClassStatisticsJsonHandler::readObjectKeyClassStatistics(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     Cesium3DTiles::ClassStatistics& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("count"s == str) {
+  if ("count"sv == str) {
     return property("count", this->_count, o.count);
   }
-  if ("properties"s == str) {
+  if ("properties"sv == str) {
     return property("properties", this->_properties, o.properties);
   }
 
@@ -375,36 +375,36 @@ PropertyStatisticsJsonHandler::readObjectKey(const std::string_view& str) {
 
 CesiumJsonReader::IJsonHandler*
 PropertyStatisticsJsonHandler::readObjectKeyPropertyStatistics(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     Cesium3DTiles::PropertyStatistics& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("min"s == str) {
+  if ("min"sv == str) {
     return property("min", this->_min, o.min);
   }
-  if ("max"s == str) {
+  if ("max"sv == str) {
     return property("max", this->_max, o.max);
   }
-  if ("mean"s == str) {
+  if ("mean"sv == str) {
     return property("mean", this->_mean, o.mean);
   }
-  if ("median"s == str) {
+  if ("median"sv == str) {
     return property("median", this->_median, o.median);
   }
-  if ("standardDeviation"s == str) {
+  if ("standardDeviation"sv == str) {
     return property(
         "standardDeviation",
         this->_standardDeviation,
         o.standardDeviation);
   }
-  if ("variance"s == str) {
+  if ("variance"sv == str) {
     return property("variance", this->_variance, o.variance);
   }
-  if ("sum"s == str) {
+  if ("sum"sv == str) {
     return property("sum", this->_sum, o.sum);
   }
-  if ("occurrences"s == str) {
+  if ("occurrences"sv == str) {
     return property("occurrences", this->_occurrences, o.occurrences);
   }
 
@@ -500,27 +500,27 @@ SchemaJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* SchemaJsonHandler::readObjectKeySchema(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     Cesium3DTiles::Schema& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("id"s == str) {
+  if ("id"sv == str) {
     return property("id", this->_id, o.id);
   }
-  if ("name"s == str) {
+  if ("name"sv == str) {
     return property("name", this->_name, o.name);
   }
-  if ("description"s == str) {
+  if ("description"sv == str) {
     return property("description", this->_description, o.description);
   }
-  if ("version"s == str) {
+  if ("version"sv == str) {
     return property("version", this->_version, o.version);
   }
-  if ("classes"s == str) {
+  if ("classes"sv == str) {
     return property("classes", this->_classes, o.classes);
   }
-  if ("enums"s == str) {
+  if ("enums"sv == str) {
     return property("enums", this->_enums, o.enums);
   }
 
@@ -607,21 +607,21 @@ EnumJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* EnumJsonHandler::readObjectKeyEnum(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     Cesium3DTiles::Enum& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("name"s == str) {
+  if ("name"sv == str) {
     return property("name", this->_name, o.name);
   }
-  if ("description"s == str) {
+  if ("description"sv == str) {
     return property("description", this->_description, o.description);
   }
-  if ("valueType"s == str) {
+  if ("valueType"sv == str) {
     return property("valueType", this->_valueType, o.valueType);
   }
-  if ("values"s == str) {
+  if ("values"sv == str) {
     return property("values", this->_values, o.values);
   }
 
@@ -707,18 +707,18 @@ EnumValueJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* EnumValueJsonHandler::readObjectKeyEnumValue(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     Cesium3DTiles::EnumValue& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("name"s == str) {
+  if ("name"sv == str) {
     return property("name", this->_name, o.name);
   }
-  if ("description"s == str) {
+  if ("description"sv == str) {
     return property("description", this->_description, o.description);
   }
-  if ("value"s == str) {
+  if ("value"sv == str) {
     return property("value", this->_value, o.value);
   }
 
@@ -805,18 +805,18 @@ ClassJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* ClassJsonHandler::readObjectKeyClass(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     Cesium3DTiles::Class& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("name"s == str) {
+  if ("name"sv == str) {
     return property("name", this->_name, o.name);
   }
-  if ("description"s == str) {
+  if ("description"sv == str) {
     return property("description", this->_description, o.description);
   }
-  if ("properties"s == str) {
+  if ("properties"sv == str) {
     return property("properties", this->_properties, o.properties);
   }
 
@@ -916,57 +916,57 @@ ClassPropertyJsonHandler::readObjectKey(const std::string_view& str) {
 
 CesiumJsonReader::IJsonHandler*
 ClassPropertyJsonHandler::readObjectKeyClassProperty(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     Cesium3DTiles::ClassProperty& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("name"s == str) {
+  if ("name"sv == str) {
     return property("name", this->_name, o.name);
   }
-  if ("description"s == str) {
+  if ("description"sv == str) {
     return property("description", this->_description, o.description);
   }
-  if ("type"s == str) {
+  if ("type"sv == str) {
     return property("type", this->_type, o.type);
   }
-  if ("componentType"s == str) {
+  if ("componentType"sv == str) {
     return property("componentType", this->_componentType, o.componentType);
   }
-  if ("enumType"s == str) {
+  if ("enumType"sv == str) {
     return property("enumType", this->_enumType, o.enumType);
   }
-  if ("array"s == str) {
+  if ("array"sv == str) {
     return property("array", this->_array, o.array);
   }
-  if ("count"s == str) {
+  if ("count"sv == str) {
     return property("count", this->_count, o.count);
   }
-  if ("normalized"s == str) {
+  if ("normalized"sv == str) {
     return property("normalized", this->_normalized, o.normalized);
   }
-  if ("offset"s == str) {
+  if ("offset"sv == str) {
     return property("offset", this->_offset, o.offset);
   }
-  if ("scale"s == str) {
+  if ("scale"sv == str) {
     return property("scale", this->_scale, o.scale);
   }
-  if ("max"s == str) {
+  if ("max"sv == str) {
     return property("max", this->_max, o.max);
   }
-  if ("min"s == str) {
+  if ("min"sv == str) {
     return property("min", this->_min, o.min);
   }
-  if ("required"s == str) {
+  if ("required"sv == str) {
     return property("required", this->_required, o.required);
   }
-  if ("noData"s == str) {
+  if ("noData"sv == str) {
     return property("noData", this->_noData, o.noData);
   }
-  if ("default"s == str) {
+  if ("default"sv == str) {
     return property("default", this->_defaultProperty, o.defaultProperty);
   }
-  if ("semantic"s == str) {
+  if ("semantic"sv == str) {
     return property("semantic", this->_semantic, o.semantic);
   }
 
@@ -1063,48 +1063,48 @@ SubtreeJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* SubtreeJsonHandler::readObjectKeySubtree(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     Cesium3DTiles::Subtree& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("buffers"s == str) {
+  if ("buffers"sv == str) {
     return property("buffers", this->_buffers, o.buffers);
   }
-  if ("bufferViews"s == str) {
+  if ("bufferViews"sv == str) {
     return property("bufferViews", this->_bufferViews, o.bufferViews);
   }
-  if ("propertyTables"s == str) {
+  if ("propertyTables"sv == str) {
     return property("propertyTables", this->_propertyTables, o.propertyTables);
   }
-  if ("tileAvailability"s == str) {
+  if ("tileAvailability"sv == str) {
     return property(
         "tileAvailability",
         this->_tileAvailability,
         o.tileAvailability);
   }
-  if ("contentAvailability"s == str) {
+  if ("contentAvailability"sv == str) {
     return property(
         "contentAvailability",
         this->_contentAvailability,
         o.contentAvailability);
   }
-  if ("childSubtreeAvailability"s == str) {
+  if ("childSubtreeAvailability"sv == str) {
     return property(
         "childSubtreeAvailability",
         this->_childSubtreeAvailability,
         o.childSubtreeAvailability);
   }
-  if ("tileMetadata"s == str) {
+  if ("tileMetadata"sv == str) {
     return property("tileMetadata", this->_tileMetadata, o.tileMetadata);
   }
-  if ("contentMetadata"s == str) {
+  if ("contentMetadata"sv == str) {
     return property(
         "contentMetadata",
         this->_contentMetadata,
         o.contentMetadata);
   }
-  if ("subtreeMetadata"s == str) {
+  if ("subtreeMetadata"sv == str) {
     return property(
         "subtreeMetadata",
         this->_subtreeMetadata,
@@ -1193,15 +1193,15 @@ MetadataEntityJsonHandler::readObjectKey(const std::string_view& str) {
 
 CesiumJsonReader::IJsonHandler*
 MetadataEntityJsonHandler::readObjectKeyMetadataEntity(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     Cesium3DTiles::MetadataEntity& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("class"s == str) {
+  if ("class"sv == str) {
     return property("class", this->_classProperty, o.classProperty);
   }
-  if ("properties"s == str) {
+  if ("properties"sv == str) {
     return property("properties", this->_properties, o.properties);
   }
 
@@ -1293,18 +1293,18 @@ AvailabilityJsonHandler::readObjectKey(const std::string_view& str) {
 
 CesiumJsonReader::IJsonHandler*
 AvailabilityJsonHandler::readObjectKeyAvailability(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     Cesium3DTiles::Availability& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("bitstream"s == str) {
+  if ("bitstream"sv == str) {
     return property("bitstream", this->_bitstream, o.bitstream);
   }
-  if ("availableCount"s == str) {
+  if ("availableCount"sv == str) {
     return property("availableCount", this->_availableCount, o.availableCount);
   }
-  if ("constant"s == str) {
+  if ("constant"sv == str) {
     return property("constant", this->_constant, o.constant);
   }
 
@@ -1396,21 +1396,21 @@ PropertyTableJsonHandler::readObjectKey(const std::string_view& str) {
 
 CesiumJsonReader::IJsonHandler*
 PropertyTableJsonHandler::readObjectKeyPropertyTable(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     Cesium3DTiles::PropertyTable& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("name"s == str) {
+  if ("name"sv == str) {
     return property("name", this->_name, o.name);
   }
-  if ("class"s == str) {
+  if ("class"sv == str) {
     return property("class", this->_classProperty, o.classProperty);
   }
-  if ("count"s == str) {
+  if ("count"sv == str) {
     return property("count", this->_count, o.count);
   }
-  if ("properties"s == str) {
+  if ("properties"sv == str) {
     return property("properties", this->_properties, o.properties);
   }
 
@@ -1508,42 +1508,42 @@ PropertyTablePropertyJsonHandler::readObjectKey(const std::string_view& str) {
 
 CesiumJsonReader::IJsonHandler*
 PropertyTablePropertyJsonHandler::readObjectKeyPropertyTableProperty(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     Cesium3DTiles::PropertyTableProperty& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("values"s == str) {
+  if ("values"sv == str) {
     return property("values", this->_values, o.values);
   }
-  if ("arrayOffsets"s == str) {
+  if ("arrayOffsets"sv == str) {
     return property("arrayOffsets", this->_arrayOffsets, o.arrayOffsets);
   }
-  if ("stringOffsets"s == str) {
+  if ("stringOffsets"sv == str) {
     return property("stringOffsets", this->_stringOffsets, o.stringOffsets);
   }
-  if ("arrayOffsetType"s == str) {
+  if ("arrayOffsetType"sv == str) {
     return property(
         "arrayOffsetType",
         this->_arrayOffsetType,
         o.arrayOffsetType);
   }
-  if ("stringOffsetType"s == str) {
+  if ("stringOffsetType"sv == str) {
     return property(
         "stringOffsetType",
         this->_stringOffsetType,
         o.stringOffsetType);
   }
-  if ("offset"s == str) {
+  if ("offset"sv == str) {
     return property("offset", this->_offset, o.offset);
   }
-  if ("scale"s == str) {
+  if ("scale"sv == str) {
     return property("scale", this->_scale, o.scale);
   }
-  if ("max"s == str) {
+  if ("max"sv == str) {
     return property("max", this->_max, o.max);
   }
-  if ("min"s == str) {
+  if ("min"sv == str) {
     return property("min", this->_min, o.min);
   }
 
@@ -1638,21 +1638,21 @@ BufferViewJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* BufferViewJsonHandler::readObjectKeyBufferView(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     Cesium3DTiles::BufferView& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("buffer"s == str) {
+  if ("buffer"sv == str) {
     return property("buffer", this->_buffer, o.buffer);
   }
-  if ("byteOffset"s == str) {
+  if ("byteOffset"sv == str) {
     return property("byteOffset", this->_byteOffset, o.byteOffset);
   }
-  if ("byteLength"s == str) {
+  if ("byteLength"sv == str) {
     return property("byteLength", this->_byteLength, o.byteLength);
   }
-  if ("name"s == str) {
+  if ("name"sv == str) {
     return property("name", this->_name, o.name);
   }
 
@@ -1742,18 +1742,18 @@ BufferJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* BufferJsonHandler::readObjectKeyBuffer(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     Cesium3DTiles::Buffer& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("uri"s == str) {
+  if ("uri"sv == str) {
     return property("uri", this->_uri, o.uri);
   }
-  if ("byteLength"s == str) {
+  if ("byteLength"sv == str) {
     return property("byteLength", this->_byteLength, o.byteLength);
   }
-  if ("name"s == str) {
+  if ("name"sv == str) {
     return property("name", this->_name, o.name);
   }
 
@@ -1847,42 +1847,42 @@ TilesetJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* TilesetJsonHandler::readObjectKeyTileset(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     Cesium3DTiles::Tileset& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("asset"s == str) {
+  if ("asset"sv == str) {
     return property("asset", this->_asset, o.asset);
   }
-  if ("properties"s == str) {
+  if ("properties"sv == str) {
     return property("properties", this->_properties, o.properties);
   }
-  if ("schema"s == str) {
+  if ("schema"sv == str) {
     return property("schema", this->_schema, o.schema);
   }
-  if ("schemaUri"s == str) {
+  if ("schemaUri"sv == str) {
     return property("schemaUri", this->_schemaUri, o.schemaUri);
   }
-  if ("statistics"s == str) {
+  if ("statistics"sv == str) {
     return property("statistics", this->_statistics, o.statistics);
   }
-  if ("groups"s == str) {
+  if ("groups"sv == str) {
     return property("groups", this->_groups, o.groups);
   }
-  if ("metadata"s == str) {
+  if ("metadata"sv == str) {
     return property("metadata", this->_metadata, o.metadata);
   }
-  if ("geometricError"s == str) {
+  if ("geometricError"sv == str) {
     return property("geometricError", this->_geometricError, o.geometricError);
   }
-  if ("root"s == str) {
+  if ("root"sv == str) {
     return property("root", this->_root, o.root);
   }
-  if ("extensionsUsed"s == str) {
+  if ("extensionsUsed"sv == str) {
     return property("extensionsUsed", this->_extensionsUsed, o.extensionsUsed);
   }
-  if ("extensionsRequired"s == str) {
+  if ("extensionsRequired"sv == str) {
     return property(
         "extensionsRequired",
         this->_extensionsRequired,
@@ -1978,42 +1978,42 @@ TileJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* TileJsonHandler::readObjectKeyTile(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     Cesium3DTiles::Tile& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("boundingVolume"s == str) {
+  if ("boundingVolume"sv == str) {
     return property("boundingVolume", this->_boundingVolume, o.boundingVolume);
   }
-  if ("viewerRequestVolume"s == str) {
+  if ("viewerRequestVolume"sv == str) {
     return property(
         "viewerRequestVolume",
         this->_viewerRequestVolume,
         o.viewerRequestVolume);
   }
-  if ("geometricError"s == str) {
+  if ("geometricError"sv == str) {
     return property("geometricError", this->_geometricError, o.geometricError);
   }
-  if ("refine"s == str) {
+  if ("refine"sv == str) {
     return property("refine", this->_refine, o.refine);
   }
-  if ("transform"s == str) {
+  if ("transform"sv == str) {
     return property("transform", this->_transform, o.transform);
   }
-  if ("content"s == str) {
+  if ("content"sv == str) {
     return property("content", this->_content, o.content);
   }
-  if ("contents"s == str) {
+  if ("contents"sv == str) {
     return property("contents", this->_contents, o.contents);
   }
-  if ("metadata"s == str) {
+  if ("metadata"sv == str) {
     return property("metadata", this->_metadata, o.metadata);
   }
-  if ("implicitTiling"s == str) {
+  if ("implicitTiling"sv == str) {
     return property("implicitTiling", this->_implicitTiling, o.implicitTiling);
   }
-  if ("children"s == str) {
+  if ("children"sv == str) {
     return property("children", this->_children, o.children);
   }
 
@@ -2101,27 +2101,27 @@ ImplicitTilingJsonHandler::readObjectKey(const std::string_view& str) {
 
 CesiumJsonReader::IJsonHandler*
 ImplicitTilingJsonHandler::readObjectKeyImplicitTiling(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     Cesium3DTiles::ImplicitTiling& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("subdivisionScheme"s == str) {
+  if ("subdivisionScheme"sv == str) {
     return property(
         "subdivisionScheme",
         this->_subdivisionScheme,
         o.subdivisionScheme);
   }
-  if ("subtreeLevels"s == str) {
+  if ("subtreeLevels"sv == str) {
     return property("subtreeLevels", this->_subtreeLevels, o.subtreeLevels);
   }
-  if ("availableLevels"s == str) {
+  if ("availableLevels"sv == str) {
     return property(
         "availableLevels",
         this->_availableLevels,
         o.availableLevels);
   }
-  if ("subtrees"s == str) {
+  if ("subtrees"sv == str) {
     return property("subtrees", this->_subtrees, o.subtrees);
   }
 
@@ -2209,12 +2209,12 @@ SubtreesJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* SubtreesJsonHandler::readObjectKeySubtrees(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     Cesium3DTiles::Subtrees& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("uri"s == str) {
+  if ("uri"sv == str) {
     return property("uri", this->_uri, o.uri);
   }
 
@@ -2302,21 +2302,21 @@ ContentJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* ContentJsonHandler::readObjectKeyContent(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     Cesium3DTiles::Content& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("boundingVolume"s == str) {
+  if ("boundingVolume"sv == str) {
     return property("boundingVolume", this->_boundingVolume, o.boundingVolume);
   }
-  if ("uri"s == str) {
+  if ("uri"sv == str) {
     return property("uri", this->_uri, o.uri);
   }
-  if ("metadata"s == str) {
+  if ("metadata"sv == str) {
     return property("metadata", this->_metadata, o.metadata);
   }
-  if ("group"s == str) {
+  if ("group"sv == str) {
     return property("group", this->_group, o.group);
   }
 
@@ -2403,18 +2403,18 @@ BoundingVolumeJsonHandler::readObjectKey(const std::string_view& str) {
 
 CesiumJsonReader::IJsonHandler*
 BoundingVolumeJsonHandler::readObjectKeyBoundingVolume(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     Cesium3DTiles::BoundingVolume& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("box"s == str) {
+  if ("box"sv == str) {
     return property("box", this->_box, o.box);
   }
-  if ("region"s == str) {
+  if ("region"sv == str) {
     return property("region", this->_region, o.region);
   }
-  if ("sphere"s == str) {
+  if ("sphere"sv == str) {
     return property("sphere", this->_sphere, o.sphere);
   }
 
@@ -2503,10 +2503,10 @@ GroupMetadataJsonHandler::readObjectKey(const std::string_view& str) {
 
 CesiumJsonReader::IJsonHandler*
 GroupMetadataJsonHandler::readObjectKeyGroupMetadata(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     Cesium3DTiles::GroupMetadata& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
   (void)o;
 
@@ -2596,15 +2596,15 @@ PropertiesJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* PropertiesJsonHandler::readObjectKeyProperties(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     Cesium3DTiles::Properties& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("maximum"s == str) {
+  if ("maximum"sv == str) {
     return property("maximum", this->_maximum, o.maximum);
   }
-  if ("minimum"s == str) {
+  if ("minimum"sv == str) {
     return property("minimum", this->_minimum, o.minimum);
   }
 
@@ -2693,15 +2693,15 @@ AssetJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* AssetJsonHandler::readObjectKeyAsset(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     Cesium3DTiles::Asset& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("version"s == str) {
+  if ("version"sv == str) {
     return property("version", this->_version, o.version);
   }
-  if ("tilesetVersion"s == str) {
+  if ("tilesetVersion"sv == str) {
     return property("tilesetVersion", this->_tilesetVersion, o.tilesetVersion);
   }
 
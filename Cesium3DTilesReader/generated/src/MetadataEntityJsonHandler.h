@@ -27,7 +27,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyMetadataEntity(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       Cesium3DTiles::MetadataEntity& o);
 
@@ -29,7 +29,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyPropertyTable(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       Cesium3DTiles::PropertyTable& o);
 
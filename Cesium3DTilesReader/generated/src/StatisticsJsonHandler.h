@@ -26,7 +26,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyStatistics(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       Cesium3DTiles::Statistics& o);
 
@@ -31,7 +31,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeySubtree(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       Cesium3DTiles::Subtree& o);
 
@@ -30,7 +30,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyTile(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       Cesium3DTiles::Tile& o);
 
@@ -35,7 +35,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyTileset(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       Cesium3DTiles::Tileset& o);
 
@@ -3,15 +3,18 @@
 #include <CesiumJsonReader/JsonReader.h>
 #include <CesiumNativeTests/readFile.h>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <glm/vec3.hpp>
 #include <rapidjson/reader.h>
 
+#include <cstddef>
 #include <filesystem>
 #include <fstream>
 #include <span>
 #include <string>
+#include <vector>
 
 TEST_CASE("Reads tileset JSON") {
   using namespace std::string_literals;
@@ -375,3 +378,49 @@ TEST_CASE("Reads tileset JSON with unknown properties and ignores them when "
       result.value->asset.unknownProperties;
   CHECK(unknownProperties.empty());
 }
+
+namespace {
+void appendTile(std::string& json, int32_t level, int32_t maxLevel) {
+  json += R"({"boundingVolume":{"region":[-1.3197004795898053,)"
+          R"(0.6988582109,-1.3196595204101946,0.6988897891,0,20]},)"
+          R"("geometricError":)";
+  json += std::to_string(maxLevel - level);
+  json += R"(,"refine":"REPLACE","content":{"uri":"tile.b3dm"})";
+
+  if (level < maxLevel) {
+    json += R"(,"children":[)";
+    for (int32_t i = 0; i < 4; ++i) {
+      if (i > 0) {
+        json += ",";
+      }
+      appendTile(json, level + 1, maxLevel);
+    }
+    json += "]";
+  }
+
+  json += "}";
+}
+} // namespace
+
+TEST_CASE("Tileset JSON parse throughput", "[.][benchmark]") {
+  // An explicit quadtree with 5461 tiles, similar to large real-world
+  // tileset.json files.
+  std::string json =
+      R"({"asset":{"version":"1.1"},"geometricError":100,"root":)";
+  appendTile(json, 0, 6);
+  json += "}";
+
+  const std::span<const std::byte> data(
+      reinterpret_cast<const std::byte*>(json.data()),
+      json.size());
+
+  Cesium3DTilesReader::TilesetReader reader;
+  auto result = reader.readFromJson(data);
+  REQUIRE(result.errors.empty());
+  REQUIRE(result.value);
+  CHECK(result.value->root.children.size() == 4);
+
+  BENCHMARK("Read " + std::to_string(json.size()) + " bytes") {
+    return reader.readFromJson(data);
+  };
+}
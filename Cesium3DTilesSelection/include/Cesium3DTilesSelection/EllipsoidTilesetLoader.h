@@ -5,6 +5,8 @@
 #include <Cesium3DTilesSelection/Tileset.h>
 #include <CesiumGeometry/QuadtreeTilingScheme.h>
 
+#include <span>
+
 namespace Cesium3DTilesSelection {
 /**
  * @brief A loader that will generate a tileset by tesselating the surface of an
@@ -46,7 +48,7 @@ public:
 
 private:
   struct Geometry {
-    std::vector<uint16_t> indices;
+    std::span<const uint16_t> indices;
     std::vector<glm::vec3> vertices;
     std::vector<glm::vec3> normals;
   };
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Library.h"
+#include "Tileset.h"
+#include "TilesetContentLoader.h"
+
+#include <CesiumGeometry/CompactQuadtreeAvailability.h>
+#include <CesiumGeometry/QuadtreeTileID.h>
+#include <CesiumGeometry/QuadtreeTilingScheme.h>
+#include <CesiumGeospatial/Ellipsoid.h>
+#include <CesiumGeospatial/GeographicProjection.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Cesium3DTilesSelection {
+
+/**
+ * @brief A loader that streams terrain stored as `heightmap-1.0` tiles,
+ * creating a mesh for each tile as it is loaded.
+ *
+ * The tiles form a geographic quadtree with two root tiles, like those of a
+ * layer.json terrain. Each tile is meshed in a worker thread by
+ * {@link CesiumQuantizedMeshTerrain::HeightmapLoader}, with no more error than
+ * the geometric error of its level allows. The children of a tile are only
+ * known once the tile is loaded, and a tile is only refined when all four of
+ * its children exist.
+ */
+class CESIUM3DTILESSELECTION_API HeightmapTerrainLoader
+    : public TilesetContentLoader {
+public:
+  /**
+   * @brief Constructs a new instance.
+   *
+   * @param url The URL of the tiles. The `{level}` (or `{z}`), `{x}`, and
+   * `{y}` placeholders are replaced with the ID of each tile.
+   * @param maximumLevel The deepest level of tiles that is loaded.
+   * @param ellipsoid The {@link CesiumGeospatial::Ellipsoid}.
+   */
+  HeightmapTerrainLoader(
+      const std::string& url,
+      uint32_t maximumLevel,
+      const CesiumGeospatial::Ellipsoid& ellipsoid CESIUM_DEFAULT_ELLIPSOID);
+
+  /**
+   * @brief Creates a new tileset with this loader.
+   *
+   * @param externals The external interfaces to use.
+   * @param url The URL of the tiles, as given to the constructor.
+   * @param maximumLevel The deepest level of tiles that is loaded.
+   * @param options Additional options for the tileset.
+   */
+  static std::unique_ptr<Tileset> createTileset(
+      const TilesetExternals& externals,
+      const std::string& url,
+      uint32_t maximumLevel,
+      const TilesetOptions& options = TilesetOptions{});
+
+  CesiumAsync::Future<TileLoadResult>
+  loadTileContent(const TileLoadInput& input) override;
+  TileChildrenResult createTileChildren(
+      const Tile& tile,
+      const CesiumGeospatial::Ellipsoid& ellipsoid
+          CESIUM_DEFAULT_ELLIPSOID) override;
+
+private:
+  std::string
+  resolveTileUrl(const CesiumGeometry::QuadtreeTileID& tileID) const;
+  void createChildTile(
+      const Tile& parent,
+      std::vector<Tile>& children,
+      const CesiumGeometry::QuadtreeTileID& childID) const;
+
+  std::string _url;
+  uint32_t _maximumLevel;
+  CesiumGeospatial::GeographicProjection _projection;
+  CesiumGeometry::QuadtreeTilingScheme _tilingScheme;
+
+  // The tiles that the loaded tiles say exist. It only grows, as tiles are
+  // loaded, and is only used in the main thread.
+  CesiumGeometry::CompactQuadtreeAvailability _availability;
+};
+
+} // namespace Cesium3DTilesSelection
@@ -4,8 +4,10 @@
 #include "SampleHeightResult.h"
 
 #include <CesiumAsync/Future.h>
+#include <CesiumAsync/IAssetAccessor.h>
 #include <CesiumGeospatial/Cartographic.h>
 
+#include <utility>
 #include <vector>
 
 namespace CesiumAsync {
@@ -23,6 +25,8 @@ public:
   /**
    * @brief Queries the heights at a list of locations.
    *
+   * The sampler must be kept alive until the returned future resolves.
+   *
    * @param asyncSystem The async system used to do work in threads.
    * @param positions The positions at which to query heights. The height field
    * of each {@link CesiumGeospatial::Cartographic} is ignored.
@@ -31,6 +35,31 @@ public:
   virtual CesiumAsync::Future<SampleHeightResult> sampleHeights(
       const CesiumAsync::AsyncSystem& asyncSystem,
       std::vector<CesiumGeospatial::Cartographic>&& positions) = 0;
+
+  /**
+   * @brief Queries the heights at a list of locations, sending the given
+   * headers with any requests needed to do so.
+   *
+   * A tileset calls this method with its current request headers, which may
+   * change while it is in use, for example when an access token is refreshed.
+   * The default implementation ignores the headers and calls
+   * {@link sampleHeights}.
+   *
+   * The sampler must be kept alive until the returned future resolves.
+   *
+   * @param asyncSystem The async system used to do work in threads.
+   * @param positions The positions at which to query heights. The height field
+   * of each {@link CesiumGeospatial::Cartographic} is ignored.
+   * @param requestHeaders The headers to send with each request.
+   * @return A future that will be resolved when the heights have been queried.
+   */
+  virtual CesiumAsync::Future<SampleHeightResult> sampleHeightsWithHeaders(
+      const CesiumAsync::AsyncSystem& asyncSystem,
+      std::vector<CesiumGeospatial::Cartographic>&& positions,
+      [[maybe_unused]] const std::vector<CesiumAsync::IAssetAccessor::THeader>&
+          requestHeaders) {
+    return this->sampleHeights(asyncSystem, std::move(positions));
+  }
 };
 
 } // namespace Cesium3DTilesSelection
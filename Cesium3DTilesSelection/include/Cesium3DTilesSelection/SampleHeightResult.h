@@ -9,7 +9,8 @@ namespace Cesium3DTilesSelection {
 
 /**
  * @brief The result of sampling heights with
- * {@link Tileset::sampleHeightMostDetailed}.
+ * {@link Tileset::sampleHeightMostDetailed} or
+ * {@link Tileset::sampleHeightCurrentDetail}.
  */
 struct SampleHeightResult {
   /**
@@ -35,6 +36,16 @@ struct SampleHeightResult {
    */
   std::vector<bool> sampleSuccess;
 
+  /**
+   * @brief The geometric error of the tile from which each height was sampled.
+   *
+   * Each entry is the geometric error, in meters, of the tile that supplied
+   * the height for the position at the corresponding index, or -1.0 if the
+   * sample was unsuccessful. This is empty when the heights are not sampled
+   * from tiles, such as when the tileset's loader samples heights directly.
+   */
+  std::vector<double> geometricErrors;
+
   /**
    * @brief Any warnings that occurred while sampling heights.
    */
@@ -5,6 +5,7 @@
 
 #include <CesiumGeospatial/Projection.h>
 #include <CesiumGltf/Model.h>
+#include <CesiumGltfContent/GltfTriangleBvh.h>
 #include <CesiumRasterOverlays/RasterOverlayDetails.h>
 #include <CesiumUtility/CreditSystem.h>
 
@@ -97,6 +98,32 @@ public:
    */
   void setModel(CesiumGltf::Model&& model);
 
+  /**
+   * @brief Get the bounding volume hierarchy over the triangles of the glTF
+   * model, used to quickly intersect rays with it.
+   *
+   * The hierarchy is built in a worker thread when the tile is loaded, if
+   * {@link TilesetContentOptions::enableHeightQueryTriangleBvh} is true. It is
+   * kept until the model is replaced with {@link setModel} or this content is
+   * destroyed. Changes made to the model through {@link getModel} are not
+   * reflected in it.
+   *
+   * @return The bounding volume hierarchy for the glTF model, or nullptr if
+   * none was built.
+   */
+  const CesiumGltfContent::GltfTriangleBvh* getTriangleBvh() const noexcept;
+
+  /**
+   * @brief Set the bounding volume hierarchy over the triangles of the glTF
+   * model.
+   *
+   * @param pTriangleBvh The bounding volume hierarchy, which must have been
+   * built from the current model.
+   */
+  void setTriangleBvh(
+      std::shared_ptr<const CesiumGltfContent::GltfTriangleBvh>&&
+          pTriangleBvh) noexcept;
+
   /**
    * @brief Get the {@link CesiumRasterOverlays::RasterOverlayDetails} which is the result of generating raster overlay UVs for the glTF model
    *
@@ -196,6 +223,7 @@ public:
 
 private:
   CesiumGltf::Model _model;
+  std::shared_ptr<const CesiumGltfContent::GltfTriangleBvh> _pTriangleBvh;
   void* _pRenderResources;
   CesiumRasterOverlays::RasterOverlayDetails _rasterOverlayDetails;
   std::vector<CesiumUtility::Credit> _credits;
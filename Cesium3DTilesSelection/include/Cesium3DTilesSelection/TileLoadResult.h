@@ -136,6 +136,23 @@ struct CESIUM3DTILESSELECTION_API TileLoadResult {
   CesiumGeospatial::Ellipsoid ellipsoid =
       CesiumGeospatial::Ellipsoid::UNIT_SPHERE;
 
+  /**
+   * @brief The number of bytes of memory saved by leaving this tile's mesh
+   * data in its Draco or meshopt compressed form rather than decoding it.
+   *
+   * This is only non-zero when {@link TilesetContentOptions::decodeDraco} or
+   * {@link TilesetContentOptions::decodeMeshOptData} is false. See
+   * {@link CesiumGltfContent::GltfUtilities::computeCompressedMeshByteSavings}.
+   */
+  int64_t compressedMeshByteSavings = 0;
+
+  /**
+   * @brief The bounding volume hierarchy over the triangles of the glTF model,
+   * if {@link TilesetContentOptions::enableHeightQueryTriangleBvh} is true.
+   */
+  std::shared_ptr<const CesiumGltfContent::GltfTriangleBvh> pTriangleBvh =
+      nullptr;
+
   /**
    * @brief Create a result with Failed state
    *
@@ -246,6 +246,9 @@ public:
   /**
    * @brief Gets the total number of bytes of tile and raster overlay data that
    * are currently loaded.
+   *
+   * The data of a raster overlay tile provider that is shared with other
+   * tilesets is divided evenly among them.
    */
   int64_t getTotalDataBytes() const noexcept;
 
@@ -313,6 +316,34 @@ public:
   CesiumAsync::Future<SampleHeightResult> sampleHeightMostDetailed(
       const std::vector<CesiumGeospatial::Cartographic>& positions);
 
+  /**
+   * @brief Immediately queries the height of this tileset at a list of
+   * cartographic positions (longitude and latitude), using only the tiles that
+   * are already loaded.
+   *
+   * Each height is determined by the most detailed loaded tile at that
+   * position, and its geometric error is reported in
+   * {@link SampleHeightResult::geometricErrors}, so callers can decide whether
+   * the result is precise enough or whether to fall back to
+   * {@link sampleHeightMostDetailed}. No tiles are requested or loaded, and a
+   * sample fails where no tile containing its position is loaded.
+   *
+   * This is cheap enough to call every frame, for example to clamp objects to
+   * the ground. It never builds anything on the main thread: tiles loaded
+   * with {@link TilesetContentOptions::enableHeightQueryTriangleBvh} are
+   * intersected with their hierarchy, and other tiles by testing each
+   * triangle.
+   *
+   * The height of the input positions is ignored. The output height is
+   * expressed in meters above the ellipsoid (usually WGS84), which should not
+   * be confused with a height above mean sea level.
+   *
+   * @param positions The positions for which to sample heights.
+   * @return The result of the height query.
+   */
+  SampleHeightResult sampleHeightCurrentDetail(
+      const std::vector<CesiumGeospatial::Cartographic>& positions);
+
 private:
   /**
    * @brief The result of traversing one branch of the tile hierarchy.
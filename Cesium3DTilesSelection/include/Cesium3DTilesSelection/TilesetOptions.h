@@ -29,6 +29,21 @@ struct CESIUM3DTILESSELECTION_API TilesetContentOptions {
    */
   bool enableWaterMask = false;
 
+  /**
+   * @brief Whether to add a `_PARENT_HEIGHT_OFFSET` attribute to terrain
+   * meshes, with the distance from each vertex to an approximation of the
+   * parent tile's surface.
+   *
+   * A renderer can use it to morph each tile from its parent's shape to its
+   * own as it is refined, rather than popping. The parent's surface is
+   * approximated by resampling the tile's own mesh at half its vertex density,
+   * so the offsets capture the detail that a coarser parent would smooth
+   * over, but not the parent's actual simplification. Some popping can remain,
+   * especially where the parent's vertices differ from the tile's.
+   * Currently only applicable for quantized-mesh tilesets.
+   */
+  bool generateParentHeightOffsets = false;
+
   /**
    * @brief Whether to generate smooth normals when normals are missing in the
    * original Gltf.
@@ -54,6 +69,42 @@ struct CESIUM3DTILESSELECTION_API TilesetContentOptions {
    * shader.
    */
   bool applyTextureTransform = true;
+
+  /**
+   * @brief Whether to decode meshes compressed with the
+   * `KHR_draco_mesh_compression` extension while loading. Set this to false
+   * if the renderer decodes Draco data itself, such as on the GPU.
+   *
+   * The positions of primitives that are left compressed cannot be read, so
+   * raster overlays are not draped over them, the loose bounding heights of
+   * their tiles are not refined, and height queries such as
+   * {@link Tileset::sampleHeightMostDetailed} do not intersect them. A warning
+   * is logged when raster overlays are attached to such a tile.
+   */
+  bool decodeDraco = true;
+
+  /**
+   * @brief Whether to decode buffer views compressed with the
+   * `EXT_meshopt_compression` extension while loading. Set this to false if
+   * the renderer decodes meshopt data itself, such as on the GPU.
+   *
+   * Primitives whose positions are left compressed have the same limitations
+   * as those described for {@link TilesetContentOptions::decodeDraco}.
+   */
+  bool decodeMeshOptData = true;
+
+  /**
+   * @brief Whether to build a bounding volume hierarchy over the triangles of
+   * each tile when it is loaded, so that height queries against the tile, such
+   * as {@link Tileset::sampleHeightMostDetailed}, are much faster.
+   *
+   * The hierarchy is built in a worker thread along with the rest of the tile's
+   * content and is freed when the tile is unloaded. It uses roughly 50 bytes
+   * per triangle, which is counted toward
+   * {@link TilesetOptions::maximumCachedBytes}. When false, every triangle of
+   * a tile is tested for every query.
+   */
+  bool enableHeightQueryTriangleBvh = false;
 };
 
 /**
@@ -4,6 +4,9 @@
 
 #include <glm/ext/matrix_transform.hpp>
 
+#include <array>
+#include <span>
+
 using namespace CesiumGltf;
 using namespace CesiumAsync;
 using namespace CesiumUtility;
@@ -11,6 +14,30 @@ using namespace CesiumGeometry;
 using namespace CesiumGeospatial;
 using namespace Cesium3DTilesContent;
 
+namespace {
+constexpr uint16_t resolution = 24;
+
+// The indices only depend on the resolution of the grid, so they are created
+// once and copied into the model of every tile.
+std::span<const uint16_t> getGridIndices() {
+  static const std::vector<uint16_t> indices = []() {
+    std::vector<uint16_t> result;
+    result.reserve(6 * (resolution - 1) * (resolution - 1));
+    for (uint16_t x = 0; x < resolution - 1; x++) {
+      for (uint16_t y = 0; y < resolution - 1; y++) {
+        uint16_t index = static_cast<uint16_t>((resolution * x) + y);
+        uint16_t a = index + 1;
+        uint16_t b = index + resolution;
+        uint16_t c = b + 1;
+        result.insert(result.end(), {b, index, a, b, a, c});
+      }
+    }
+    return result;
+  }();
+  return indices;
+}
+} // namespace
+
 namespace Cesium3DTilesSelection {
 EllipsoidTilesetLoader::EllipsoidTilesetLoader(const Ellipsoid& ellipsoid)
     : _projection(ellipsoid),
@@ -140,11 +167,6 @@ BoundingRegion EllipsoidTilesetLoader::createBoundingRegion(
 
 EllipsoidTilesetLoader::Geometry
 EllipsoidTilesetLoader::createGeometry(const Tile& tile) const {
-  static constexpr uint16_t resolution = 24;
-
-  std::vector<uint16_t> indices;
-  indices.reserve(6 * (resolution - 1) * (resolution - 1));
-
   std::vector<glm::vec3> vertices(resolution * resolution);
   std::vector<glm::vec3> normals(vertices.size());
 
@@ -160,34 +182,45 @@ EllipsoidTilesetLoader::createGeometry(const Tile& tile) const {
   double lonStep = (east - west) / (resolution - 1);
   double latStep = (south - north) / (resolution - 1);
 
+  // The longitude only changes from column to column and the latitude from
+  // row to row, so their sines and cosines are only computed once for each.
+  std::array<double, resolution> cosLongitudes;
+  std::array<double, resolution> sinLongitudes;
+  std::array<double, resolution> cosLatitudes;
+  std::array<double, resolution> sinLatitudes;
+  for (uint16_t i = 0; i < resolution; i++) {
+    double longitude = (lonStep * i) + west;
+    double latitude = (latStep * i) + north;
+    cosLongitudes[i] = glm::cos(longitude);
+    sinLongitudes[i] = glm::sin(longitude);
+    cosLatitudes[i] = glm::cos(latitude);
+    sinLatitudes[i] = glm::sin(latitude);
+  }
+
+  const glm::dvec3 radiiSquared = ellipsoid.getRadii() * ellipsoid.getRadii();
   glm::dmat4 inverseTransform = glm::inverse(tile.getTransform());
 
   for (uint16_t x = 0; x < resolution; x++) {
-    double longitude = (lonStep * x) + west;
     for (uint16_t y = 0; y < resolution; y++) {
-      double latitude = (latStep * y) + north;
-      Cartographic cartographic(longitude, latitude);
+      const glm::dvec3 normal(
+          cosLatitudes[y] * cosLongitudes[x],
+          cosLatitudes[y] * sinLongitudes[x],
+          sinLatitudes[y]);
+      const glm::dvec3 k = radiiSquared * normal;
+      const glm::dvec3 position = k / glm::sqrt(glm::dot(normal, k));
 
       uint16_t index = static_cast<uint16_t>((resolution * x) + y);
-      vertices[index] = glm::dvec3(
-          inverseTransform *
-          glm::dvec4(ellipsoid.cartographicToCartesian(cartographic), 1.0));
-      normals[index] = ellipsoid.geodeticSurfaceNormal(cartographic);
-
-      if (x < resolution - 1 && y < resolution - 1) {
-        uint16_t a = index + 1;
-        uint16_t b = index + resolution;
-        uint16_t c = b + 1;
-        indices.insert(indices.end(), {b, index, a, b, a, c});
-      }
+      vertices[index] =
+          glm::vec3(inverseTransform * glm::dvec4(position, 1.0));
+      normals[index] = glm::vec3(normal);
     }
   }
 
-  return Geometry{std::move(indices), std::move(vertices), std::move(normals)};
+  return Geometry{getGridIndices(), std::move(vertices), std::move(normals)};
 }
 
 Model EllipsoidTilesetLoader::createModel(const Geometry& geometry) const {
-  const std::vector<uint16_t>& indices = geometry.indices;
+  std::span<const uint16_t> indices = geometry.indices;
   const std::vector<glm::vec3>& vertices = geometry.vertices;
   const std::vector<glm::vec3>& normals = geometry.normals;
 
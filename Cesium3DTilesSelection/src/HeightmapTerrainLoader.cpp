@@ -0,0 +1,256 @@
+#include <Cesium3DTilesContent/ImplicitTilingUtilities.h>
+#include <Cesium3DTilesSelection/BoundingVolume.h>
+#include <Cesium3DTilesSelection/HeightmapTerrainLoader.h>
+#include <CesiumAsync/IAssetResponse.h>
+#include <CesiumGeospatial/BoundingRegionWithLooseFittingHeights.h>
+#include <CesiumGeospatial/calcQuadtreeMaxGeometricError.h>
+#include <CesiumQuantizedMeshTerrain/HeightmapLoader.h>
+#include <CesiumUtility/Uri.h>
+
+#include <fmt/format.h>
+
+#include <utility>
+
+using namespace CesiumAsync;
+using namespace CesiumGeometry;
+using namespace CesiumGeospatial;
+using namespace CesiumQuantizedMeshTerrain;
+using namespace CesiumUtility;
+using namespace Cesium3DTilesContent;
+
+namespace Cesium3DTilesSelection {
+HeightmapTerrainLoader::HeightmapTerrainLoader(
+    const std::string& url,
+    uint32_t maximumLevel,
+    const Ellipsoid& ellipsoid)
+    : _url(url),
+      _maximumLevel(maximumLevel),
+      _projection(ellipsoid),
+      _tilingScheme(
+          _projection.project(_projection.MAXIMUM_GLOBE_RECTANGLE),
+          2,
+          1),
+      _availability(_tilingScheme) {}
+
+/*static*/ std::unique_ptr<Tileset> HeightmapTerrainLoader::createTileset(
+    const TilesetExternals& externals,
+    const std::string& url,
+    uint32_t maximumLevel,
+    const TilesetOptions& options) {
+  std::unique_ptr<HeightmapTerrainLoader> pCustomLoader =
+      std::make_unique<HeightmapTerrainLoader>(
+          url,
+          maximumLevel,
+          options.ellipsoid);
+  std::unique_ptr<Tile> pRootTile =
+      std::make_unique<Tile>(pCustomLoader.get(), TileEmptyContent{});
+
+  pRootTile->setRefine(TileRefine::Replace);
+  pRootTile->setUnconditionallyRefine();
+  pRootTile->setBoundingVolume(
+      BoundingRegionWithLooseFittingHeights(BoundingRegion(
+          GeographicProjection::MAXIMUM_GLOBE_RECTANGLE,
+          -1000.0,
+          9000.0,
+          options.ellipsoid)));
+
+  std::vector<Tile> children;
+  uint32_t rootTilesX = pCustomLoader->_tilingScheme.getRootTilesX();
+  children.reserve(rootTilesX);
+
+  for (uint32_t x = 0; x < rootTilesX; x++) {
+    pCustomLoader->createChildTile(
+        *pRootTile,
+        children,
+        QuadtreeTileID{0, x, 0});
+  }
+
+  pRootTile->createChildTiles(std::move(children));
+
+  return std::make_unique<Tileset>(
+      externals,
+      std::move(pCustomLoader),
+      std::move(pRootTile),
+      options);
+}
+
+Future<TileLoadResult>
+HeightmapTerrainLoader::loadTileContent(const TileLoadInput& input) {
+  const Tile& tile = input.tile;
+  const std::shared_ptr<IAssetAccessor>& pAssetAccessor = input.pAssetAccessor;
+
+  const QuadtreeTileID* pTileID =
+      std::get_if<QuadtreeTileID>(&tile.getTileID());
+  const BoundingRegion* pRegion =
+      getBoundingRegionFromBoundingVolume(tile.getBoundingVolume());
+  if (!pTileID || !pRegion) {
+    return input.asyncSystem.createResolvedFuture(
+        TileLoadResult::createFailedResult(pAssetAccessor, nullptr));
+  }
+
+  // Leave out the heights that are closer to the mesh than the geometric error
+  // that is assumed for a quantized-mesh tile at this level.
+  const Ellipsoid& ellipsoid = input.ellipsoid;
+  const double maximumError = calcQuadtreeMaxGeometricError(ellipsoid) *
+                              pRegion->getRectangle().computeWidth();
+
+  return pAssetAccessor
+      ->get(
+          input.asyncSystem,
+          this->resolveTileUrl(*pTileID),
+          input.requestHeaders)
+      .thenInWorkerThread([tileID = *pTileID,
+                           boundingRegion = *pRegion,
+                           maximumError,
+                           ellipsoid](
+                              std::shared_ptr<IAssetRequest>&& pRequest) {
+        const IAssetResponse* pResponse = pRequest->response();
+        if (!pResponse) {
+          QuantizedMeshLoadResult result;
+          result.errors.emplaceError(fmt::format(
+              "Did not receive a valid response for tile content {}",
+              pRequest->url()));
+          result.pRequest = std::move(pRequest);
+          return result;
+        }
+
+        if (pResponse->statusCode() != 0 &&
+            (pResponse->statusCode() < 200 || pResponse->statusCode() >= 300)) {
+          QuantizedMeshLoadResult result;
+          result.errors.emplaceError(fmt::format(
+              "Receive status code {} for tile content {}",
+              pResponse->statusCode(),
+              pRequest->url()));
+          result.pRequest = std::move(pRequest);
+          return result;
+        }
+
+        return HeightmapLoader::load(
+            tileID,
+            boundingRegion,
+            pRequest->url(),
+            pResponse->data(),
+            maximumError,
+            ellipsoid);
+      })
+      .thenInMainThread([this, pAssetAccessor, ellipsoid](
+                            QuantizedMeshLoadResult&& loadResult) {
+        for (const QuadtreeTileRectangularRange& range :
+             loadResult.availableTileRectangles) {
+          this->_availability.addAvailableTileRange(range);
+        }
+
+        if (loadResult.errors || !loadResult.model) {
+          return TileLoadResult::createFailedResult(
+              pAssetAccessor,
+              std::move(loadResult.pRequest));
+        }
+
+        return TileLoadResult{
+            std::move(*loadResult.model),
+            Axis::Y,
+            loadResult.updatedBoundingVolume,
+            std::nullopt,
+            std::nullopt,
+            pAssetAccessor,
+            nullptr,
+            {},
+            TileLoadResultState::Success,
+            ellipsoid};
+      });
+}
+
+TileChildrenResult HeightmapTerrainLoader::createTileChildren(
+    const Tile& tile,
+    const CesiumGeospatial::Ellipsoid& /*ellipsoid*/) {
+  const QuadtreeTileID* pParentID =
+      std::get_if<QuadtreeTileID>(&tile.getTileID());
+  if (!pParentID) {
+    return TileChildrenResult{{}, TileLoadResultState::Failed};
+  }
+
+  // The children that exist are only known once the tile is loaded.
+  if (tile.getState() <= TileLoadState::ContentLoading) {
+    return TileChildrenResult{{}, TileLoadResultState::RetryLater};
+  }
+
+  if (pParentID->level >= this->_maximumLevel) {
+    return TileChildrenResult{{}, TileLoadResultState::Success};
+  }
+
+  // Replacing the tile with only some of its children would leave holes, so
+  // a tile that is missing any child is a leaf.
+  QuadtreeChildren childIDs = ImplicitTilingUtilities::getChildren(*pParentID);
+  for (const QuadtreeTileID& childID : childIDs) {
+    if (this->_availability.isTileAvailable(childID) == 0) {
+      return TileChildrenResult{{}, TileLoadResultState::Success};
+    }
+  }
+
+  std::vector<Tile> children;
+  children.reserve(childIDs.size());
+  for (const QuadtreeTileID& childID : childIDs) {
+    this->createChildTile(tile, children, childID);
+  }
+
+  return TileChildrenResult{std::move(children), TileLoadResultState::Success};
+}
+
+std::string
+HeightmapTerrainLoader::resolveTileUrl(const QuadtreeTileID& tileID) const {
+  return Uri::substituteTemplateParameters(
+      this->_url,
+      [&tileID](const std::string& placeholder) -> std::string {
+        if (placeholder == "level" || placeholder == "z") {
+          return std::to_string(tileID.level);
+        }
+        if (placeholder == "x") {
+          return std::to_string(tileID.x);
+        }
+        if (placeholder == "y") {
+          return std::to_string(tileID.y);
+        }
+
+        return placeholder;
+      });
+}
+
+void HeightmapTerrainLoader::createChildTile(
+    const Tile& parent,
+    std::vector<Tile>& children,
+    const QuadtreeTileID& childID) const {
+  const GlobeRectangle globeRectangle =
+      this->_projection.unproject(this->_tilingScheme.tileToRectangle(childID));
+
+  Tile& child = children.emplace_back(parent.getLoader());
+  child.setTileID(childID);
+  child.setRefine(parent.getRefine());
+  child.setTransform(parent.getTransform());
+
+  // As for a layer.json terrain, the children are assumed to be within the
+  // heights of their parent, and the root tiles within loose earth heights.
+  double minHeight = -1000.0;
+  double maxHeight = 9000.0;
+  double geometricError = 8.0 *
+                          calcQuadtreeMaxGeometricError(
+                              this->_projection.getEllipsoid()) *
+                          globeRectangle.computeWidth();
+  if (std::holds_alternative<QuadtreeTileID>(parent.getTileID())) {
+    const BoundingRegion* pRegion =
+        getBoundingRegionFromBoundingVolume(parent.getBoundingVolume());
+    if (pRegion) {
+      minHeight = pRegion->getMinimumHeight();
+      maxHeight = pRegion->getMaximumHeight();
+    }
+    geometricError = parent.getGeometricError() * 0.5;
+  }
+
+  child.setBoundingVolume(
+      BoundingRegionWithLooseFittingHeights(BoundingRegion(
+          globeRectangle,
+          minHeight,
+          maxHeight,
+          this->_projection.getEllipsoid())));
+  child.setGeometricError(geometricError);
+}
+} // namespace Cesium3DTilesSelection
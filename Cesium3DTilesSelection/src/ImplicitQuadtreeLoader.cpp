@@ -5,6 +5,7 @@
 #include <Cesium3DTilesContent/GltfConverters.h>
 #include <Cesium3DTilesContent/ImplicitTilingUtilities.h>
 #include <Cesium3DTilesSelection/Tile.h>
+#include <Cesium3DTilesSelection/TilesetOptions.h>
 #include <CesiumAsync/IAssetResponse.h>
 #include <CesiumGeometry/QuadtreeTileID.h>
 #include <CesiumUtility/Assert.h>
@@ -128,15 +129,13 @@ CesiumAsync::Future<TileLoadResult> requestTileContent(
     const std::shared_ptr<CesiumAsync::IAssetAccessor>& pAssetAccessor,
     const std::string& tileUrl,
     const std::vector<CesiumAsync::IAssetAccessor::THeader>& requestHeaders,
-    CesiumGltf::Ktx2TranscodeTargets ktx2TranscodeTargets,
-    bool applyTextureTransform,
+    const TilesetContentOptions& contentOptions,
     const glm::dmat4& tileTransform,
     const CesiumGeospatial::Ellipsoid& ellipsoid) {
   return pAssetAccessor->get(asyncSystem, tileUrl, requestHeaders)
       .thenInWorkerThread([ellipsoid,
                            pLogger,
-                           ktx2TranscodeTargets,
-                           applyTextureTransform,
+                           contentOptions,
                            &asyncSystem,
                            pAssetAccessor,
                            tileTransform,
@@ -181,8 +180,12 @@ CesiumAsync::Future<TileLoadResult> requestTileContent(
         if (converter) {
           // Convert to gltf
           CesiumGltfReader::GltfReaderOptions gltfOptions;
-          gltfOptions.ktx2TranscodeTargets = ktx2TranscodeTargets;
-          gltfOptions.applyTextureTransform = applyTextureTransform;
+          gltfOptions.ktx2TranscodeTargets =
+              contentOptions.ktx2TranscodeTargets;
+          gltfOptions.applyTextureTransform =
+              contentOptions.applyTextureTransform;
+          gltfOptions.decodeDraco = contentOptions.decodeDraco;
+          gltfOptions.decodeMeshOptData = contentOptions.decodeMeshOptData;
           AssetFetcher assetFetcher{
               asyncSystem,
               pAssetAccessor,
@@ -348,8 +351,7 @@ ImplicitQuadtreeLoader::loadTileContent(const TileLoadInput& loadInput) {
       pAssetAccessor,
       tileUrl,
       requestHeaders,
-      contentOptions.ktx2TranscodeTargets,
-      contentOptions.applyTextureTransform,
+      contentOptions,
       tile.getTransform(),
       ellipsoid);
 }
@@ -11,6 +11,13 @@
 
 #include <libmorton/morton.h>
 #include <rapidjson/document.h>
+#include <spdlog/logger.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 using namespace CesiumAsync;
 using namespace Cesium3DTilesSelection;
@@ -74,6 +81,8 @@ TileLoadResult convertToTileLoadResult(
 TilesetContentLoaderResult<LayerJsonTerrainLoader>
 convertToTilesetContentLoaderResult(
     const Ellipsoid& ellipsoid,
+    const std::shared_ptr<IAssetAccessor>& pAssetAccessor,
+    const std::shared_ptr<spdlog::logger>& pLogger,
     LoadLayersResult&& loadLayersResult) {
   if (loadLayersResult.errors) {
     TilesetContentLoaderResult<LayerJsonTerrainLoader> result;
@@ -94,7 +103,9 @@ convertToTilesetContentLoaderResult(
   auto pLoader = std::make_unique<LayerJsonTerrainLoader>(
       *loadLayersResult.tilingScheme,
       *loadLayersResult.projection,
-      std::move(loadLayersResult.layers));
+      std::move(loadLayersResult.layers),
+      pAssetAccessor,
+      pLogger);
 
   std::unique_ptr<Tile> pRootTile =
       std::make_unique<Tile>(pLoader.get(), TileEmptyContent());
@@ -158,6 +169,17 @@ void subtreeHash(
   subtreeMortonIdx = libmorton::morton2D_64_encode(subtreeID.x, subtreeID.y);
 }
 
+QuadtreeTileID computeSubtreeID(
+    const QuadtreeTileID& tileID,
+    const LayerJsonTerrainLoader::Layer& layer) {
+  uint32_t subtreeLevelIdx = tileID.level / uint32_t(layer.availabilityLevels);
+  uint64_t levelLeft = tileID.level % uint32_t(layer.availabilityLevels);
+  uint32_t subtreeLevel = subtreeLevelIdx * uint32_t(layer.availabilityLevels);
+  uint32_t subtreeX = tileID.x >> levelLeft;
+  uint32_t subtreeY = tileID.y >> levelLeft;
+  return QuadtreeTileID{subtreeLevel, subtreeX, subtreeY};
+}
+
 bool isSubtreeLoadedInLayer(
     const CesiumGeometry::QuadtreeTileID& subtreeID,
     const LayerJsonTerrainLoader::Layer& layer) {
@@ -181,11 +203,14 @@ bool isSubtreeLoadedInLayer(
 
 void addRectangleAvailabilityToLayer(
     LayerJsonTerrainLoader::Layer& layer,
+    CompactQuadtreeAvailability& layerAvailability,
+    uint32_t layerIndex,
     const QuadtreeTileID& subtreeID,
     const std::vector<CesiumGeometry::QuadtreeTileRectangularRange>&
         rectangleAvailabilities) {
   for (const QuadtreeTileRectangularRange& range : rectangleAvailabilities) {
     layer.contentAvailability.addAvailableTileRange(range);
+    layerAvailability.addAvailableTileRange(range, layerIndex);
   }
 
   uint32_t subtreeLevelIdx;
@@ -309,7 +334,7 @@ Future<LoadLayersResult> loadLayersRecursive(
   const auto availabilityLevelsIt =
       layerJson.FindMember("metadataAvailability");
 
-  QuadtreeRectangleAvailability availability(tilingScheme, uint32_t(maxZoom));
+  CompactQuadtreeAvailability availability(tilingScheme);
 
   int32_t availabilityLevels = -1;
 
@@ -572,9 +597,14 @@ LayerJsonTerrainLoader::createLoader(
                 useWaterMask,
                 ellipsoid);
           })
-      .thenInMainThread([ellipsoid](LoadLayersResult&& loadLayersResult) {
+      .thenInMainThread([ellipsoid,
+                         pAssetAccessor = externals.pAssetAccessor,
+                         pLogger = externals.pLogger](
+                            LoadLayersResult&& loadLayersResult) {
         return convertToTilesetContentLoaderResult(
             ellipsoid,
+            pAssetAccessor,
+            pLogger,
             std::move(loadLayersResult));
       });
 }
@@ -596,9 +626,12 @@ Cesium3DTilesSelection::LayerJsonTerrainLoader::createLoader(
              layerJson,
              contentOptions.enableWaterMask,
              ellipsoid)
-      .thenInMainThread([ellipsoid](LoadLayersResult&& loadLayersResult) {
+      .thenInMainThread([ellipsoid, pAssetAccessor](
+                            LoadLayersResult&& loadLayersResult) {
         return convertToTilesetContentLoaderResult(
             ellipsoid,
+            pAssetAccessor,
+            spdlog::default_logger(),
             std::move(loadLayersResult));
       });
 }
@@ -607,7 +640,7 @@ LayerJsonTerrainLoader::Layer::Layer(
     const std::string& baseUrl_,
     std::string&& version_,
     std::vector<std::string>&& tileTemplateUrls_,
-    CesiumGeometry::QuadtreeRectangleAvailability&& contentAvailability_,
+    CesiumGeometry::CompactQuadtreeAvailability&& contentAvailability_,
     uint32_t maxZooms_,
     int32_t availabilityLevels_)
     : baseUrl{baseUrl_},
@@ -620,10 +653,21 @@ LayerJsonTerrainLoader::Layer::Layer(
 LayerJsonTerrainLoader::LayerJsonTerrainLoader(
     const CesiumGeometry::QuadtreeTilingScheme& tilingScheme,
     const CesiumGeospatial::Projection& projection,
-    std::vector<Layer>&& layers)
+    std::vector<Layer>&& layers,
+    const std::shared_ptr<CesiumAsync::IAssetAccessor>& pAssetAccessor,
+    const std::shared_ptr<spdlog::logger>& pLogger)
     : _tilingScheme(tilingScheme),
       _projection(projection),
-      _layers(std::move(layers)) {}
+      _layers(std::move(layers)),
+      _layerAvailability(tilingScheme, uint32_t(this->_layers.size())),
+      _pAssetAccessor(pAssetAccessor),
+      _pLogger(pLogger ? pLogger : spdlog::default_logger()) {
+  for (size_t i = 0; i < this->_layers.size(); ++i) {
+    this->_layerAvailability.addAvailability(
+        this->_layers[i].contentAvailability,
+        uint32_t(i));
+  }
+}
 
 namespace {
 
@@ -665,6 +709,7 @@ Future<QuantizedMeshLoadResult> requestTileContent(
     const LayerJsonTerrainLoader::Layer& layer,
     const std::vector<IAssetAccessor::THeader>& requestHeaders,
     bool enableWaterMask,
+    bool generateParentHeightOffsets,
     const CesiumGeospatial::Ellipsoid& ellipsoid) {
   std::string url = resolveTileUrl(tileID, layer);
   return pAssetAccessor->get(asyncSystem, url, requestHeaders)
@@ -673,7 +718,8 @@ Future<QuantizedMeshLoadResult> requestTileContent(
                            pLogger,
                            tileID,
                            boundingRegion,
-                           enableWaterMask](
+                           enableWaterMask,
+                           generateParentHeightOffsets](
                               std::shared_ptr<IAssetRequest>&& pRequest) {
         const IAssetResponse* pResponse = pRequest->response();
         if (!pResponse) {
@@ -702,7 +748,8 @@ Future<QuantizedMeshLoadResult> requestTileContent(
             pRequest->url(),
             pResponse->data(),
             enableWaterMask,
-            ellipsoid);
+            ellipsoid,
+            generateParentHeightOffsets);
       });
 }
 
@@ -712,6 +759,8 @@ Future<int> loadTileAvailability(
     const std::shared_ptr<IAssetAccessor>& pAssetAccessor,
     const QuadtreeTileID& tileID,
     LayerJsonTerrainLoader::Layer& layer,
+    CompactQuadtreeAvailability& layerAvailability,
+    uint32_t layerIndex,
     const std::vector<IAssetAccessor::THeader>& requestHeaders) {
   std::string url = resolveTileUrl(tileID, layer);
   return pAssetAccessor->get(asyncSystem, url, requestHeaders)
@@ -732,12 +781,67 @@ Future<int> loadTileAvailability(
             pRequest->url());
         return QuantizedMeshMetadataResult();
       })
-      .thenInMainThread([&layer,
-                         tileID](QuantizedMeshMetadataResult&& metadata) {
-        addRectangleAvailabilityToLayer(layer, tileID, metadata.availability);
+      .thenInMainThread([&layer, &layerAvailability, layerIndex, tileID](
+                            QuantizedMeshMetadataResult&& metadata) {
+        addRectangleAvailabilityToLayer(
+            layer,
+            layerAvailability,
+            layerIndex,
+            tileID,
+            metadata.availability);
         return 0;
       });
 }
+
+struct TileHeightSamples {
+  std::vector<size_t> positionIndices;
+  QuantizedMeshSampleHeightsResult samples;
+};
+
+Future<TileHeightSamples> requestTileHeights(
+    const AsyncSystem& asyncSystem,
+    const std::shared_ptr<IAssetAccessor>& pAssetAccessor,
+    const QuadtreeTileID& tileID,
+    const GlobeRectangle& tileRectangle,
+    const LayerJsonTerrainLoader::Layer& layer,
+    const std::vector<IAssetAccessor::THeader>& requestHeaders,
+    std::vector<size_t>&& positionIndices,
+    std::vector<Cartographic>&& positions) {
+  std::string url = resolveTileUrl(tileID, layer);
+  return pAssetAccessor->get(asyncSystem, url, requestHeaders)
+      .thenInWorkerThread(
+          [tileRectangle,
+           positionIndices = std::move(positionIndices),
+           positions = std::move(positions)](
+              std::shared_ptr<IAssetRequest>&& pRequest) mutable {
+            TileHeightSamples result;
+            result.positionIndices = std::move(positionIndices);
+
+            const IAssetResponse* pResponse = pRequest->response();
+            if (!pResponse) {
+              result.samples.errors.emplaceError(fmt::format(
+                  "Did not receive a valid response for tile content {}",
+                  pRequest->url()));
+              return result;
+            }
+
+            if (pResponse->statusCode() != 0 &&
+                (pResponse->statusCode() < 200 ||
+                 pResponse->statusCode() >= 300)) {
+              result.samples.errors.emplaceError(fmt::format(
+                  "Receive status code {} for tile content {}",
+                  pResponse->statusCode(),
+                  pRequest->url()));
+              return result;
+            }
+
+            result.samples = QuantizedMeshLoader::sampleHeights(
+                tileRectangle,
+                pResponse->data(),
+                positions);
+            return result;
+          });
+}
 } // namespace
 
 Future<TileLoadResult>
@@ -771,19 +875,16 @@ LayerJsonTerrainLoader::loadTileContent(const TileLoadInput& loadInput) {
 
   // Always request the tile from the first layer in which this tile ID is
   // available.
-  auto firstAvailableIt = this->_layers.begin();
-  while (firstAvailableIt != this->_layers.end() &&
-         !firstAvailableIt->contentAvailability.isTileAvailable(
-             *pQuadtreeTileID)) {
-    ++firstAvailableIt;
-  }
-
-  if (firstAvailableIt == this->_layers.end()) {
+  const std::optional<uint32_t> maybeLayerIndex =
+      this->_layerAvailability.findFirstAvailableLayer(*pQuadtreeTileID);
+  if (!maybeLayerIndex) {
     // No layer has this tile available.
     return asyncSystem.createResolvedFuture(
         TileLoadResult::createFailedResult(pAssetAccessor, nullptr));
   }
 
+  auto firstAvailableIt = this->_layers.begin() + *maybeLayerIndex;
+
   // Also load the same tile in any underlying layers for which this tile
   // is an availability level. This is necessary because, when we later
   // create this tile's children, we need to be able to create children
@@ -804,6 +905,8 @@ LayerJsonTerrainLoader::loadTileContent(const TileLoadInput& loadInput) {
             pAssetAccessor,
             *pQuadtreeTileID,
             *it,
+            this->_layerAvailability,
+            uint32_t(it - this->_layers.begin()),
             requestHeaders));
       }
     }
@@ -830,6 +933,7 @@ LayerJsonTerrainLoader::loadTileContent(const TileLoadInput& loadInput) {
       currentLayer,
       requestHeaders,
       contentOptions.enableWaterMask,
+      contentOptions.generateParentHeightOffsets,
       ellipsoid);
 
   // determine if this tile is at the availability level of the current layer
@@ -861,6 +965,7 @@ LayerJsonTerrainLoader::loadTileContent(const TileLoadInput& loadInput) {
                            pAssetAccessor,
                            ellipsoid,
                            &currentLayer,
+                           currentLayerIndex = *maybeLayerIndex,
                            &tile,
                            shouldCurrLayerLoadAvailability](
                               QuantizedMeshLoadResult&& loadResult) mutable {
@@ -869,6 +974,8 @@ LayerJsonTerrainLoader::loadTileContent(const TileLoadInput& loadInput) {
                 std::get<QuadtreeTileID>(tile.getTileID());
             addRectangleAvailabilityToLayer(
                 currentLayer,
+                this->_layerAvailability,
+                currentLayerIndex,
                 tileID,
                 loadResult.availableTileRectangles);
           }
@@ -963,6 +1070,31 @@ TileChildrenResult LayerJsonTerrainLoader::createTileChildren(
   return {{}, TileLoadResultState::Failed};
 }
 
+ITilesetHeightSampler* LayerJsonTerrainLoader::getHeightSampler() {
+  // Tiles can only be requested for height queries if the loader was created
+  // with an asset accessor.
+  return this->_pAssetAccessor ? this : nullptr;
+}
+
+Future<SampleHeightResult> LayerJsonTerrainLoader::sampleHeights(
+    const AsyncSystem& asyncSystem,
+    std::vector<Cartographic>&& positions) {
+  return this->sampleHeightsWithHeaders(asyncSystem, std::move(positions), {});
+}
+
+Future<SampleHeightResult> LayerJsonTerrainLoader::sampleHeightsWithHeaders(
+    const AsyncSystem& asyncSystem,
+    std::vector<Cartographic>&& positions,
+    const std::vector<IAssetAccessor::THeader>& requestHeaders) {
+  SampleHeightResult result;
+  result.positions = std::move(positions);
+  result.sampleSuccess.resize(result.positions.size(), false);
+  return this->sampleHeightsFromAvailableTiles(
+      asyncSystem,
+      std::vector<IAssetAccessor::THeader>(requestHeaders),
+      std::move(result));
+}
+
 const CesiumGeometry::QuadtreeTilingScheme&
 LayerJsonTerrainLoader::getTilingScheme() const noexcept {
   return this->_tilingScheme;
@@ -1046,14 +1178,7 @@ LayerJsonTerrainLoader::createTileChildrenImpl(const Tile& tile) {
 
 bool LayerJsonTerrainLoader::tileIsAvailableInAnyLayer(
     const QuadtreeTileID& tileID) const {
-  for (const Layer& layer : this->_layers) {
-    auto availableState = tileIsAvailableInLayer(tileID, layer);
-    if (availableState == AvailableState::Available) {
-      return true;
-    }
-  }
-
-  return false;
+  return this->_layerAvailability.isTileAvailable(tileID);
 }
 
 LayerJsonTerrainLoader::AvailableState
@@ -1079,15 +1204,7 @@ LayerJsonTerrainLoader::tileIsAvailableInLayer(
     }
 
     // calc the subtree ID this tile belongs to and determine it's loaded
-    uint32_t subtreeLevelIdx =
-        tileID.level / uint32_t(layer.availabilityLevels);
-    uint64_t levelLeft = tileID.level % uint32_t(layer.availabilityLevels);
-    uint32_t subtreeLevel =
-        subtreeLevelIdx * uint32_t(layer.availabilityLevels);
-    uint32_t subtreeX = tileID.x >> levelLeft;
-    uint32_t subtreeY = tileID.y >> levelLeft;
-    CesiumGeometry::QuadtreeTileID subtreeID{subtreeLevel, subtreeX, subtreeY};
-    if (isSubtreeLoadedInLayer(subtreeID, layer)) {
+    if (isSubtreeLoadedInLayer(computeSubtreeID(tileID, layer), layer)) {
       return AvailableState::NotAvailable;
     }
   }
@@ -1194,6 +1311,10 @@ CesiumAsync::Future<TileLoadResult> LayerJsonTerrainLoader::upsampleParentTile(
           return TileLoadResult::createFailedResult(nullptr, nullptr);
         }
 
+        // The interpolated parent height offsets point at the grandparent's
+        // surface, but this tile has exactly its parent's surface.
+        QuantizedMeshLoader::clearParentHeightOffsets(*model);
+
         return TileLoadResult{
             std::move(*model),
             CesiumGeometry::Axis::Y,
@@ -1207,3 +1328,182 @@ CesiumAsync::Future<TileLoadResult> LayerJsonTerrainLoader::upsampleParentTile(
             ellipsoid};
       });
 }
+
+std::optional<QuadtreeTileID> LayerJsonTerrainLoader::findMostDetailedTileAt(
+    const Cartographic& position,
+    std::vector<std::pair<Layer*, QuadtreeTileID>>& subtreesToLoad) {
+  const glm::dvec2 projectedPosition =
+      glm::dvec2(projectPosition(this->_projection, position));
+
+  std::optional<QuadtreeTileID> result;
+  for (uint32_t level = 0;; ++level) {
+    std::optional<QuadtreeTileID> maybeTileID =
+        this->_tilingScheme.positionToTile(projectedPosition, level);
+    if (!maybeTileID) {
+      break;
+    }
+
+    bool isAvailable = false;
+    for (Layer& layer : this->_layers) {
+      AvailableState state = this->tileIsAvailableInLayer(*maybeTileID, layer);
+      if (state == AvailableState::Available) {
+        isAvailable = true;
+        break;
+      }
+
+      // The availability of this tile is in the metadata of the tile at the
+      // root of its subtree, which is only worth loading if that tile exists.
+      if (state == AvailableState::Unknown) {
+        QuadtreeTileID subtreeID = computeSubtreeID(*maybeTileID, layer);
+        if (layer.contentAvailability.isTileAvailable(subtreeID)) {
+          std::pair<Layer*, QuadtreeTileID> subtree(&layer, subtreeID);
+          if (std::find(
+                  subtreesToLoad.begin(),
+                  subtreesToLoad.end(),
+                  subtree) == subtreesToLoad.end()) {
+            subtreesToLoad.emplace_back(subtree);
+          }
+        }
+      }
+    }
+
+    if (!isAvailable) {
+      break;
+    }
+
+    result = *maybeTileID;
+  }
+
+  return result;
+}
+
+Future<SampleHeightResult>
+LayerJsonTerrainLoader::sampleHeightsFromAvailableTiles(
+    const AsyncSystem& asyncSystem,
+    std::vector<IAssetAccessor::THeader>&& requestHeaders,
+    SampleHeightResult&& result) {
+  std::vector<std::pair<Layer*, QuadtreeTileID>> subtreesToLoad;
+  std::vector<std::optional<QuadtreeTileID>> tileIDs;
+  tileIDs.reserve(result.positions.size());
+  for (const Cartographic& position : result.positions) {
+    tileIDs.emplace_back(
+        this->findMostDetailedTileAt(position, subtreesToLoad));
+  }
+
+  // If more detailed tiles may be available, load the availability of their
+  // subtrees and then look again.
+  if (!subtreesToLoad.empty()) {
+    std::vector<Future<int>> availabilityRequests;
+    availabilityRequests.reserve(subtreesToLoad.size());
+    for (const auto& [pLayer, subtreeID] : subtreesToLoad) {
+      availabilityRequests.emplace_back(loadTileAvailability(
+          this->_pLogger,
+          asyncSystem,
+          this->_pAssetAccessor,
+          subtreeID,
+          *pLayer,
+          this->_layerAvailability,
+          uint32_t(pLayer - this->_layers.data()),
+          requestHeaders));
+    }
+
+    // The availability requests and this continuation refer to this loader
+    // and its layers, which the caller keeps alive until the heights are
+    // sampled.
+    return asyncSystem.all(std::move(availabilityRequests))
+        .thenInMainThread([this,
+                           asyncSystem,
+                           requestHeaders = std::move(requestHeaders),
+                           result = std::move(result)](
+                              std::vector<int>&&) mutable {
+          return this->sampleHeightsFromAvailableTiles(
+              asyncSystem,
+              std::move(requestHeaders),
+              std::move(result));
+        });
+  }
+
+  // Group the positions by the most detailed tile that contains them, so that
+  // each tile is requested once.
+  std::unordered_map<QuadtreeTileID, size_t> tileIndices;
+  std::vector<std::pair<QuadtreeTileID, std::vector<size_t>>> tiles;
+  for (size_t i = 0; i < tileIDs.size(); ++i) {
+    if (!tileIDs[i]) {
+      continue;
+    }
+
+    auto [it, added] = tileIndices.emplace(*tileIDs[i], tiles.size());
+    if (added) {
+      tiles.emplace_back(*tileIDs[i], std::vector<size_t>());
+    }
+    tiles[it->second].second.emplace_back(i);
+  }
+
+  std::vector<Future<TileHeightSamples>> tileRequests;
+  tileRequests.reserve(tiles.size());
+  for (auto& [tileID, positionIndices] : tiles) {
+    // Request the tile from the first layer in which it is available.
+    const std::optional<uint32_t> maybeLayerIndex =
+        this->_layerAvailability.findFirstAvailableLayer(tileID);
+    if (!maybeLayerIndex) {
+      continue;
+    }
+
+    std::vector<Cartographic> tilePositions;
+    tilePositions.reserve(positionIndices.size());
+    for (size_t i : positionIndices) {
+      tilePositions.emplace_back(result.positions[i]);
+    }
+
+    tileRequests.emplace_back(requestTileHeights(
+        asyncSystem,
+        this->_pAssetAccessor,
+        tileID,
+        unprojectRectangleSimple(
+            this->_projection,
+            this->_tilingScheme.tileToRectangle(tileID)),
+        this->_layers[*maybeLayerIndex],
+        requestHeaders,
+        std::move(positionIndices),
+        std::move(tilePositions)));
+  }
+
+  return asyncSystem.all(std::move(tileRequests))
+      .thenImmediately(
+          [result = std::move(result)](
+              std::vector<TileHeightSamples>&& tileSamples) mutable {
+            for (TileHeightSamples& tile : tileSamples) {
+              const QuantizedMeshSampleHeightsResult& samples = tile.samples;
+              for (size_t i = 0; i < samples.sampleSuccess.size(); ++i) {
+                if (samples.sampleSuccess[i]) {
+                  const size_t index = tile.positionIndices[i];
+                  result.positions[index].height = samples.heights[i];
+                  result.sampleSuccess[index] = true;
+                }
+              }
+
+              result.warnings.insert(
+                  result.warnings.end(),
+                  samples.errors.errors.begin(),
+                  samples.errors.errors.end());
+              result.warnings.insert(
+                  result.warnings.end(),
+                  samples.errors.warnings.begin(),
+                  samples.errors.warnings.end());
+            }
+
+            const size_t failedCount = size_t(std::count(
+                result.sampleSuccess.begin(),
+                result.sampleSuccess.end(),
+                false));
+            if (failedCount > 0) {
+              result.warnings.emplace_back(fmt::format(
+                  "Heights could not be sampled from the terrain at {} of {} "
+                  "positions.",
+                  failedCount,
+                  result.positions.size()));
+            }
+
+            return result;
+          });
+}
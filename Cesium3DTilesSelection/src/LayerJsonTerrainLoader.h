@@ -2,21 +2,24 @@
 
 #include "TilesetContentLoaderResult.h"
 
+#include <Cesium3DTilesSelection/ITilesetHeightSampler.h>
 #include <Cesium3DTilesSelection/TilesetContentLoader.h>
 #include <Cesium3DTilesSelection/TilesetExternals.h>
 #include <CesiumAsync/Future.h>
 #include <CesiumAsync/IAssetAccessor.h>
-#include <CesiumGeometry/QuadtreeRectangleAvailability.h>
+#include <CesiumGeometry/CompactQuadtreeAvailability.h>
 #include <CesiumGeometry/QuadtreeTilingScheme.h>
 #include <CesiumGeospatial/Projection.h>
 #include <CesiumUtility/Assert.h>
 
 #include <rapidjson/fwd.h>
+#include <spdlog/fwd.h>
 
 #include <memory>
 #include <optional>
 #include <string>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace Cesium3DTilesSelection {
@@ -24,8 +27,12 @@ namespace Cesium3DTilesSelection {
 /**
  * @brief A loader for terrain described by a layer.json file, and with tiles in
  * quantized-mesh format.
+ *
+ * Heights are sampled directly from the quantized-mesh tiles, without creating
+ * glTF models for them, when the loader knows how to request tiles.
  */
-class LayerJsonTerrainLoader : public TilesetContentLoader {
+class LayerJsonTerrainLoader : public TilesetContentLoader,
+                               public ITilesetHeightSampler {
   enum class AvailableState { Available, NotAvailable, Unknown };
 
 public:
@@ -52,22 +59,35 @@ public:
         const std::string& baseUrl,
         std::string&& version,
         std::vector<std::string>&& tileTemplateUrls,
-        CesiumGeometry::QuadtreeRectangleAvailability&& contentAvailability,
+        CesiumGeometry::CompactQuadtreeAvailability&& contentAvailability,
         uint32_t maxZooms,
         int32_t availabilityLevels);
 
     std::string baseUrl;
     std::string version;
     std::vector<std::string> tileTemplateUrls;
-    CesiumGeometry::QuadtreeRectangleAvailability contentAvailability;
+    CesiumGeometry::CompactQuadtreeAvailability contentAvailability;
     std::vector<std::unordered_set<uint64_t>> loadedSubtrees;
     int32_t availabilityLevels;
   };
 
+  /**
+   * @brief Creates a new instance.
+   *
+   * @param tilingScheme The tiling scheme of the terrain.
+   * @param projection The projection of the terrain.
+   * @param layers The layers of the terrain, in order of priority.
+   * @param pAssetAccessor The asset accessor used to request tiles when
+   * sampling heights. If nullptr, this loader does not sample heights itself.
+   * @param pLogger The logger used to report problems when sampling heights.
+   */
   LayerJsonTerrainLoader(
       const CesiumGeometry::QuadtreeTilingScheme& tilingScheme,
       const CesiumGeospatial::Projection& projection,
-      std::vector<Layer>&& layers);
+      std::vector<Layer>&& layers,
+      const std::shared_ptr<CesiumAsync::IAssetAccessor>& pAssetAccessor =
+          nullptr,
+      const std::shared_ptr<spdlog::logger>& pLogger = nullptr);
 
   CesiumAsync::Future<TileLoadResult>
   loadTileContent(const TileLoadInput& loadInput) override;
@@ -77,6 +97,18 @@ public:
       const CesiumGeospatial::Ellipsoid& ellipsoid
           CESIUM_DEFAULT_ELLIPSOID) override;
 
+  ITilesetHeightSampler* getHeightSampler() override;
+
+  CesiumAsync::Future<SampleHeightResult> sampleHeights(
+      const CesiumAsync::AsyncSystem& asyncSystem,
+      std::vector<CesiumGeospatial::Cartographic>&& positions) override;
+
+  CesiumAsync::Future<SampleHeightResult> sampleHeightsWithHeaders(
+      const CesiumAsync::AsyncSystem& asyncSystem,
+      std::vector<CesiumGeospatial::Cartographic>&& positions,
+      const std::vector<CesiumAsync::IAssetAccessor::THeader>& requestHeaders)
+      override;
+
   const CesiumGeometry::QuadtreeTilingScheme& getTilingScheme() const noexcept;
 
   const CesiumGeospatial::Projection& getProjection() const noexcept;
@@ -105,9 +137,27 @@ private:
       const Tile& tile,
       const CesiumAsync::AsyncSystem& asyncSystem);
 
+  std::optional<CesiumGeometry::QuadtreeTileID> findMostDetailedTileAt(
+      const CesiumGeospatial::Cartographic& position,
+      std::vector<std::pair<Layer*, CesiumGeometry::QuadtreeTileID>>&
+          subtreesToLoad);
+
+  CesiumAsync::Future<SampleHeightResult> sampleHeightsFromAvailableTiles(
+      const CesiumAsync::AsyncSystem& asyncSystem,
+      std::vector<CesiumAsync::IAssetAccessor::THeader>&& requestHeaders,
+      SampleHeightResult&& result);
+
   CesiumGeometry::QuadtreeTilingScheme _tilingScheme;
   CesiumGeospatial::Projection _projection;
   std::vector<Layer> _layers;
+
+  // The content availability of all of the layers, merged so that the first
+  // layer in which a tile is available is found with a single lookup. It is
+  // updated along with the layers as their availability subtrees are loaded.
+  CesiumGeometry::CompactQuadtreeAvailability _layerAvailability;
+
+  std::shared_ptr<CesiumAsync::IAssetAccessor> _pAssetAccessor;
+  std::shared_ptr<spdlog::logger> _pLogger;
 };
 
 } // namespace Cesium3DTilesSelection
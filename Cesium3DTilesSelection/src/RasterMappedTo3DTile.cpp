@@ -46,6 +46,31 @@ RasterOverlayTile* findTileOverlay(Tile& tile, const RasterOverlay& overlay) {
   return nullptr;
 }
 
+// Find the most detailed loaded overlay tile for the given overlay in the given
+// tile. Unlike findTileOverlay, this returns the tile's ready overlay tile if
+// its loading tile has not finished loading yet.
+RasterOverlayTile*
+findLoadedTileOverlay(Tile& tile, const RasterOverlay& overlay) {
+  std::vector<RasterMappedTo3DTile>& tiles = tile.getMappedRasterTiles();
+  for (RasterMappedTo3DTile& mapped : tiles) {
+    RasterOverlayTile* pReady = mapped.getReadyTile();
+    RasterOverlayTile* pLoading = mapped.getLoadingTile();
+    RasterOverlayTile* pAny = pReady ? pReady : pLoading;
+    if (pAny == nullptr || &pAny->getTileProvider().getOwner() != &overlay)
+      continue;
+
+    if (pLoading &&
+        pLoading->getState() >= RasterOverlayTile::LoadState::Loaded) {
+      return pLoading;
+    } else if (
+        pReady && pReady->getState() >= RasterOverlayTile::LoadState::Loaded) {
+      return pReady;
+    }
+  }
+
+  return nullptr;
+}
+
 } // namespace
 
 namespace Cesium3DTilesSelection {
@@ -121,17 +146,18 @@ RasterOverlayTile::MoreDetailAvailable RasterMappedTo3DTile::update(
     this->computeTranslationAndScale(tile);
   }
 
-  // Find the closest ready ancestor tile.
+  // Find the closest ready ancestor tile. An ancestor that is itself waiting
+  // for more detailed imagery still has its previous imagery, which is better
+  // than that of any of its own ancestors.
   if (this->_pLoadingTile) {
     CesiumUtility::IntrusivePointer<RasterOverlayTile> pCandidate;
 
     pTile = tile.getParent();
     while (pTile) {
-      pCandidate = findTileOverlay(
+      pCandidate = findLoadedTileOverlay(
           *pTile,
           this->_pLoadingTile->getTileProvider().getOwner());
-      if (pCandidate &&
-          pCandidate->getState() >= RasterOverlayTile::LoadState::Loaded) {
+      if (pCandidate) {
         break;
       }
       pTile = pTile->getParent();
@@ -74,14 +74,16 @@ void RasterOverlayCollection::add(
 
   // CESIUM_TRACE_BEGIN_IN_TRACK("createTileProvider");
 
-  CesiumAsync::Future<RasterOverlay::CreateTileProviderResult> future =
-      pOverlay->createTileProvider(
+  // Tilesets with the same async system, asset accessor, and credit system
+  // share a single tile provider for this overlay, so that its tiles are only
+  // fetched, decoded, and cached once.
+  CesiumAsync::SharedFuture<RasterOverlay::CreateTileProviderResult> future =
+      pOverlay->getSharedTileProvider(
           this->_externals.asyncSystem,
           this->_externals.pAssetAccessor,
           this->_externals.pCreditSystem,
           this->_externals.pPrepareRendererResources,
-          this->_externals.pLogger,
-          nullptr);
+          this->_externals.pLogger);
 
   // Add a placeholder for this overlay to existing geometry tiles.
   forEachTile(*this->_pLoadedTiles, [&](Tile& tile) {
@@ -104,7 +106,7 @@ void RasterOverlayCollection::add(
 
   // This continuation, by capturing pList, keeps the OverlayList from being
   // destroyed. But it does not keep the RasterOverlayCollection itself alive.
-  std::move(future)
+  future
       .catchInMainThread(
           [](const std::exception& e)
               -> RasterOverlay::CreateTileProviderResult {
@@ -198,6 +200,11 @@ void RasterOverlayCollection::remove(
     return;
   }
 
+  (*it)->releaseSharedTileProvider(
+      this->_externals.asyncSystem,
+      this->_externals.pAssetAccessor,
+      this->_externals.pCreditSystem);
+
   int64_t index = it - list.overlays.begin();
   list.overlays.erase(list.overlays.begin() + index);
   list.tileProviders.erase(list.tileProviders.begin() + index);
@@ -4,16 +4,37 @@
 #include <Cesium3DTilesSelection/Tile.h>
 #include <CesiumGeometry/QuadtreeTileID.h>
 #include <CesiumGeospatial/Projection.h>
+#include <CesiumQuantizedMeshTerrain/QuantizedMeshLoader.h>
 #include <CesiumRasterOverlays/RasterOverlay.h>
 #include <CesiumRasterOverlays/RasterOverlayTileProvider.h>
 #include <CesiumRasterOverlays/RasterOverlayUtilities.h>
 #include <CesiumUtility/Assert.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
 #include <variant>
+#include <vector>
 
 using namespace CesiumRasterOverlays;
 
 namespace Cesium3DTilesSelection {
+namespace {
+int64_t computeBufferByteSize(const std::optional<CesiumGltf::Model>& model) {
+  int64_t bytes = 0;
+  if (model) {
+    for (const CesiumGltf::Buffer& buffer : model->buffers) {
+      bytes += int64_t(buffer.cesium.data.size());
+    }
+  }
+
+  return bytes;
+}
+} // namespace
+
 CesiumAsync::Future<TileLoadResult>
 RasterOverlayUpsampler::loadTileContent(const TileLoadInput& loadInput) {
   const Tile* pParent = loadInput.tile.getParent();
@@ -66,21 +87,103 @@ RasterOverlayUpsampler::loadTileContent(const TileLoadInput& loadInput) {
   const CesiumGeospatial::Ellipsoid& ellipsoid =
       getProjectionEllipsoid(projection);
 
-  const CesiumGltf::Model& parentModel = pParentRenderContent->getModel();
-  return loadInput.asyncSystem.runInWorkerThread(
-      [&parentModel,
-       ellipsoid,
-       transform = loadInput.tile.getTransform(),
-       textureCoordinateIndex = index,
-       tileID = *pTileID,
-       pAssetAccessor = loadInput.pAssetAccessor]() mutable {
-        auto model = RasterOverlayUtilities::upsampleGltfForRasterOverlays(
-            parentModel,
-            tileID,
-            false,
-            RasterOverlayUtilities::DEFAULT_TEXTURE_COORDINATE_BASE_NAME,
-            static_cast<int32_t>(textureCoordinateIndex),
-            ellipsoid);
+  // Upsample all of this tile's siblings along with it, because they're almost
+  // always needed at the same time, and it's cheaper to create them together.
+  // The siblings' models are kept here until they're loaded.
+  const std::span<const Tile> siblings = pParent->getChildren();
+  const size_t childIndex = size_t(&loadInput.tile - siblings.data());
+  CESIUM_ASSERT(childIndex < siblings.size());
+
+  auto it = this->_upsampledSiblings.find(pParent);
+  if (it != this->_upsampledSiblings.end() &&
+      (it->second.textureCoordinateIndex != index ||
+       it->second.pFirstChild != siblings.data() ||
+       it->second.loaded[childIndex])) {
+    // The cached models were created with other raster overlays or for other
+    // children, or this tile has been loaded from them before and is now being
+    // reloaded.
+    this->_upsampledSiblings.erase(it);
+    it = this->_upsampledSiblings.end();
+  }
+
+  if (it == this->_upsampledSiblings.end()) {
+    std::vector<CesiumGeometry::UpsampledQuadtreeNode> childIDs;
+    childIDs.reserve(siblings.size());
+    for (const Tile& sibling : siblings) {
+      const CesiumGeometry::UpsampledQuadtreeNode* pSiblingID =
+          std::get_if<CesiumGeometry::UpsampledQuadtreeNode>(
+              &sibling.getTileID());
+      // Every child of a tile subdivided for upsampling is upsampled.
+      CESIUM_ASSERT(pSiblingID != nullptr);
+      childIDs.emplace_back(pSiblingID ? *pSiblingID : *pTileID);
+    }
+
+    // it's totally safe to capture the const ref parent model in the worker
+    // thread. The tileset content manager will guarantee that the parent tile
+    // will not be unloaded while this tile is loading.
+    const CesiumGltf::Model& parentModel = pParentRenderContent->getModel();
+    CesiumAsync::SharedFuture<std::shared_ptr<UpsampledModels>> future =
+        loadInput.asyncSystem
+            .runInWorkerThread([&parentModel,
+                                ellipsoid,
+                                textureCoordinateIndex = index,
+                                childIDs = std::move(childIDs)]() {
+              std::shared_ptr<UpsampledModels> pModels =
+                  std::make_shared<UpsampledModels>();
+              pModels->models =
+                  RasterOverlayUtilities::upsampleGltfForRasterOverlayChildren(
+                      parentModel,
+                      childIDs,
+                      false,
+                      RasterOverlayUtilities::
+                          DEFAULT_TEXTURE_COORDINATE_BASE_NAME,
+                      static_cast<int32_t>(textureCoordinateIndex),
+                      ellipsoid);
+              pModels->byteSizes.reserve(pModels->models.size());
+              for (std::optional<CesiumGltf::Model>& model : pModels->models) {
+                // The interpolated parent height offsets of upsampled terrain
+                // point at the grandparent's surface, but each child has
+                // exactly its parent's surface.
+                if (model) {
+                  CesiumQuantizedMeshTerrain::QuantizedMeshLoader::
+                      clearParentHeightOffsets(*model);
+                }
+                pModels->byteSizes.emplace_back(computeBufferByteSize(model));
+              }
+              return pModels;
+            })
+            .share();
+
+    it = this->_upsampledSiblings
+             .emplace(
+                 pParent,
+                 UpsampledSiblings{
+                     std::move(future),
+                     index,
+                     siblings.data(),
+                     std::vector<bool>(siblings.size(), false)})
+             .first;
+  }
+
+  CesiumAsync::SharedFuture<std::shared_ptr<UpsampledModels>> future =
+      it->second.future;
+
+  // Once every sibling has taken its model, there's nothing left to cache.
+  it->second.loaded[childIndex] = true;
+  if (std::all_of(
+          it->second.loaded.begin(),
+          it->second.loaded.end(),
+          [](bool loaded) { return loaded; })) {
+    this->_upsampledSiblings.erase(it);
+  }
+
+  return future.thenImmediately(
+      [childIndex, ellipsoid, pAssetAccessor = loadInput.pAssetAccessor](
+          const std::shared_ptr<UpsampledModels>& pModels) {
+        // Each sibling only touches its own model, so there's no need to
+        // synchronize access even if siblings finish loading concurrently.
+        std::optional<CesiumGltf::Model>& model =
+            pModels->models[childIndex];
         if (!model) {
           return TileLoadResult::createFailedResult(pAssetAccessor, nullptr);
         }
@@ -96,7 +199,7 @@ RasterOverlayUpsampler::loadTileContent(const TileLoadInput& loadInput) {
               upIt->second.getInt64OrDefault(int64_t(CesiumGeometry::Axis::Y)));
         }
 
-        return TileLoadResult{
+        TileLoadResult result{
             std::move(*model),
             upAxis,
             std::nullopt,
@@ -107,9 +210,34 @@ RasterOverlayUpsampler::loadTileContent(const TileLoadInput& loadInput) {
             {},
             TileLoadResultState::Success,
             ellipsoid};
+        model.reset();
+        return result;
       });
 }
 
+void RasterOverlayUpsampler::discardUpsampledChildren(const Tile& parent) {
+  this->_upsampledSiblings.erase(&parent);
+}
+
+int64_t RasterOverlayUpsampler::getUpsampledChildrenByteSize() const noexcept {
+  int64_t bytes = 0;
+  for (const auto& [pParent, siblings] : this->_upsampledSiblings) {
+    // Models that are still being created are not counted yet.
+    if (!siblings.future.isReady()) {
+      continue;
+    }
+
+    const std::shared_ptr<UpsampledModels>& pModels = siblings.future.wait();
+    for (size_t i = 0; i < siblings.loaded.size(); ++i) {
+      if (!siblings.loaded[i] && i < pModels->byteSizes.size()) {
+        bytes += pModels->byteSizes[i];
+      }
+    }
+  }
+
+  return bytes;
+}
+
 TileChildrenResult RasterOverlayUpsampler::createTileChildren(
     [[maybe_unused]] const Tile& tile,
     [[maybe_unused]] const CesiumGeospatial::Ellipsoid& ellipsoid) {
@@ -1,6 +1,15 @@
 #pragma once
 
 #include <Cesium3DTilesSelection/TilesetContentLoader.h>
+#include <CesiumAsync/SharedFuture.h>
+#include <CesiumGltf/Model.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
 
 namespace Cesium3DTilesSelection {
 class RasterOverlayUpsampler : public TilesetContentLoader {
@@ -12,5 +21,40 @@ public:
       const Tile& tile,
       const CesiumGeospatial::Ellipsoid& ellipsoid
           CESIUM_DEFAULT_ELLIPSOID) override;
+
+  /**
+   * @brief Discards any upsampled children of the given tile that were created
+   * along with a sibling but have not been loaded yet.
+   *
+   * This must be called before the tile's content is unloaded or the tile is
+   * destroyed.
+   */
+  void discardUpsampledChildren(const Tile& parent);
+
+  /**
+   * @brief Gets the size in bytes of the upsampled children that were created
+   * along with a sibling but have not been loaded yet.
+   */
+  int64_t getUpsampledChildrenByteSize() const noexcept;
+
+private:
+  struct UpsampledModels {
+    std::vector<std::optional<CesiumGltf::Model>> models;
+    // The size of each model's buffers, computed when the model is created.
+    std::vector<int64_t> byteSizes;
+  };
+
+  // All the children of a parent tile, upsampled together in a single worker
+  // task when the first of them is loaded.
+  struct UpsampledSiblings {
+    CesiumAsync::SharedFuture<std::shared_ptr<UpsampledModels>> future;
+    size_t textureCoordinateIndex;
+    // The first child of the parent when the children were upsampled, to
+    // recognize a different tile that was later created at the same address.
+    const Tile* pFirstChild;
+    std::vector<bool> loaded;
+  };
+
+  std::unordered_map<const Tile*, UpsampledSiblings> _upsampledSiblings;
 };
 } // namespace Cesium3DTilesSelection
@@ -17,12 +17,12 @@ bool RasterizedPolygonsTileExcluder::shouldExclude(
   if (this->_pOverlay->getInvertSelection()) {
     return Cesium3DTilesSelection::CesiumImpl::outsidePolygons(
         tile.getBoundingVolume(),
-        this->_pOverlay->getPolygons(),
+        this->_pOverlay->getPolygonIndex(),
         this->_pOverlay->getEllipsoid());
   } else {
     return Cesium3DTilesSelection::CesiumImpl::withinPolygons(
         tile.getBoundingVolume(),
-        this->_pOverlay->getPolygons(),
+        this->_pOverlay->getPolygonIndex(),
         this->_pOverlay->getEllipsoid());
   }
 }
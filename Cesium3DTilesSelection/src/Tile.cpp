@@ -5,6 +5,7 @@
 #include <CesiumGeometry/Transforms.h>
 #include <CesiumGeospatial/GlobeTransforms.h>
 #include <CesiumGltf/Model.h>
+#include <CesiumGltfContent/GltfTriangleBvh.h>
 #include <CesiumUtility/JsonHelpers.h>
 #include <CesiumUtility/Tracing.h>
 
@@ -179,6 +180,13 @@ int64_t Tile::computeByteSize() const noexcept {
         bytes += image.pAsset->sizeBytes;
       }
     }
+
+    // Add the hierarchy built for height queries, if any
+    const CesiumGltfContent::GltfTriangleBvh* pTriangleBvh =
+        pRenderContent->getTriangleBvh();
+    if (pTriangleBvh) {
+      bytes += pTriangleBvh->getSizeBytes();
+    }
   }
 
   return bytes;
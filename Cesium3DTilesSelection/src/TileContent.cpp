@@ -6,6 +6,7 @@ using namespace CesiumUtility;
 namespace Cesium3DTilesSelection {
 TileRenderContent::TileRenderContent(CesiumGltf::Model&& model)
     : _model{std::move(model)},
+      _pTriangleBvh{},
       _pRenderResources{nullptr},
       _rasterOverlayDetails{},
       _credits{},
@@ -19,10 +20,23 @@ CesiumGltf::Model& TileRenderContent::getModel() noexcept { return _model; }
 
 void TileRenderContent::setModel(const CesiumGltf::Model& model) {
   _model = model;
+  _pTriangleBvh.reset();
 }
 
 void TileRenderContent::setModel(CesiumGltf::Model&& model) {
   _model = std::move(model);
+  _pTriangleBvh.reset();
+}
+
+const CesiumGltfContent::GltfTriangleBvh*
+TileRenderContent::getTriangleBvh() const noexcept {
+  return this->_pTriangleBvh.get();
+}
+
+void TileRenderContent::setTriangleBvh(
+    std::shared_ptr<const CesiumGltfContent::GltfTriangleBvh>&&
+        pTriangleBvh) noexcept {
+  this->_pTriangleBvh = std::move(pTriangleBvh);
 }
 
 const RasterOverlayDetails&
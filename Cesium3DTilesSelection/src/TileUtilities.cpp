@@ -13,7 +13,7 @@ namespace CesiumImpl {
 
 bool withinPolygons(
     const BoundingVolume& boundingVolume,
-    const std::vector<CartographicPolygon>& cartographicPolygons,
+    const CartographicPolygonIndex& polygonIndex,
     const Ellipsoid& ellipsoid) noexcept {
 
   std::optional<GlobeRectangle> maybeRectangle =
@@ -22,15 +22,12 @@ bool withinPolygons(
     return false;
   }
 
-  return CartographicPolygon::rectangleIsWithinPolygons(
-      *maybeRectangle,
-      cartographicPolygons);
+  return polygonIndex.rectangleIsWithinPolygons(*maybeRectangle);
 }
 
 bool outsidePolygons(
     const BoundingVolume& boundingVolume,
-    const std::vector<CesiumGeospatial::CartographicPolygon>&
-        cartographicPolygons,
+    const CartographicPolygonIndex& polygonIndex,
     const Ellipsoid& ellipsoid) noexcept {
 
   std::optional<GlobeRectangle> maybeRectangle =
@@ -39,9 +36,7 @@ bool outsidePolygons(
     return false;
   }
 
-  return CartographicPolygon::rectangleIsOutsidePolygons(
-      *maybeRectangle,
-      cartographicPolygons);
+  return polygonIndex.rectangleIsOutsidePolygons(*maybeRectangle);
 }
 
 } // namespace CesiumImpl
@@ -596,6 +596,14 @@ Tileset::sampleHeightMostDetailed(const std::vector<Cartographic>& positions) {
   return promise.getFuture();
 }
 
+SampleHeightResult Tileset::sampleHeightCurrentDetail(
+    const std::vector<Cartographic>& positions) {
+  return TilesetHeightQuery::sampleLoadedTiles(
+      this->_pTilesetContentManager->getRootTile(),
+      this->_options,
+      positions);
+}
+
 static void markTileNonRendered(
     TileSelectionState::Result lastResult,
     Tile& tile,
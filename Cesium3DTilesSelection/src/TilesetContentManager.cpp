@@ -8,6 +8,9 @@
 #include <Cesium3DTilesSelection/IPrepareRendererResources.h>
 #include <CesiumAsync/IAssetRequest.h>
 #include <CesiumAsync/IAssetResponse.h>
+#include <CesiumGltf/ExtensionBufferViewExtMeshoptCompression.h>
+#include <CesiumGltf/ExtensionKhrDracoMeshCompression.h>
+#include <CesiumGltfContent/GltfTriangleBvh.h>
 #include <CesiumGltfContent/GltfUtilities.h>
 #include <CesiumGltfReader/GltfReader.h>
 #include <CesiumRasterOverlays/RasterOverlay.h>
@@ -20,6 +23,7 @@
 
 #include <rapidjson/document.h>
 
+#include <algorithm>
 #include <chrono>
 
 using namespace CesiumGltfContent;
@@ -63,6 +67,7 @@ struct ContentKindSetter {
 
     auto pRenderContent = std::make_unique<TileRenderContent>(std::move(model));
     pRenderContent->setRenderResources(pRenderResources);
+    pRenderContent->setTriangleBvh(std::move(pTriangleBvh));
     if (rasterOverlayDetails) {
       pRenderContent->setRasterOverlayDetails(std::move(*rasterOverlayDetails));
     }
@@ -73,6 +78,7 @@ struct ContentKindSetter {
   TileContent& tileContent;
   std::optional<RasterOverlayDetails> rasterOverlayDetails;
   void* pRenderResources;
+  std::shared_ptr<const GltfTriangleBvh> pTriangleBvh;
 };
 
 void unloadTileRecursively(
@@ -388,6 +394,39 @@ const BoundingVolume& getEffectiveContentBoundingVolume(
   return tileBoundingVolume;
 }
 
+bool hasUndecodedCompressedPrimitive(const CesiumGltf::Model& model) {
+  for (const CesiumGltf::Mesh& mesh : model.meshes) {
+    for (const CesiumGltf::MeshPrimitive& primitive : mesh.primitives) {
+      if (primitive.hasExtension<
+              CesiumGltf::ExtensionKhrDracoMeshCompression>()) {
+        return true;
+      }
+
+      auto positionIt = primitive.attributes.find("POSITION");
+      if (positionIt == primitive.attributes.end()) {
+        continue;
+      }
+
+      const CesiumGltf::Accessor* pAccessor =
+          CesiumGltf::Model::getSafe(&model.accessors, positionIt->second);
+      if (pAccessor == nullptr) {
+        continue;
+      }
+
+      const CesiumGltf::BufferView* pBufferView = CesiumGltf::Model::getSafe(
+          &model.bufferViews,
+          pAccessor->bufferView);
+      if (pBufferView &&
+          pBufferView->hasExtension<
+              CesiumGltf::ExtensionBufferViewExtMeshoptCompression>()) {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
 void calcRasterOverlayDetailsInWorkerThread(
     TileLoadResult& result,
     std::vector<CesiumGeospatial::Projection>&& projections,
@@ -427,6 +466,20 @@ void calcRasterOverlayDetailsInWorkerThread(
     projections.erase(removedProjectionIt, projections.end());
   }
 
+  // The positions of primitives that were left compressed cannot be read, so
+  // those primitives get no overlay texture coordinates.
+  if (!projections.empty() && hasUndecodedCompressedPrimitive(model)) {
+    auto it = model.extras.find("Cesium3DTiles_TileUrl");
+    std::string url = it != model.extras.end()
+                          ? it->second.getStringOrDefault("Unknown Tile URL")
+                          : "Unknown Tile URL";
+    SPDLOG_LOGGER_WARN(
+        tileLoadInfo.pLogger,
+        "Tile has mesh data that was not decoded while loading, so raster "
+        "overlays will not be draped over it: {}",
+        url);
+  }
+
   // generate the overlay details from the rest of projections and merge it with
   // the existing one
   auto overlayDetails =
@@ -489,6 +542,12 @@ void calcFittestBoundingRegionForLooseTile(
     const TileContentLoadInfo& tileLoadInfo) {
   CesiumGltf::Model& model = std::get<CesiumGltf::Model>(result.contentKind);
 
+  // The positions of primitives that were left compressed are not included
+  // in the computed bounds, so keep the loose heights instead.
+  if (hasUndecodedCompressedPrimitive(model)) {
+    return;
+  }
+
   const BoundingVolume& boundingVolume = getEffectiveBoundingVolume(
       tileLoadInfo.tileBoundingVolume,
       result.updatedBoundingVolume,
@@ -537,6 +596,16 @@ void postProcessGltfInWorkerThread(
   if (tileLoadInfo.contentOptions.generateMissingNormalsSmooth) {
     model.generateMissingNormalsSmooth();
   }
+
+  // report the memory saved by mesh data that was left compressed
+  result.compressedMeshByteSavings =
+      GltfUtilities::computeCompressedMeshByteSavings(model);
+
+  // build the hierarchy for height queries here, rather than in the main
+  // thread when the tile is first queried
+  if (tileLoadInfo.contentOptions.enableHeightQueryTriangleBvh) {
+    result.pTriangleBvh = std::make_shared<GltfTriangleBvh>(model);
+  }
 }
 
 CesiumAsync::Future<TileLoadResultAndRenderResources>
@@ -566,6 +635,9 @@ postProcessContentInWorkerThread(
       tileLoadInfo.contentOptions.ktx2TranscodeTargets;
   gltfOptions.applyTextureTransform =
       tileLoadInfo.contentOptions.applyTextureTransform;
+  gltfOptions.decodeDraco = tileLoadInfo.contentOptions.decodeDraco;
+  gltfOptions.decodeMeshOptData =
+      tileLoadInfo.contentOptions.decodeMeshOptData;
   if (tileLoadInfo.pSharedAssetSystem) {
     gltfOptions.pSharedAssetSystem = tileLoadInfo.pSharedAssetSystem;
   }
@@ -1163,6 +1235,24 @@ bool TilesetContentManager::unloadTileContent(Tile& tile) {
 
   // If we make it this far, the tile's content will be fully unloaded.
   notifyTileUnloading(&tile);
+
+  // Children upsampled from this tile's content, but not loaded yet, are
+  // created again from the new content if the tile is reloaded.
+  this->_upsampler.discardUpsampledChildren(tile);
+
+  // A glTF is made up of a great many small allocations, and freeing them
+  // when unloading many tiles at once can take a significant portion of the
+  // frame. So destroy the model in a worker thread instead.
+  TileRenderContent* pRenderContent = content.getRenderContent();
+  if (pRenderContent) {
+    this->_externals.asyncSystem.runInWorkerThread(
+        [pModel = std::make_unique<CesiumGltf::Model>(
+             std::move(pRenderContent->getModel()))]() mutable {
+          CESIUM_TRACE("TilesetContentManager::destroyUnloadedModel");
+          pModel.reset();
+        });
+  }
+
   content.setContentKind(TileUnknownContent{});
   tile.setState(TileLoadState::Unloaded);
   return true;
@@ -1255,9 +1345,27 @@ int32_t TilesetContentManager::getNumberOfTilesLoaded() const noexcept {
 
 int64_t TilesetContentManager::getTotalDataUsed() const noexcept {
   int64_t bytes = this->_tilesDataUsed;
-  for (const auto& pTileProvider :
-       this->_overlayCollection.getTileProviders()) {
-    bytes += pTileProvider->getTileDataBytes();
+
+  // Upsampled children that are waiting for their tiles to load.
+  bytes += this->_upsampler.getUpsampledChildrenByteSize();
+
+  // A tile provider shared with other tilesets counts only this tileset's
+  // share of its tiles, so that the tiles are counted once in all.
+  const std::vector<IntrusivePointer<RasterOverlay>>& overlays =
+      this->_overlayCollection.getOverlays();
+  const std::vector<IntrusivePointer<RasterOverlayTileProvider>>&
+      tileProviders = this->_overlayCollection.getTileProviders();
+  for (size_t i = 0; i < tileProviders.size(); ++i) {
+    int64_t users = 1;
+    if (i < overlays.size()) {
+      users = std::max(
+          int64_t(overlays[i]->getSharedTileProviderUsers(
+              this->_externals.asyncSystem,
+              this->_externals.pAssetAccessor,
+              this->_externals.pCreditSystem)),
+          int64_t(1));
+    }
+    bytes += tileProviders[i]->getTileDataBytes() / users;
   }
 
   return bytes;
@@ -1345,7 +1453,8 @@ void TilesetContentManager::setTileContent(
         ContentKindSetter{
             content,
             std::move(result.rasterOverlayDetails),
-            pWorkerRenderResources},
+            pWorkerRenderResources,
+            std::move(result.pTriangleBvh)},
         std::move(result.contentKind));
 
     if (result.tileInitializer) {
@@ -5,10 +5,18 @@
 
 #include <Cesium3DTilesSelection/ITilesetHeightSampler.h>
 #include <Cesium3DTilesSelection/SampleHeightResult.h>
+#include <Cesium3DTilesSelection/TilesetOptions.h>
 #include <CesiumGeometry/IntersectionTests.h>
 #include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumGltfContent/GltfTriangleBvh.h>
 #include <CesiumGltfContent/GltfUtilities.h>
 
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 using namespace Cesium3DTilesSelection;
 using namespace CesiumGeospatial;
 using namespace CesiumGeometry;
@@ -76,6 +84,38 @@ Ray createRay(const Cartographic& position, const Ellipsoid& ellipsoid) {
       -Ellipsoid::WGS84.geodeticSurfaceNormal(startPosition));
 }
 
+SampleHeightResult createSampleHeightResult(
+    const std::vector<TilesetHeightQuery>& queries,
+    const TilesetOptions& options,
+    std::vector<std::string>&& warnings) {
+  SampleHeightResult results;
+
+  // Start with any warnings from tile traversal
+  results.warnings = std::move(warnings);
+
+  results.positions.resize(queries.size(), Cartographic(0.0, 0.0, 0.0));
+  results.sampleSuccess.resize(queries.size());
+  results.geometricErrors.resize(queries.size(), -1.0);
+
+  // Populate results with completed queries
+  for (size_t i = 0; i < queries.size(); ++i) {
+    const TilesetHeightQuery& query = queries[i];
+
+    bool sampleSuccess = query.intersection.has_value();
+    results.sampleSuccess[i] = sampleSuccess;
+    results.positions[i] = query.inputPosition;
+
+    if (sampleSuccess) {
+      results.positions[i].height =
+          options.ellipsoid.getMaximumRadius() * rayOriginHeightFraction -
+          glm::sqrt(query.intersection->rayToWorldPointDistanceSq);
+      results.geometricErrors[i] = query.intersectionGeometricError;
+    }
+  }
+
+  return results;
+}
+
 } // namespace
 
 TilesetHeightQuery::TilesetHeightQuery(
@@ -85,39 +125,78 @@ TilesetHeightQuery::TilesetHeightQuery(
       ray(createRay(position, ellipsoid_)),
       ellipsoid(ellipsoid_),
       intersection(),
+      intersectionGeometricError(-1.0),
       additiveCandidateTiles(),
       candidateTiles(),
       previousCandidateTiles() {}
 
-void TilesetHeightQuery::intersectVisibleTile(
+void TilesetHeightQuery::addIntersection(
+    std::optional<CesiumGltfContent::GltfUtilities::RayGltfHit>&& hit,
+    double geometricError) {
+  if (!hit)
+    return;
+
+  // Set ray info to this hit if closer, or the first hit
+  if (!this->intersection ||
+      hit->rayToWorldPointDistanceSq <
+          this->intersection->rayToWorldPointDistanceSq) {
+    this->intersection = std::move(hit);
+    this->intersectionGeometricError = geometricError;
+  }
+}
+
+/*static*/ void TilesetHeightQuery::intersectVisibleTile(
     Tile* pTile,
+    std::span<TilesetHeightQuery* const> queries,
     std::vector<std::string>& outWarnings) {
   TileRenderContent* pRenderContent = pTile->getContent().getRenderContent();
   if (!pRenderContent)
     return;
 
-  auto gltfIntersectResult =
-      CesiumGltfContent::GltfUtilities::intersectRayGltfModel(
-          this->ray,
-          pRenderContent->getModel(),
-          true,
-          pTile->getTransform());
-
-  if (!gltfIntersectResult.warnings.empty()) {
-    outWarnings.insert(
-        outWarnings.end(),
-        std::make_move_iterator(gltfIntersectResult.warnings.begin()),
-        std::make_move_iterator(gltfIntersectResult.warnings.end()));
+  // The hierarchy is only ever built while loading the tile, in a worker
+  // thread. Without it, test every triangle.
+  const CesiumGltfContent::GltfTriangleBvh* pTriangleBvh =
+      pRenderContent->getTriangleBvh();
+  if (pTriangleBvh) {
+    std::vector<Ray> rays;
+    rays.reserve(queries.size());
+    for (const TilesetHeightQuery* pQuery : queries) {
+      rays.emplace_back(pQuery->ray);
+    }
+
+    std::vector<std::optional<CesiumGltfContent::GltfUtilities::RayGltfHit>>
+        hits = pTriangleBvh->intersectRays(
+            rays,
+            outWarnings,
+            true,
+            pTile->getTransform());
+
+    for (size_t i = 0; i < queries.size(); ++i) {
+      queries[i]->addIntersection(
+          std::move(hits[i]),
+          pTile->getGeometricError());
+    }
+    return;
   }
 
-  // Set ray info to this hit if closer, or the first hit
-  if (!this->intersection.has_value()) {
-    this->intersection = std::move(gltfIntersectResult.hit);
-  } else {
-    double prevDistSq = this->intersection->rayToWorldPointDistanceSq;
-    double thisDistSq = intersection->rayToWorldPointDistanceSq;
-    if (thisDistSq < prevDistSq)
-      this->intersection = std::move(gltfIntersectResult.hit);
+  for (TilesetHeightQuery* pQuery : queries) {
+    auto gltfIntersectResult =
+        CesiumGltfContent::GltfUtilities::intersectRayGltfModel(
+            pQuery->ray,
+            pRenderContent->getModel(),
+            true,
+            pTile->getTransform());
+
+    if (!gltfIntersectResult.warnings.empty()) {
+      outWarnings.insert(
+          outWarnings.end(),
+          std::make_move_iterator(gltfIntersectResult.warnings.begin()),
+          std::make_move_iterator(gltfIntersectResult.warnings.end()));
+    }
+
+    pQuery->addIntersection(
+        std::move(gltfIntersectResult.hit),
+        pTile->getGeometricError());
   }
 }
 
@@ -134,10 +213,33 @@ void markTileVisited(Tile::LoadedLinkedList& loadedTiles, Tile* pTile) {
   loadedTiles.insertAtTail(*pTile);
 }
 
+// Groups height queries by tile, in the order in which each tile is first
+// added.
+class QueriesByTile {
+public:
+  void add(Tile* pTile, TilesetHeightQuery* pQuery) {
+    auto [it, added] = this->_groupIndices.emplace(pTile, this->_groups.size());
+    if (added) {
+      this->_groups.emplace_back(pTile, std::vector<TilesetHeightQuery*>());
+    }
+    this->_groups[it->second].second.emplace_back(pQuery);
+  }
+
+  const std::vector<std::pair<Tile*, std::vector<TilesetHeightQuery*>>>&
+  getGroups() const noexcept {
+    return this->_groups;
+  }
+
+private:
+  std::unordered_map<Tile*, size_t> _groupIndices;
+  std::vector<std::pair<Tile*, std::vector<TilesetHeightQuery*>>> _groups;
+};
+
 } // namespace
 
-void TilesetHeightQuery::findCandidateTiles(
+/*static*/ void TilesetHeightQuery::findCandidateTiles(
     Tile* pTile,
+    std::span<TilesetHeightQuery* const> queries,
     Tile::LoadedLinkedList& loadedTiles,
     std::vector<std::string>& warnings) {
   // Make sure this tile is not unloaded until we're done with it.
@@ -149,6 +251,15 @@ void TilesetHeightQuery::findCandidateTiles(
     return;
   }
 
+  auto containsQuery = [](const BoundingVolume& boundingVolume,
+                          const TilesetHeightQuery& query) {
+    return boundingVolumeContainsCoordinate(
+        boundingVolume,
+        query.ray,
+        query.inputPosition,
+        query.ellipsoid);
+  };
+
   const std::optional<BoundingVolume>& contentBoundingVolume =
       pTile->getContentBoundingVolume();
 
@@ -156,48 +267,150 @@ void TilesetHeightQuery::findCandidateTiles(
     // This is a leaf node, it's a candidate
 
     // If optional content bounding volume exists, test against it
-    if (contentBoundingVolume) {
-      if (boundingVolumeContainsCoordinate(
-              *contentBoundingVolume,
-              this->ray,
-              this->inputPosition,
-              this->ellipsoid))
-        this->candidateTiles.push_back(pTile);
-    } else {
-      this->candidateTiles.push_back(pTile);
+    for (TilesetHeightQuery* pQuery : queries) {
+      if (!contentBoundingVolume ||
+          containsQuery(*contentBoundingVolume, *pQuery))
+        pQuery->candidateTiles.push_back(pTile);
+    }
+    return;
+  }
+
+  // We have children
+
+  // If additive refinement, add parent to the list with children
+  if (pTile->getRefine() == TileRefine::Add) {
+    // If optional content bounding volume exists, test against it
+    for (TilesetHeightQuery* pQuery : queries) {
+      if (!contentBoundingVolume ||
+          containsQuery(*contentBoundingVolume, *pQuery))
+        pQuery->additiveCandidateTiles.push_back(pTile);
     }
-  } else {
-    // We have children
-
-    // If additive refinement, add parent to the list with children
-    if (pTile->getRefine() == TileRefine::Add) {
-      // If optional content bounding volume exists, test against it
-      if (contentBoundingVolume) {
-        if (boundingVolumeContainsCoordinate(
-                *contentBoundingVolume,
-                this->ray,
-                this->inputPosition,
-                this->ellipsoid))
-          this->additiveCandidateTiles.push_back(pTile);
-      } else {
-        this->additiveCandidateTiles.push_back(pTile);
+  }
+
+  // Traverse children, each with the queries whose rays intersect its bounding
+  // volume.
+  std::vector<TilesetHeightQuery*> childQueries;
+  childQueries.reserve(queries.size());
+  for (Tile& child : pTile->getChildren()) {
+    childQueries.clear();
+    for (TilesetHeightQuery* pQuery : queries) {
+      if (containsQuery(child.getBoundingVolume(), *pQuery))
+        childQueries.emplace_back(pQuery);
+    }
+
+    if (!childQueries.empty())
+      findCandidateTiles(&child, childQueries, loadedTiles, warnings);
+  }
+}
+
+namespace {
+
+bool isContentLoaded(const Tile& tile) {
+  TileLoadState state = tile.getState();
+  return (state == TileLoadState::ContentLoaded ||
+          state == TileLoadState::Done) &&
+         tile.getContent().isRenderContent();
+}
+
+// Intersects the queries with the most detailed loaded content of the tile and
+// its descendants. Returns, for each query, whether the loaded content of this
+// tile or of one of its descendants contains the query's position.
+std::vector<bool> intersectLoadedTiles(
+    Tile& tile,
+    std::span<TilesetHeightQuery* const> queries,
+    std::vector<std::string>& warnings) {
+  auto containsQuery = [](const BoundingVolume& boundingVolume,
+                          const TilesetHeightQuery& query) {
+    return boundingVolumeContainsCoordinate(
+        boundingVolume,
+        query.ray,
+        query.inputPosition,
+        query.ellipsoid);
+  };
+
+  std::vector<bool> covered(queries.size(), false);
+
+  // Children are more detailed, so visit them first.
+  std::vector<TilesetHeightQuery*> childQueries;
+  std::vector<size_t> childQueryIndices;
+  for (Tile& child : tile.getChildren()) {
+    childQueries.clear();
+    childQueryIndices.clear();
+    for (size_t i = 0; i < queries.size(); ++i) {
+      if (containsQuery(child.getBoundingVolume(), *queries[i])) {
+        childQueries.emplace_back(queries[i]);
+        childQueryIndices.emplace_back(i);
       }
     }
 
-    // Traverse children
-    for (Tile& child : pTile->getChildren()) {
-      // if bounding volume doesn't intersect this ray, we can skip it
-      if (!boundingVolumeContainsCoordinate(
-              child.getBoundingVolume(),
-              this->ray,
-              this->inputPosition,
-              this->ellipsoid))
-        continue;
-
-      // Child is a candidate, traverse it and its children
-      findCandidateTiles(&child, loadedTiles, warnings);
+    if (childQueries.empty())
+      continue;
+
+    std::vector<bool> childCovered =
+        intersectLoadedTiles(child, childQueries, warnings);
+    for (size_t i = 0; i < childCovered.size(); ++i) {
+      if (childCovered[i])
+        covered[childQueryIndices[i]] = true;
     }
   }
+
+  if (!isContentLoaded(tile))
+    return covered;
+
+  // This tile's content is used for the queries that no loaded descendant
+  // covers, or for all of them if the descendants are added to this tile
+  // rather than replacing it.
+  const std::optional<BoundingVolume>& contentBoundingVolume =
+      tile.getContentBoundingVolume();
+  const bool additive = tile.getRefine() == TileRefine::Add;
+
+  std::vector<TilesetHeightQuery*> tileQueries;
+  for (size_t i = 0; i < queries.size(); ++i) {
+    if (covered[i] && !additive)
+      continue;
+
+    if (!contentBoundingVolume ||
+        containsQuery(*contentBoundingVolume, *queries[i])) {
+      tileQueries.emplace_back(queries[i]);
+      covered[i] = true;
+    }
+  }
+
+  if (!tileQueries.empty()) {
+    TilesetHeightQuery::intersectVisibleTile(&tile, tileQueries, warnings);
+  }
+
+  return covered;
+}
+
+} // namespace
+
+/*static*/ SampleHeightResult TilesetHeightQuery::sampleLoadedTiles(
+    Tile* pRootTile,
+    const TilesetOptions& options,
+    const std::vector<Cartographic>& positions) {
+  std::vector<TilesetHeightQuery> queries;
+  queries.reserve(positions.size());
+  for (const Cartographic& position : positions) {
+    queries.emplace_back(position, options.ellipsoid);
+  }
+
+  std::vector<std::string> warnings;
+  if (pRootTile) {
+    std::vector<TilesetHeightQuery*> rootQueries;
+    rootQueries.reserve(queries.size());
+    for (TilesetHeightQuery& query : queries) {
+      rootQueries.emplace_back(&query);
+    }
+
+    intersectLoadedTiles(*pRootTile, rootQueries, warnings);
+  } else if (!queries.empty()) {
+    warnings.emplace_back(
+        "Height sampling could not complete because the tileset's root tile "
+        "is not loaded yet.");
+  }
+
+  return createSampleHeightResult(queries, options, std::move(warnings));
 }
 
 /*static*/ void TilesetHeightRequest::processHeightRequests(
@@ -239,6 +452,7 @@ void Cesium3DTilesSelection::TilesetHeightRequest::failHeightRequests(
     SampleHeightResult result;
     result.warnings.emplace_back(message);
     result.sampleSuccess.resize(request.queries.size(), false);
+    result.geometricErrors.resize(request.queries.size(), -1.0);
 
     result.positions.reserve(request.queries.size());
     for (const TilesetHeightQuery& query : request.queries) {
@@ -270,9 +484,18 @@ bool TilesetHeightRequest::tryCompleteHeightRequest(
         positions.emplace_back(query.inputPosition);
       }
 
-      pSampler->sampleHeights(asyncSystem, std::move(positions))
-          .thenImmediately(
-              [promise = this->promise](SampleHeightResult&& result) {
+      // Keep the content manager, and with it the sampler, alive until the
+      // heights have been sampled.
+      pSampler
+          ->sampleHeightsWithHeaders(
+              asyncSystem,
+              std::move(positions),
+              contentManager.getRequestHeaders())
+          .thenInMainThread(
+              [promise = this->promise,
+               pContentManager =
+                   IntrusivePointer<TilesetContentManager>(&contentManager)](
+                  SampleHeightResult&& result) {
                 promise.resolve(std::move(result));
               });
 
@@ -281,16 +504,19 @@ bool TilesetHeightRequest::tryCompleteHeightRequest(
   }
 
   // No direct height query possible, so download and sample tiles.
+  //
+  // Queries are grouped by the tile at which their search for candidate tiles
+  // starts, and then by the candidate tiles they intersect, so that each tile
+  // is visited once per group rather than once per query, and the rays of a
+  // group are intersected with the tile's triangles together.
   bool tileStillNeedsLoading = false;
   std::vector<std::string> warnings;
+  QueriesByTile searches;
   for (TilesetHeightQuery& query : this->queries) {
     if (query.candidateTiles.empty() && query.additiveCandidateTiles.empty()) {
       // Find the initial set of tiles whose bounding volume is intersected by
       // the query ray.
-      query.findCandidateTiles(
-          contentManager.getRootTile(),
-          loadedTiles,
-          warnings);
+      searches.add(contentManager.getRootTile(), &query);
     } else {
       // Refine the current set of candidate tiles, in case further tiles from
       // implicit tiling, external tilesets, etc. having been loaded since last
@@ -303,7 +529,7 @@ bool TilesetHeightRequest::tryCompleteHeightRequest(
         TileLoadState loadState = pCandidate->getState();
         if (!pCandidate->getChildren().empty() &&
             loadState >= TileLoadState::ContentLoaded) {
-          query.findCandidateTiles(pCandidate, loadedTiles, warnings);
+          searches.add(pCandidate, &query);
         } else {
           // Make sure this tile stays loaded.
           markTileVisited(loadedTiles, pCandidate);
@@ -313,25 +539,36 @@ bool TilesetHeightRequest::tryCompleteHeightRequest(
         }
       }
     }
+  }
 
-    auto checkTile = [&contentManager,
-                      &options,
-                      &tileLoadSet,
-                      &tileStillNeedsLoading](Tile* pTile) {
-      contentManager.createLatentChildrenIfNecessary(*pTile, options);
-
-      TileLoadState state = pTile->getState();
-      if (state == TileLoadState::Unloading) {
-        // This tile is in the process of unloading, which must complete
-        // before we can load it again.
-        contentManager.unloadTileContent(*pTile);
-        tileStillNeedsLoading = true;
-      } else if (state <= TileLoadState::ContentLoading) {
-        tileLoadSet.insert(pTile);
-        tileStillNeedsLoading = true;
-      }
-    };
+  for (const auto& [pTile, tileQueries] : searches.getGroups()) {
+    TilesetHeightQuery::findCandidateTiles(
+        pTile,
+        tileQueries,
+        loadedTiles,
+        warnings);
+  }
+
+  auto checkTile = [&contentManager,
+                    &options,
+                    &tileLoadSet,
+                    &tileStillNeedsLoading](Tile* pTile) {
+    contentManager.createLatentChildrenIfNecessary(*pTile, options);
+
+    TileLoadState state = pTile->getState();
+    if (state == TileLoadState::Unloading) {
+      // This tile is in the process of unloading, which must complete
+      // before we can load it again.
+      contentManager.unloadTileContent(*pTile);
+      tileStillNeedsLoading = true;
+    } else if (state <= TileLoadState::ContentLoading) {
+      tileLoadSet.insert(pTile);
+      tileStillNeedsLoading = true;
+    }
+  };
 
+  QueriesByTile intersections;
+  for (TilesetHeightQuery& query : this->queries) {
     // If any candidates need loading, add to return set
     for (Tile* pTile : query.additiveCandidateTiles) {
       // Additive tiles are only enumerated once in findCandidateTiles, so we
@@ -340,9 +577,11 @@ bool TilesetHeightRequest::tryCompleteHeightRequest(
       markTileVisited(loadedTiles, pTile);
 
       checkTile(pTile);
+      intersections.add(pTile, &query);
     }
     for (Tile* pTile : query.candidateTiles) {
       checkTile(pTile);
+      intersections.add(pTile, &query);
     }
   }
 
@@ -351,38 +590,13 @@ bool TilesetHeightRequest::tryCompleteHeightRequest(
     return false;
 
   // Do the intersect tests
-  for (TilesetHeightQuery& query : this->queries) {
-    for (Tile* pTile : query.additiveCandidateTiles) {
-      query.intersectVisibleTile(pTile, warnings);
-    }
-    for (Tile* pTile : query.candidateTiles) {
-      query.intersectVisibleTile(pTile, warnings);
-    }
+  for (const auto& [pTile, tileQueries] : intersections.getGroups()) {
+    TilesetHeightQuery::intersectVisibleTile(pTile, tileQueries, warnings);
   }
 
   // All rays are done, create results
-  SampleHeightResult results;
-
-  // Start with any warnings from tile traversal
-  results.warnings = std::move(warnings);
-
-  results.positions.resize(this->queries.size(), Cartographic(0.0, 0.0, 0.0));
-  results.sampleSuccess.resize(this->queries.size());
-
-  // Populate results with completed queries
-  for (size_t i = 0; i < this->queries.size(); ++i) {
-    const TilesetHeightQuery& query = this->queries[i];
-
-    bool sampleSuccess = query.intersection.has_value();
-    results.sampleSuccess[i] = sampleSuccess;
-    results.positions[i] = query.inputPosition;
-
-    if (sampleSuccess) {
-      results.positions[i].height =
-          options.ellipsoid.getMaximumRadius() * rayOriginHeightFraction -
-          glm::sqrt(query.intersection->rayToWorldPointDistanceSq);
-    }
-  }
+  SampleHeightResult results =
+      createSampleHeightResult(this->queries, options, std::move(warnings));
 
   this->promise.resolve(std::move(results));
   return true;
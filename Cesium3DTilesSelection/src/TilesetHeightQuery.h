@@ -8,7 +8,9 @@
 #include <CesiumGltfContent/GltfUtilities.h>
 
 #include <list>
+#include <optional>
 #include <set>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -54,6 +56,13 @@ public:
    */
   std::optional<CesiumGltfContent::GltfUtilities::RayGltfHit> intersection;
 
+  /**
+   * @brief The geometric error of the tile that supplied the
+   * {@link TilesetHeightQuery::intersection}, or -1.0 if there is no
+   * intersection yet.
+   */
+  double intersectionGeometricError;
+
   /**
    * @brief Non-leaf tiles with additive refinement whose bounding volumes are
    * intersected by the query ray.
@@ -74,37 +83,77 @@ public:
   std::vector<Tile*> previousCandidateTiles;
 
   /**
-   * @brief Find the intersection of the ray with the given tile. If there is
-   * one, and if it's closer to the ray's origin than the previous best-known
-   * intersection, then {@link TilesetHeightQuery::intersection} will be
-   * updated.
+   * @brief Replaces {@link TilesetHeightQuery::intersection} with the given
+   * hit if there is no intersection yet or if the hit is closer to the ray's
+   * origin.
+   *
+   * @param hit The hit, or `std::nullopt` if the ray missed.
+   * @param geometricError The geometric error of the tile that was hit.
+   */
+  void addIntersection(
+      std::optional<CesiumGltfContent::GltfUtilities::RayGltfHit>&& hit,
+      double geometricError);
+
+  /**
+   * @brief Find the intersections of the rays of several queries with the
+   * given tile. Each query's {@link TilesetHeightQuery::intersection} is
+   * updated if the tile is hit closer to the ray's origin than the previous
+   * best-known intersection.
    *
-   * @param pTile The tile to test for intersection with the ray.
+   * @param pTile The tile to test for intersection with the rays.
+   * @param queries The queries whose rays to intersect with the tile. If the
+   * tile has a {@link TileRenderContent::getTriangleBvh}, they are intersected
+   * with it together; otherwise, with every triangle, one at a time.
    * @param outWarnings On return, reports any warnings that occurred while
-   * attempting to intersect the ray with the tile.
+   * attempting to intersect the rays with the tile.
    */
-  void intersectVisibleTile(Tile* pTile, std::vector<std::string>& outWarnings);
+  static void intersectVisibleTile(
+      Tile* pTile,
+      std::span<TilesetHeightQuery* const> queries,
+      std::vector<std::string>& outWarnings);
 
   /**
-   * @brief Find candidate tiles for the height query by traversing the tile
-   * tree, starting with the given tile.
+   * @brief Find candidate tiles for several height queries by traversing the
+   * tile tree once, starting with the given tile.
    *
-   * Any tile whose bounding volume intersects the ray will be added to the
-   * {@link TilesetHeightQuery::candidateTiles} vector. Non-leaf tiles that are
-   * additively-refined will be added to
-   * {@link TilesetHeightQuery::additiveCandidateTiles}.
+   * Any tile whose bounding volume intersects a query's ray will be added to
+   * the query's {@link TilesetHeightQuery::candidateTiles} vector. Non-leaf
+   * tiles that are additively-refined will be added to
+   * {@link TilesetHeightQuery::additiveCandidateTiles}. Each child tile is
+   * only traversed with the queries whose rays intersect it.
    *
    * @param pTile The tile at which to start traversal.
+   * @param queries The queries for which to find candidate tiles.
    * @param loadedTiles The linked list of loaded tiles, used to ensure that
    * tiles loaded for height queries stay loaded just long enough to complete
    * the query, and no longer.
    * @param outWarnings On return, reports any warnings that occurred during
    * candidate search.
    */
-  void findCandidateTiles(
+  static void findCandidateTiles(
       Tile* pTile,
+      std::span<TilesetHeightQuery* const> queries,
       Tile::LoadedLinkedList& loadedTiles,
       std::vector<std::string>& outWarnings);
+
+  /**
+   * @brief Samples heights, immediately, from the tiles that are already
+   * loaded, without loading any more.
+   *
+   * Each height comes from the most detailed loaded tile that contains the
+   * position, as well as from any loaded additively-refined ancestors of that
+   * tile. A sample fails if no loaded tile contains its position.
+   *
+   * @param pRootTile The root tile of the tileset, or nullptr if it is not
+   * loaded yet.
+   * @param options Options associated with the tileset.
+   * @param positions The positions for which to sample heights.
+   * @return The result of the height query.
+   */
+  static SampleHeightResult sampleLoadedTiles(
+      Tile* pRootTile,
+      const TilesetOptions& options,
+      const std::vector<CesiumGeospatial::Cartographic>& positions);
 };
 
 /**
@@ -956,6 +956,8 @@ TilesetJsonLoader::loadTileContent(const TileLoadInput& loadInput) {
                   contentOptions.ktx2TranscodeTargets;
               gltfOptions.applyTextureTransform =
                   contentOptions.applyTextureTransform;
+              gltfOptions.decodeDraco = contentOptions.decodeDraco;
+              gltfOptions.decodeMeshOptData = contentOptions.decodeMeshOptData;
               return converter(responseData, gltfOptions, assetFetcher)
                   .thenImmediately(
                       [ellipsoid,
@@ -0,0 +1,135 @@
+#include <Cesium3DTilesSelection/EllipsoidTilesetLoader.h>
+#include <Cesium3DTilesSelection/Tile.h>
+#include <Cesium3DTilesSelection/TileLoadResult.h>
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumGeometry/QuadtreeTileID.h>
+#include <CesiumGeospatial/BoundingRegion.h>
+#include <CesiumGeospatial/Cartographic.h>
+#include <CesiumGeospatial/Ellipsoid.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumGltf/AccessorView.h>
+#include <CesiumGltf/Model.h>
+#include <CesiumNativeTests/SimpleTaskProcessor.h>
+
+#include <catch2/catch.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <glm/geometric.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+#include <spdlog/spdlog.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <variant>
+#include <vector>
+
+using namespace Cesium3DTilesSelection;
+using namespace CesiumAsync;
+using namespace CesiumGeometry;
+using namespace CesiumGeospatial;
+using namespace CesiumGltf;
+using namespace CesiumNativeTests;
+
+TEST_CASE("EllipsoidTilesetLoader") {
+  // Every tile is a grid of this many vertices on each side.
+  constexpr size_t resolution = 24;
+
+  AsyncSystem asyncSystem{std::make_shared<SimpleTaskProcessor>()};
+  const Ellipsoid& ellipsoid = Ellipsoid::WGS84;
+  EllipsoidTilesetLoader loader(ellipsoid);
+
+  Tile parent(&loader);
+  parent.setTileID(QuadtreeTileID(1, 2, 1));
+  TileChildrenResult children = loader.createTileChildren(parent);
+  REQUIRE(children.state == TileLoadResultState::Success);
+  REQUIRE(children.children.size() == 4);
+  const Tile& tile = children.children[0];
+
+  TileLoadInput loadInput{
+      tile,
+      {},
+      asyncSystem,
+      nullptr,
+      spdlog::default_logger(),
+      {}};
+  TileLoadResult result = loader.loadTileContent(loadInput).wait();
+  REQUIRE(result.state == TileLoadResultState::Success);
+
+  const Model* pModel = std::get_if<Model>(&result.contentKind);
+  REQUIRE(pModel);
+  REQUIRE(pModel->meshes.size() == 1);
+  REQUIRE(pModel->meshes[0].primitives.size() == 1);
+  const MeshPrimitive& primitive = pModel->meshes[0].primitives[0];
+
+  AccessorView<glm::vec3> positions(
+      *pModel,
+      primitive.attributes.at("POSITION"));
+  AccessorView<glm::vec3> normals(*pModel, primitive.attributes.at("NORMAL"));
+  AccessorView<uint16_t> indices(*pModel, primitive.indices);
+  REQUIRE(positions.status() == AccessorViewStatus::Valid);
+  REQUIRE(normals.status() == AccessorViewStatus::Valid);
+  REQUIRE(indices.status() == AccessorViewStatus::Valid);
+
+  SECTION("vertices and normals lie on the ellipsoid") {
+    REQUIRE(positions.size() == int64_t(resolution * resolution));
+    REQUIRE(normals.size() == positions.size());
+
+    const GlobeRectangle& rectangle =
+        std::get<BoundingRegion>(tile.getBoundingVolume()).getRectangle();
+    const double longitudeStep =
+        rectangle.computeWidth() / double(resolution - 1);
+    const double latitudeStep =
+        rectangle.computeHeight() / double(resolution - 1);
+
+    // Columns go from west to east and rows from north to south.
+    for (size_t x = 0; x < resolution; ++x) {
+      for (size_t y = 0; y < resolution; ++y) {
+        const Cartographic cartographic(
+            rectangle.getWest() + longitudeStep * double(x),
+            rectangle.getNorth() - latitudeStep * double(y));
+        const int64_t index = int64_t(resolution * x + y);
+
+        const glm::dvec3 expectedPosition =
+            ellipsoid.cartographicToCartesian(cartographic);
+        const glm::dvec4 localPosition(glm::dvec3(positions[index]), 1.0);
+        const glm::dvec3 position(tile.getTransform() * localPosition);
+        // The positions are floats relative to the tile's corner.
+        CHECK(glm::distance(position, expectedPosition) < 1.0);
+
+        const glm::dvec3 expectedNormal =
+            ellipsoid.geodeticSurfaceNormal(cartographic);
+        CHECK(
+            glm::distance(glm::dvec3(normals[index]), expectedNormal) < 1e-6);
+      }
+    }
+  }
+
+  SECTION("triangles cover the grid with counter-clockwise winding") {
+    constexpr size_t cells = resolution - 1;
+    REQUIRE(indices.size() == int64_t(cells * cells * 6));
+
+    std::vector<bool> used(resolution * resolution, false);
+    for (int64_t i = 0; i < indices.size(); i += 3) {
+      const uint16_t a = indices[i];
+      const uint16_t b = indices[i + 1];
+      const uint16_t c = indices[i + 2];
+      REQUIRE(a < used.size());
+      REQUIRE(b < used.size());
+      REQUIRE(c < used.size());
+      used[a] = used[b] = used[c] = true;
+
+      // Viewed from outside the ellipsoid, the triangle is counter-clockwise,
+      // so its face normal points the same way as the surface normal.
+      const glm::dvec3 pa(positions[a]);
+      const glm::dvec3 pb(positions[b]);
+      const glm::dvec3 pc(positions[c]);
+      const glm::dvec3 faceNormal = glm::cross(pb - pa, pc - pa);
+      CHECK(glm::dot(faceNormal, glm::dvec3(normals[a])) > 0.0);
+    }
+
+    for (bool isUsed : used) {
+      CHECK(isUsed);
+    }
+  }
+}
@@ -0,0 +1,156 @@
+#include "MockTilesetContentManager.h"
+
+#include <Cesium3DTilesSelection/HeightmapTerrainLoader.h>
+#include <CesiumGeometry/QuadtreeTileID.h>
+#include <CesiumGeospatial/BoundingRegion.h>
+#include <CesiumNativeTests/SimpleAssetAccessor.h>
+#include <CesiumNativeTests/SimpleAssetRequest.h>
+#include <CesiumNativeTests/SimpleAssetResponse.h>
+#include <CesiumNativeTests/SimpleTaskProcessor.h>
+#include <CesiumQuantizedMeshTerrain/HeightmapLoader.h>
+#include <CesiumUtility/Math.h>
+
+#include <catch2/catch.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Cesium3DTilesSelection;
+using namespace CesiumAsync;
+using namespace CesiumGeometry;
+using namespace CesiumGeospatial;
+using namespace CesiumNativeTests;
+using namespace CesiumQuantizedMeshTerrain;
+using namespace CesiumUtility;
+
+namespace {
+// A flat heightmap-1.0 tile at sea level, with the given children.
+std::shared_ptr<SimpleAssetRequest>
+createMockHeightmapRequest(const std::string& url, uint8_t childMask) {
+  std::vector<std::byte> data;
+  for (uint32_t i = 0; i < HeightmapLoader::Width * HeightmapLoader::Width;
+       ++i) {
+    data.emplace_back(std::byte(5000 & 0xFF));
+    data.emplace_back(std::byte(5000 >> 8));
+  }
+  data.emplace_back(std::byte(childMask));
+
+  auto pMockResponse = std::make_unique<SimpleAssetResponse>(
+      static_cast<uint16_t>(200),
+      "doesn't matter",
+      CesiumAsync::HttpHeaders{},
+      std::move(data));
+  return std::make_shared<SimpleAssetRequest>(
+      "GET",
+      url,
+      CesiumAsync::HttpHeaders{},
+      std::move(pMockResponse));
+}
+
+TileLoadResult loadTile(
+    Tile& tile,
+    HeightmapTerrainLoader& loader,
+    AsyncSystem& asyncSystem,
+    const std::shared_ptr<IAssetAccessor>& pAssetAccessor) {
+  TileLoadInput loadInput{
+      tile,
+      {},
+      asyncSystem,
+      pAssetAccessor,
+      spdlog::default_logger(),
+      {}};
+
+  auto tileLoadResultFuture = loader.loadTileContent(loadInput);
+  asyncSystem.dispatchMainThreadTasks();
+  return tileLoadResultFuture.wait();
+}
+} // namespace
+
+TEST_CASE("Test heightmap terrain loader") {
+  std::map<std::string, std::shared_ptr<SimpleAssetRequest>> requests;
+  requests["0/0/0.height"] = createMockHeightmapRequest("0/0/0.height", 0xF);
+  requests["0/1/0.height"] = createMockHeightmapRequest("0/1/0.height", 0x7);
+  auto pMockedAssetAccessor =
+      std::make_shared<SimpleAssetAccessor>(std::move(requests));
+
+  CesiumAsync::AsyncSystem asyncSystem{std::make_shared<SimpleTaskProcessor>()};
+
+  HeightmapTerrainLoader loader("{level}/{x}/{y}.height", 10);
+
+  Tile west(&loader);
+  west.setTileID(QuadtreeTileID(0, 0, 0));
+  west.setGeometricError(1000.0);
+  west.setBoundingVolume(BoundingRegionWithLooseFittingHeights{
+      {GlobeRectangle(-Math::OnePi, -Math::PiOverTwo, 0.0, Math::PiOverTwo),
+       -1000.0,
+       9000.0,
+       Ellipsoid::WGS84}});
+
+  Tile east(&loader);
+  east.setTileID(QuadtreeTileID(0, 1, 0));
+  east.setGeometricError(1000.0);
+  east.setBoundingVolume(BoundingRegionWithLooseFittingHeights{
+      {GlobeRectangle(0.0, -Math::PiOverTwo, Math::OnePi, Math::PiOverTwo),
+       -1000.0,
+       9000.0,
+       Ellipsoid::WGS84}});
+
+  SECTION("Children are only created once the tile is loaded") {
+    MockTilesetContentManagerTestFixture::setTileLoadState(
+        west,
+        TileLoadState::ContentLoading);
+    TileChildrenResult tileChildrenResult = loader.createTileChildren(west);
+    CHECK(tileChildrenResult.state == TileLoadResultState::RetryLater);
+  }
+
+  SECTION("Load tiles and create the children that exist") {
+    TileLoadResult westResult =
+        loadTile(west, loader, asyncSystem, pMockedAssetAccessor);
+    CHECK(westResult.state == TileLoadResultState::Success);
+    CHECK(std::holds_alternative<CesiumGltf::Model>(westResult.contentKind));
+    CHECK(westResult.glTFUpAxis == Axis::Y);
+    REQUIRE(westResult.updatedBoundingVolume);
+    const BoundingRegion& region =
+        std::get<BoundingRegion>(*westResult.updatedBoundingVolume);
+    CHECK(region.getMinimumHeight() == Approx(0.0));
+    CHECK(region.getMaximumHeight() == Approx(0.0));
+
+    TileLoadResult eastResult =
+        loadTile(east, loader, asyncSystem, pMockedAssetAccessor);
+    CHECK(eastResult.state == TileLoadResultState::Success);
+
+    MockTilesetContentManagerTestFixture::setTileLoadState(
+        west,
+        TileLoadState::ContentLoaded);
+    TileChildrenResult westChildren = loader.createTileChildren(west);
+    CHECK(westChildren.state == TileLoadResultState::Success);
+    REQUIRE(westChildren.children.size() == 4);
+    for (const Tile& child : westChildren.children) {
+      CHECK(child.getGeometricError() == Approx(500.0));
+      CHECK(std::get<QuadtreeTileID>(child.getTileID()).level == 1);
+    }
+
+    // The east tile is missing one of its children, so it is a leaf.
+    MockTilesetContentManagerTestFixture::setTileLoadState(
+        east,
+        TileLoadState::ContentLoaded);
+    TileChildrenResult eastChildren = loader.createTileChildren(east);
+    CHECK(eastChildren.state == TileLoadResultState::Success);
+    CHECK(eastChildren.children.empty());
+  }
+
+  SECTION("Tiles at the maximum level have no children") {
+    HeightmapTerrainLoader shallowLoader("{level}/{x}/{y}.height", 0);
+    loadTile(west, shallowLoader, asyncSystem, pMockedAssetAccessor);
+
+    MockTilesetContentManagerTestFixture::setTileLoadState(
+        west,
+        TileLoadState::ContentLoaded);
+    TileChildrenResult children = shallowLoader.createTileChildren(west);
+    CHECK(children.state == TileLoadResultState::Success);
+    CHECK(children.children.empty());
+  }
+}
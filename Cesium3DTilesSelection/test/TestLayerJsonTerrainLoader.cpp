@@ -1,21 +1,33 @@
 #include "LayerJsonTerrainLoader.h"
 #include "MockTilesetContentManager.h"
+#include "RasterOverlayUpsampler.h"
 #include "SimplePrepareRendererResource.h"
 
 #include <Cesium3DTilesContent/registerAllTileContentTypes.h>
 #include <CesiumGeometry/QuadtreeTileID.h>
 #include <CesiumGeospatial/BoundingRegion.h>
+#include <CesiumGltf/AccessorView.h>
+#include <CesiumGltf/AccessorWriter.h>
 #include <CesiumNativeTests/SimpleAssetAccessor.h>
 #include <CesiumNativeTests/SimpleAssetRequest.h>
 #include <CesiumNativeTests/SimpleAssetResponse.h>
 #include <CesiumNativeTests/SimpleTaskProcessor.h>
 #include <CesiumNativeTests/readFile.h>
+#include <CesiumQuantizedMeshTerrain/QuantizedMeshLoader.h>
+#include <CesiumRasterOverlays/RasterOverlayDetails.h>
+#include <CesiumRasterOverlays/RasterOverlayUtilities.h>
 #include <CesiumUtility/Math.h>
 
 #include <catch2/catch.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <glm/mat4x4.hpp>
 
 #include <filesystem>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
 
 using namespace Cesium3DTilesSelection;
 using namespace CesiumGeospatial;
@@ -23,6 +35,7 @@ using namespace CesiumGeometry;
 using namespace CesiumAsync;
 using namespace CesiumUtility;
 using namespace CesiumNativeTests;
+using namespace CesiumRasterOverlays;
 
 namespace {
 std::filesystem::path testDataPath = Cesium3DTilesSelection_TEST_DATA_DIR;
@@ -70,6 +83,25 @@ Future<TileLoadResult> loadTile(
 
   return tileLoadResultFuture;
 }
+
+// Records the headers of each request.
+class HeaderRecordingAssetAccessor : public SimpleAssetAccessor {
+public:
+  HeaderRecordingAssetAccessor(
+      std::map<std::string, std::shared_ptr<SimpleAssetRequest>>&&
+          mockCompletedRequests)
+      : SimpleAssetAccessor(std::move(mockCompletedRequests)) {}
+
+  CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>
+  get(const CesiumAsync::AsyncSystem& asyncSystem,
+      const std::string& url,
+      const std::vector<THeader>& headers) override {
+    this->requestHeaders.emplace_back(headers);
+    return SimpleAssetAccessor::get(asyncSystem, url, headers);
+  }
+
+  std::vector<std::vector<THeader>> requestHeaders;
+};
 } // namespace
 
 TEST_CASE("Test create layer json terrain loader") {
@@ -411,9 +443,7 @@ TEST_CASE("Test load layer json tile content") {
 
   const uint32_t maxZoom = 10;
 
-  CesiumGeometry::QuadtreeRectangleAvailability contentAvailability{
-      tilingScheme,
-      maxZoom};
+  CesiumGeometry::CompactQuadtreeAvailability contentAvailability{tilingScheme};
 
   SECTION("Load tile when layer have availabilityLevels field") {
     // create loader
@@ -522,9 +552,8 @@ TEST_CASE("Test load layer json tile content") {
     // create loader
     std::vector<LayerJsonTerrainLoader::Layer> layers;
 
-    CesiumGeometry::QuadtreeRectangleAvailability layer0ContentAvailability{
-        tilingScheme,
-        maxZoom};
+    CesiumGeometry::CompactQuadtreeAvailability layer0ContentAvailability{
+        tilingScheme};
     layer0ContentAvailability.addAvailableTileRange({0, 0, 0, 1, 0});
     layer0ContentAvailability.addAvailableTileRange({1, 0, 0, 1, 0});
     layer0ContentAvailability.addAvailableTileRange({2, 0, 0, 1, 1});
@@ -537,9 +566,8 @@ TEST_CASE("Test load layer json tile content") {
         maxZoom,
         -1);
 
-    CesiumGeometry::QuadtreeRectangleAvailability layer1ContentAvailability{
-        tilingScheme,
-        maxZoom};
+    CesiumGeometry::CompactQuadtreeAvailability layer1ContentAvailability{
+        tilingScheme};
     layer1ContentAvailability.addAvailableTileRange({0, 0, 0, 1, 0});
     layer1ContentAvailability.addAvailableTileRange({1, 0, 0, 1, 1});
     layer1ContentAvailability.addAvailableTileRange({2, 0, 0, 3, 3});
@@ -602,9 +630,8 @@ TEST_CASE("Test load layer json tile content") {
     // create loader
     std::vector<LayerJsonTerrainLoader::Layer> layers;
 
-    CesiumGeometry::QuadtreeRectangleAvailability layer0ContentAvailability{
-        tilingScheme,
-        maxZoom};
+    CesiumGeometry::CompactQuadtreeAvailability layer0ContentAvailability{
+        tilingScheme};
     layers.emplace_back(
         "layer.json",
         "1.0.0",
@@ -613,9 +640,8 @@ TEST_CASE("Test load layer json tile content") {
         maxZoom,
         10);
 
-    CesiumGeometry::QuadtreeRectangleAvailability layer1ContentAvailability{
-        tilingScheme,
-        maxZoom};
+    CesiumGeometry::CompactQuadtreeAvailability layer1ContentAvailability{
+        tilingScheme};
     layers.emplace_back(
         "layer.json",
         "1.0.0",
@@ -704,9 +730,8 @@ TEST_CASE("Test creating tile children for layer json") {
   // create loader
   std::vector<LayerJsonTerrainLoader::Layer> layers;
 
-  CesiumGeometry::QuadtreeRectangleAvailability layer0ContentAvailability{
-      tilingScheme,
-      maxZoom};
+  CesiumGeometry::CompactQuadtreeAvailability layer0ContentAvailability{
+      tilingScheme};
   layer0ContentAvailability.addAvailableTileRange({0, 0, 0, 1, 0});
   layer0ContentAvailability.addAvailableTileRange({1, 0, 0, 1, 0});
   layer0ContentAvailability.addAvailableTileRange({2, 0, 0, 1, 1});
@@ -720,9 +745,8 @@ TEST_CASE("Test creating tile children for layer json") {
       10);
   layers.back().loadedSubtrees[0].insert(0);
 
-  CesiumGeometry::QuadtreeRectangleAvailability layer1ContentAvailability{
-      tilingScheme,
-      maxZoom};
+  CesiumGeometry::CompactQuadtreeAvailability layer1ContentAvailability{
+      tilingScheme};
   layer1ContentAvailability.addAvailableTileRange({0, 0, 0, 1, 0});
   layer1ContentAvailability.addAvailableTileRange({1, 0, 0, 1, 1});
   layer1ContentAvailability.addAvailableTileRange({2, 0, 0, 1, 3});
@@ -944,3 +968,259 @@ TEST_CASE("Test creating tile children for layer json") {
     CHECK(upsampleID_2_3_1.tileID == QuadtreeTileID(2, 3, 1));
   }
 }
+
+TEST_CASE("Test sampling heights with layer json terrain loader") {
+  auto pMockedAssetAccessor = std::make_shared<SimpleAssetAccessor>(
+      std::map<std::string, std::shared_ptr<SimpleAssetRequest>>{});
+
+  CesiumAsync::AsyncSystem asyncSystem{std::make_shared<SimpleTaskProcessor>()};
+
+  GeographicProjection projection(Ellipsoid::WGS84);
+  auto quadtreeRectangleProjected =
+      projection.project(GeographicProjection::MAXIMUM_GLOBE_RECTANGLE);
+
+  QuadtreeTilingScheme tilingScheme{quadtreeRectangleProjected, 2, 1};
+
+  const uint32_t maxZoom = 10;
+
+  CesiumGeometry::CompactQuadtreeAvailability contentAvailability{tilingScheme};
+  contentAvailability.addAvailableTileRange(
+      QuadtreeTileRectangularRange{0, 0, 0, 1, 0});
+
+  std::vector<LayerJsonTerrainLoader::Layer> layers;
+  layers.emplace_back(
+      "layer.json",
+      "1.0.0",
+      std::vector<std::string>{"{level}.{x}.{y}/{version}.terrain"},
+      std::move(contentAvailability),
+      maxZoom,
+      -1);
+
+  SECTION("Loader without an asset accessor does not sample heights") {
+    LayerJsonTerrainLoader loader{tilingScheme, projection, std::move(layers)};
+    CHECK(loader.getHeightSampler() == nullptr);
+  }
+
+  SECTION("Sample heights directly from the most detailed tiles") {
+    LayerJsonTerrainLoader loader{
+        tilingScheme,
+        projection,
+        std::move(layers),
+        pMockedAssetAccessor};
+    REQUIRE(loader.getHeightSampler() == &loader);
+
+    const std::filesystem::path tilePath =
+        testDataPath / "CesiumTerrainTileJson" / "tile.terrain";
+    pMockedAssetAccessor->mockCompletedRequests.insert(
+        {"0.0.0/1.0.0.terrain", createMockAssetRequest(tilePath)});
+    pMockedAssetAccessor->mockCompletedRequests.insert(
+        {"0.1.0/1.0.0.terrain",
+         std::make_shared<SimpleAssetRequest>(
+             "GET",
+             "0.1.0/1.0.0.terrain",
+             CesiumAsync::HttpHeaders{},
+             std::make_unique<SimpleAssetResponse>(
+                 static_cast<uint16_t>(404),
+                 "doesn't matter",
+                 CesiumAsync::HttpHeaders{},
+                 std::vector<std::byte>()))});
+
+    SampleHeightResult result =
+        loader
+            .sampleHeights(
+                asyncSystem,
+                {Cartographic::fromDegrees(-90.0, 10.0),
+                 Cartographic::fromDegrees(-120.0, -45.0),
+                 Cartographic::fromDegrees(90.0, 10.0, 123.0)})
+            .waitInMainThread();
+
+    // The heights must lie within the range of heights of the tile.
+    std::vector<std::byte> tileData = readFile(tilePath);
+    const BoundingRegion tileRegion(
+        GlobeRectangle(-Math::OnePi, -Math::PiOverTwo, 0.0, Math::PiOverTwo),
+        -1000.0,
+        9000.0,
+        Ellipsoid::WGS84);
+    CesiumQuantizedMeshTerrain::QuantizedMeshLoadResult loadResult =
+        CesiumQuantizedMeshTerrain::QuantizedMeshLoader::load(
+            QuadtreeTileID(0, 0, 0),
+            tileRegion,
+            "url",
+            tileData,
+            false);
+    REQUIRE(loadResult.updatedBoundingVolume);
+    const double minimumHeight =
+        loadResult.updatedBoundingVolume->getMinimumHeight();
+    const double maximumHeight =
+        loadResult.updatedBoundingVolume->getMaximumHeight();
+
+    REQUIRE(result.positions.size() == 3);
+    REQUIRE(result.sampleSuccess.size() == 3);
+    for (size_t i = 0; i < 2; ++i) {
+      CHECK(result.sampleSuccess[i]);
+      CHECK(result.positions[i].height >= minimumHeight);
+      CHECK(result.positions[i].height <= maximumHeight);
+    }
+
+    // The tile in the eastern hemisphere failed to load, so the height there
+    // is left unchanged.
+    CHECK(!result.sampleSuccess[2]);
+    CHECK(result.positions[2].height == 123.0);
+    CHECK(!result.warnings.empty());
+  }
+
+  SECTION("Sample heights with the given request headers") {
+    auto pRecordingAssetAccessor =
+        std::make_shared<HeaderRecordingAssetAccessor>(
+            std::map<std::string, std::shared_ptr<SimpleAssetRequest>>{
+                {"0.0.0/1.0.0.terrain",
+                 createMockAssetRequest(
+                     testDataPath / "CesiumTerrainTileJson" /
+                     "tile.terrain")}});
+    LayerJsonTerrainLoader loader{
+        tilingScheme,
+        projection,
+        std::move(layers),
+        pRecordingAssetAccessor};
+
+    const std::vector<IAssetAccessor::THeader> headers{
+        {"Authorization", "Bearer token"}};
+    SampleHeightResult result =
+        loader
+            .sampleHeightsWithHeaders(
+                asyncSystem,
+                {Cartographic::fromDegrees(-90.0, 10.0)},
+                headers)
+            .waitInMainThread();
+    REQUIRE(result.sampleSuccess.size() == 1);
+    CHECK(result.sampleSuccess[0]);
+
+    REQUIRE(pRecordingAssetAccessor->requestHeaders.size() == 1);
+    CHECK(pRecordingAssetAccessor->requestHeaders[0] == headers);
+  }
+}
+
+TEST_CASE("Test upsampling terrain with parent height offsets") {
+  CesiumAsync::AsyncSystem asyncSystem{std::make_shared<SimpleTaskProcessor>()};
+
+  GeographicProjection projection(Ellipsoid::WGS84);
+  QuadtreeTilingScheme tilingScheme{
+      projection.project(GeographicProjection::MAXIMUM_GLOBE_RECTANGLE),
+      2,
+      1};
+  LayerJsonTerrainLoader loader{tilingScheme, projection, {}};
+
+  // Load a parent tile with parent height offsets of its own.
+  const BoundingRegion tileRegion(
+      GlobeRectangle(-Math::OnePi, -Math::PiOverTwo, 0.0, Math::PiOverTwo),
+      -1000.0,
+      9000.0,
+      Ellipsoid::WGS84);
+  std::vector<std::byte> tileData =
+      readFile(testDataPath / "CesiumTerrainTileJson" / "tile.terrain");
+  CesiumQuantizedMeshTerrain::QuantizedMeshLoadResult loadResult =
+      CesiumQuantizedMeshTerrain::QuantizedMeshLoader::load(
+          QuadtreeTileID(0, 0, 0),
+          tileRegion,
+          "url",
+          tileData,
+          false,
+          Ellipsoid::WGS84,
+          true);
+  REQUIRE(loadResult.model);
+  CesiumGltf::Model& parentModel = *loadResult.model;
+
+  const std::string offsetName(CesiumQuantizedMeshTerrain::QuantizedMeshLoader::
+                                   PARENT_HEIGHT_OFFSET_ATTRIBUTE_NAME);
+  const CesiumGltf::MeshPrimitive& parentPrimitive =
+      parentModel.meshes[0].primitives[0];
+  REQUIRE(parentPrimitive.attributes.contains(offsetName));
+
+  // Make the parent's offsets non-zero everywhere, so that interpolating
+  // them would leave non-zero offsets in the children.
+  CesiumGltf::AccessorWriter<float> parentOffsets(
+      parentModel,
+      parentPrimitive.attributes.at(offsetName));
+  REQUIRE(parentOffsets.status() == CesiumGltf::AccessorViewStatus::Valid);
+  for (int64_t i = 0; i < parentOffsets.size(); ++i) {
+    parentOffsets[i] = 10.0f;
+  }
+
+  std::optional<RasterOverlayDetails> overlayDetails =
+      RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
+          parentModel,
+          glm::dmat4(1.0),
+          tileRegion.getRectangle(),
+          {projection});
+  REQUIRE(overlayDetails);
+
+  Tile parent(&loader);
+  parent.setTileID(QuadtreeTileID(0, 0, 0));
+  parent.setBoundingVolume(tileRegion);
+  auto pRenderContent =
+      std::make_unique<TileRenderContent>(std::move(parentModel));
+  pRenderContent->setRasterOverlayDetails(std::move(*overlayDetails));
+  parent.getContent().setContentKind(std::move(pRenderContent));
+  MockTilesetContentManagerTestFixture::setTileLoadState(
+      parent,
+      TileLoadState::Done);
+
+  const auto checkChildOffsets = [&](Tile& child) {
+    TileLoadInput loadInput{
+        child,
+        {},
+        asyncSystem,
+        nullptr,
+        spdlog::default_logger(),
+        {}};
+    Future<TileLoadResult> future =
+        child.getLoader()->loadTileContent(loadInput);
+    asyncSystem.dispatchMainThreadTasks();
+    TileLoadResult result = future.wait();
+    REQUIRE(result.state == TileLoadResultState::Success);
+
+    const CesiumGltf::Model& model =
+        std::get<CesiumGltf::Model>(result.contentKind);
+    const CesiumGltf::MeshPrimitive& primitive =
+        model.meshes[0].primitives[0];
+    REQUIRE(primitive.attributes.contains(offsetName));
+
+    // An upsampled tile has exactly its parent's surface.
+    CesiumGltf::AccessorView<float> offsets(
+        model,
+        primitive.attributes.at(offsetName));
+    REQUIRE(offsets.status() == CesiumGltf::AccessorViewStatus::Valid);
+    REQUIRE(offsets.size() > 0);
+    for (int64_t i = 0; i < offsets.size(); ++i) {
+      CHECK(offsets[i] == 0.0f);
+    }
+  };
+
+  SECTION("The terrain loader clears the offsets of upsampled tiles") {
+    std::vector<Tile> children;
+    children.emplace_back(&loader);
+    children.back().setTileID(UpsampledQuadtreeNode{QuadtreeTileID(1, 0, 0)});
+    parent.createChildTiles(std::move(children));
+
+    checkChildOffsets(parent.getChildren()[0]);
+  }
+
+  SECTION("The raster overlay upsampler clears the offsets of upsampled "
+          "tiles") {
+    RasterOverlayUpsampler upsampler;
+    std::vector<Tile> children;
+    for (const QuadtreeTileID& childID :
+         {QuadtreeTileID(1, 0, 0),
+          QuadtreeTileID(1, 1, 0),
+          QuadtreeTileID(1, 0, 1),
+          QuadtreeTileID(1, 1, 1)}) {
+      children.emplace_back(&upsampler);
+      children.back().setTileID(UpsampledQuadtreeNode{childID});
+    }
+    parent.createChildTiles(std::move(children));
+
+    for (Tile& child : parent.getChildren()) {
+      checkChildOffsets(child);
+    }
+  }
+}
@@ -11,6 +11,7 @@
 #include <CesiumGeospatial/Cartographic.h>
 #include <CesiumGltf/AccessorView.h>
 #include <CesiumGltf/AccessorWriter.h>
+#include <CesiumGltf/ExtensionKhrDracoMeshCompression.h>
 #include <CesiumGltfReader/GltfReader.h>
 #include <CesiumNativeTests/SimpleAssetAccessor.h>
 #include <CesiumNativeTests/SimpleAssetRequest.h>
@@ -24,8 +25,13 @@
 #include <catch2/catch.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <glm/glm.hpp>
+#include <spdlog/sinks/ringbuffer_sink.h>
+#include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <filesystem>
+#include <memory>
+#include <string>
 #include <vector>
 
 using namespace Cesium3DTilesSelection;
@@ -1641,6 +1647,78 @@ TEST_CASE("Test the tileset content manager's post processing for gltf") {
     pManager->unloadTileContent(tile);
   }
 
+  SECTION("Warn when raster overlays cannot drape undecoded primitives") {
+    // create a gltf grid whose primitive is still marked as Draco-compressed
+    Cartographic beginCarto{glm::radians(32.0), glm::radians(48.0), 100.0};
+    CesiumGltf::Model model = createGlobeGrid(beginCarto, 10, 10, 0.01);
+    model.meshes.front()
+        .primitives.front()
+        .addExtension<CesiumGltf::ExtensionKhrDracoMeshCompression>();
+
+    // add raster overlay
+    Tile::LoadedLinkedList loadedTiles;
+    RasterOverlayCollection rasterOverlayCollection{loadedTiles, externals};
+    rasterOverlayCollection.add(
+        new DebugColorizeTilesRasterOverlay("DebugOverlay"));
+    asyncSystem.dispatchMainThreadTasks();
+
+    // create mock loader
+    auto pMockedLoader = std::make_unique<SimpleTilesetContentLoader>();
+    pMockedLoader->mockLoadTileContent = {
+        std::move(model),
+        CesiumGeometry::Axis::Z,
+        std::nullopt,
+        std::nullopt,
+        std::nullopt,
+        nullptr,
+        nullptr,
+        {},
+        TileLoadResultState::Success,
+        Ellipsoid::WGS84};
+    pMockedLoader->mockCreateTileChildren = {{}, TileLoadResultState::Failed};
+
+    // create tile
+    auto pRootTile = std::make_unique<Tile>(pMockedLoader.get());
+
+    // create manager with a logger that records its messages
+    auto pLog = std::make_shared<spdlog::sinks::ringbuffer_sink_mt>(3);
+    TilesetExternals loggingExternals = externals;
+    loggingExternals.pLogger =
+        std::make_shared<spdlog::logger>("undecoded", pLog);
+    IntrusivePointer<TilesetContentManager> pManager =
+        new TilesetContentManager{
+            loggingExternals,
+            {},
+            std::move(rasterOverlayCollection),
+            {},
+            std::move(pMockedLoader),
+            std::move(pRootTile)};
+
+    Tile& tile = *pManager->getRootTile();
+    pManager->loadTileContent(tile, {});
+    pManager->waitUntilIdle();
+
+    const TileRenderContent* pRenderContent =
+        tile.getContent().getRenderContent();
+    REQUIRE(pRenderContent);
+    const CesiumGltf::MeshPrimitive& primitive =
+        pRenderContent->getModel().meshes.front().primitives.front();
+    CHECK(
+        primitive.attributes.find("_CESIUMOVERLAY_0") ==
+        primitive.attributes.end());
+
+    std::vector<std::string> logMessages = pLog->last_formatted();
+    CHECK(std::any_of(
+        logMessages.begin(),
+        logMessages.end(),
+        [](const std::string& message) {
+          return message.find("raster overlays will not be draped") !=
+                 std::string::npos;
+        }));
+
+    pManager->unloadTileContent(tile);
+  }
+
   SECTION("Resolve external images, with deduplication") {
     std::filesystem::path dirPath(testDataPath / "SharedImages");
 
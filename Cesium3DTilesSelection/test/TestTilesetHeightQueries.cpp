@@ -2,6 +2,7 @@
 #include <Cesium3DTilesSelection/EllipsoidTilesetLoader.h>
 #include <Cesium3DTilesSelection/Tileset.h>
 #include <CesiumGeospatial/Cartographic.h>
+#include <CesiumGltfContent/GltfTriangleBvh.h>
 #include <CesiumNativeTests/FileAccessor.h>
 #include <CesiumNativeTests/SimpleTaskProcessor.h>
 #include <CesiumUtility/StringHelpers.h>
@@ -10,6 +11,7 @@
 #include <catch2/catch.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include <cstdint>
 #include <filesystem>
 
 using namespace Cesium3DTilesContent;
@@ -80,6 +82,163 @@ TEST_CASE("Tileset height queries") {
         Math::Epsilon4));
   }
 
+  SECTION("Many positions in one request") {
+    std::string url =
+        "file://" +
+        Uri::nativePathToUriPath(StringHelpers::toStringUtf8(
+            (testDataPath / "Tileset" / "tileset.json").u8string()));
+
+    Tileset tileset(externals, url);
+
+    // Queries are intersected with each tile together, so interleave points
+    // on different tiles to make sure each gets its own result.
+    std::vector<Cartographic> positions;
+    for (size_t i = 0; i < 100; ++i) {
+      positions.emplace_back(
+          Cartographic::fromDegrees(-75.612088, 40.042526, 0.0));
+      positions.emplace_back(
+          Cartographic::fromDegrees(-75.612025, 40.041684, 0.0));
+    }
+
+    Future<SampleHeightResult> future =
+        tileset.sampleHeightMostDetailed(positions);
+
+    while (!future.isReady()) {
+      tileset.updateView({});
+    }
+
+    SampleHeightResult results = future.waitInMainThread();
+    CHECK(results.warnings.empty());
+    REQUIRE(results.positions.size() == positions.size());
+
+    for (size_t i = 0; i < positions.size(); i += 2) {
+      CHECK(results.sampleSuccess[i]);
+      CHECK(Math::equalsEpsilon(
+          results.positions[i].height,
+          78.155809,
+          0.0,
+          Math::Epsilon4));
+
+      CHECK(results.sampleSuccess[i + 1]);
+      CHECK(Math::equalsEpsilon(
+          results.positions[i + 1].height,
+          7.837332,
+          0.0,
+          Math::Epsilon4));
+    }
+  }
+
+  SECTION("Triangle hierarchies built while loading") {
+    std::string url =
+        "file://" +
+        Uri::nativePathToUriPath(StringHelpers::toStringUtf8(
+            (testDataPath / "Tileset" / "tileset.json").u8string()));
+
+    TilesetOptions options;
+    options.contentOptions.enableHeightQueryTriangleBvh = true;
+    Tileset tileset(externals, url, options);
+
+    Future<SampleHeightResult> future = tileset.sampleHeightMostDetailed(
+        {Cartographic::fromDegrees(-75.612088, 40.042526, 0.0),
+         Cartographic::fromDegrees(-75.612025, 40.041684, 0.0)});
+
+    while (!future.isReady()) {
+      tileset.updateView({});
+    }
+
+    SampleHeightResult results = future.waitInMainThread();
+    CHECK(results.warnings.empty());
+    REQUIRE(results.positions.size() == 2);
+    CHECK(results.sampleSuccess[0]);
+    CHECK(Math::equalsEpsilon(
+        results.positions[0].height,
+        78.155809,
+        0.0,
+        Math::Epsilon4));
+    CHECK(results.sampleSuccess[1]);
+    CHECK(Math::equalsEpsilon(
+        results.positions[1].height,
+        7.837332,
+        0.0,
+        Math::Epsilon4));
+
+    // Every loaded tile has its hierarchy, and its memory is counted.
+    int64_t triangleBvhBytes = 0;
+    tileset.forEachLoadedTile([&triangleBvhBytes](const Tile& tile) {
+      const TileRenderContent* pRenderContent =
+          tile.getContent().getRenderContent();
+      if (pRenderContent) {
+        REQUIRE(pRenderContent->getTriangleBvh() != nullptr);
+        triangleBvhBytes += pRenderContent->getTriangleBvh()->getSizeBytes();
+      }
+    });
+    CHECK(triangleBvhBytes > 0);
+    CHECK(tileset.getTotalDataBytes() >= triangleBvhBytes);
+  }
+
+  SECTION("Current detail from already-loaded tiles") {
+    std::string url =
+        "file://" +
+        Uri::nativePathToUriPath(StringHelpers::toStringUtf8(
+            (testDataPath / "Tileset" / "tileset.json").u8string()));
+
+    Tileset tileset(externals, url);
+
+    std::vector<Cartographic> positions{
+        // A point on geometry in "parent.b3dm".
+        Cartographic::fromDegrees(-75.612088, 40.042526, 0.0),
+
+        // A point on geometry in a leaf tile.
+        Cartographic::fromDegrees(-75.612025, 40.041684, 0.0)};
+
+    // Nothing is loaded yet, so no heights can be sampled.
+    SampleHeightResult before = tileset.sampleHeightCurrentDetail(positions);
+    REQUIRE(before.sampleSuccess.size() == 2);
+    CHECK(!before.sampleSuccess[0]);
+    CHECK(!before.sampleSuccess[1]);
+    CHECK(before.geometricErrors == std::vector<double>{-1.0, -1.0});
+
+    // Loading the most detailed tiles makes them available to the
+    // synchronous query.
+    Future<SampleHeightResult> future =
+        tileset.sampleHeightMostDetailed(positions);
+    while (!future.isReady()) {
+      tileset.updateView({});
+    }
+    future.waitInMainThread();
+
+    SampleHeightResult results = tileset.sampleHeightCurrentDetail(positions);
+    CHECK(results.warnings.empty());
+    REQUIRE(results.positions.size() == 2);
+    REQUIRE(results.geometricErrors.size() == 2);
+
+    CHECK(results.sampleSuccess[0]);
+    CHECK(Math::equalsEpsilon(
+        results.positions[0].height,
+        78.155809,
+        0.0,
+        Math::Epsilon4));
+    CHECK(results.geometricErrors[0] == 70.0);
+
+    CHECK(results.sampleSuccess[1]);
+    CHECK(Math::equalsEpsilon(
+        results.positions[1].height,
+        7.837332,
+        0.0,
+        Math::Epsilon4));
+    CHECK(results.geometricErrors[1] == 0.0);
+
+    // Without the option, sampling tests every triangle rather than building
+    // a hierarchy on the main thread.
+    tileset.forEachLoadedTile([](const Tile& tile) {
+      const TileRenderContent* pRenderContent =
+          tile.getContent().getRenderContent();
+      if (pRenderContent) {
+        CHECK(pRenderContent->getTriangleBvh() == nullptr);
+      }
+    });
+  }
+
   SECTION("Replace-refined tileset") {
     std::string url =
         "file://" +
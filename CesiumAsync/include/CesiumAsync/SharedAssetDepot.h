@@ -95,6 +95,18 @@ public:
       const std::shared_ptr<IAssetAccessor>& pAssetAccessor,
       const TAssetKey& assetKey);
 
+  /**
+   * @brief Determines if this depot holds a successfully loaded asset with the
+   * given key, without creating it if it does not.
+   *
+   * The asset may be active or inactive. Assets that are still loading or that
+   * failed to load are not considered loaded.
+   *
+   * @param assetKey The key uniquely identifying the asset.
+   * @return True if the asset is loaded.
+   */
+  bool isLoaded(const TAssetKey& assetKey) const;
+
   /**
    * @brief Returns the total number of distinct assets contained in this depot,
    * including both active and inactive assets.
@@ -401,6 +413,15 @@ SharedAssetDepot<TAssetType, TAssetKey>::getOrCreate(
   return sharedFuture;
 }
 
+template <typename TAssetType, typename TAssetKey>
+bool SharedAssetDepot<TAssetType, TAssetKey>::isLoaded(
+    const TAssetKey& assetKey) const {
+  LockHolder lock = this->lock();
+  auto it = this->_assets.find(assetKey);
+  return it != this->_assets.end() && !it->second->maybePendingAsset &&
+         it->second->pAsset != nullptr;
+}
+
 template <typename TAssetType, typename TAssetKey>
 size_t SharedAssetDepot<TAssetType, TAssetKey>::getAssetCount() const {
   LockHolder lock = this->lock();
@@ -60,6 +60,39 @@ TEST_CASE("SharedAssetDepot") {
     CHECK(assetOne.pValue == assetTwo.pValue);
   }
 
+  SECTION("isLoaded is only true for assets that loaded successfully") {
+    IntrusivePointer<SharedAssetDepot<TestAsset, std::string>> pDepot =
+        new SharedAssetDepot<TestAsset, std::string>(
+            [](const AsyncSystem& asyncSystem,
+               const std::shared_ptr<IAssetAccessor>& /* pAssetAccessor */,
+               const std::string& assetKey) {
+              if (assetKey == "bad") {
+                return asyncSystem.createResolvedFuture(
+                    ResultPointer<TestAsset>(ErrorList::error("failed")));
+              }
+
+              IntrusivePointer<TestAsset> p = new TestAsset();
+              p->someValue = assetKey;
+              return asyncSystem.createResolvedFuture(
+                  ResultPointer<TestAsset>(p));
+            });
+
+    CHECK(!pDepot->isLoaded("one"));
+
+    ResultPointer<TestAsset> assetOne =
+        pDepot->getOrCreate(asyncSystem, nullptr, "one").waitInMainThread();
+    CHECK(pDepot->isLoaded("one"));
+
+    // Inactive assets are still loaded.
+    assetOne.pValue.reset();
+    CHECK(pDepot->isLoaded("one"));
+
+    ResultPointer<TestAsset> bad =
+        pDepot->getOrCreate(asyncSystem, nullptr, "bad").waitInMainThread();
+    CHECK(bad.pValue == nullptr);
+    CHECK(!pDepot->isLoaded("bad"));
+  }
+
   SECTION("unreferenced assets become inactive") {
     auto pDepot = createDepot();
 
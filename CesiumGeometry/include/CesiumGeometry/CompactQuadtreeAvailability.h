@@ -0,0 +1,164 @@
+#pragma once
+
+#include "Library.h"
+#include "QuadtreeTileID.h"
+#include "QuadtreeTileRectangularRange.h"
+#include "QuadtreeTilingScheme.h"
+#include "Rectangle.h"
+
+#include <glm/vec2.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace CesiumGeometry {
+
+/**
+ * @brief Manages information about the availability of tiles in a quadtree,
+ * given as rectangular ranges of available tiles.
+ *
+ * This answers the same queries as {@link QuadtreeRectangleAvailability}, but
+ * much faster and in much less memory. Rather than keeping the rectangles of
+ * tiles in a tree of heap-allocated nodes, it keeps the resulting maximum
+ * available level over the quadtree. The nodes are stored in flat arrays, with
+ * the four children of each node stored consecutively in Morton order, so a
+ * tile is found by following the bits of its coordinates without any
+ * floating-point tests. A node whose whole area has the same maximum level
+ * has no children, so large ranges of available tiles take very little space.
+ *
+ * It can also keep the availability of several layers over the same tiling
+ * scheme, such as the stacked layers of a layer.json terrain. The maximum
+ * level of each layer is stored in each node, so a single descent finds the
+ * first layer in which a tile is available.
+ *
+ * As with {@link QuadtreeRectangleAvailability}, a tile is assumed to be
+ * available when any of its descendants is available.
+ */
+class CESIUMGEOMETRY_API CompactQuadtreeAvailability final {
+public:
+  /**
+   * @brief Creates a new instance.
+   *
+   * @param tilingScheme The {@link QuadtreeTilingScheme}.
+   * @param layerCount The number of layers whose availability is kept.
+   */
+  explicit CompactQuadtreeAvailability(
+      const QuadtreeTilingScheme& tilingScheme,
+      uint32_t layerCount = 1) noexcept;
+
+  /**
+   * @brief Adds the specified range to the set of available tiles.
+   *
+   * @param range The {@link QuadtreeTileRectangularRange} that describes
+   * the range of available tiles. Its level must be at most 32.
+   * @param layer The layer in which the tiles are available.
+   */
+  void addAvailableTileRange(
+      const QuadtreeTileRectangularRange& range,
+      uint32_t layer = 0) noexcept;
+
+  /**
+   * @brief Adds the tiles that are available in another instance to the set
+   * of available tiles.
+   *
+   * @param other The other instance, which must use the same tiling scheme. A
+   * tile that is available in any of its layers is added.
+   * @param layer The layer in which the tiles are available.
+   */
+  void addAvailability(
+      const CompactQuadtreeAvailability& other,
+      uint32_t layer = 0) noexcept;
+
+  /**
+   * @brief Computes the maximum level for the given 2D position.
+   *
+   * This will compute the maximum level of any available tile, in any layer,
+   * for the given position. The position refers to the 2D space that
+   * is covered by the nodes of the quadtree.
+   *
+   * @param position The 2D position.
+   * @return The maximum level at the given position. This may be 0 if
+   * the position is not covered by the quadtree at all.
+   */
+  uint32_t
+  computeMaximumLevelAtPosition(const glm::dvec2& position) const noexcept;
+
+  /**
+   * @brief Returns whether a certain tile is available in any layer.
+   *
+   * This checks the availability of the tile that is described by the
+   * given {@link QuadtreeTileID}, which consists of the level and
+   * the x- and y- coordinates of the queried tile. It takes at most one step
+   * for each level of the tile.
+   *
+   * @param id The quadtree tile ID.
+   * @returns The {@link CesiumGeometry::TileAvailabilityFlags} for this tile,
+   * encoded into an uint8_t.
+   */
+  uint8_t isTileAvailable(const QuadtreeTileID& id) const noexcept;
+
+  /**
+   * @brief Finds the first layer in which a certain tile is available.
+   *
+   * This takes the same steps as {@link isTileAvailable}, no matter how many
+   * layers there are.
+   *
+   * @param id The quadtree tile ID.
+   * @returns The index of the first layer in which the tile is available, or
+   * `std::nullopt` if it is not available in any layer.
+   */
+  std::optional<uint32_t>
+  findFirstAvailableLayer(const QuadtreeTileID& id) const noexcept;
+
+  /**
+   * @brief Gets the number of layers whose availability is kept.
+   */
+  uint32_t getLayerCount() const noexcept { return this->_layerCount; }
+
+  /**
+   * @brief Gets the number of bytes of memory used by this instance.
+   */
+  int64_t getSizeBytes() const noexcept;
+
+private:
+  static constexpr uint32_t NoChildren = 0;
+
+  std::optional<uint32_t> findNode(const QuadtreeTileID& id) const noexcept;
+  uint8_t getNodeMaxLevel(uint32_t node) const noexcept;
+  uint32_t createChildren(uint32_t node);
+  void addRangeToNode(
+      uint32_t node,
+      const QuadtreeTileID& nodeID,
+      const QuadtreeTileRectangularRange& range,
+      uint32_t layer,
+      uint8_t level);
+  void addNodeFrom(
+      uint32_t node,
+      const CompactQuadtreeAvailability& other,
+      uint32_t otherNode,
+      uint32_t layer);
+  void raiseNodeLevel(uint32_t node, uint32_t layer, uint8_t level);
+  void updateFromChildren(uint32_t node);
+  uint32_t findMaxLevelFromNode(
+      uint32_t node,
+      const Rectangle& extent,
+      const glm::dvec2& position) const noexcept;
+
+  QuadtreeTilingScheme _tilingScheme;
+  uint32_t _layerCount;
+
+  // The root tiles are nodes 0 to n-1. For each node, the index of its first
+  // child, or NoChildren. The other three children follow the first one.
+  std::vector<uint32_t> _firstChild;
+
+  // For each node and layer, at index node * _layerCount + layer. For a node
+  // without children, the maximum available level anywhere in the node. For a
+  // node with children, the largest level of any of its children.
+  std::vector<uint8_t> _maxLevel;
+
+  // The first nodes of blocks of four children that are no longer used.
+  std::vector<uint32_t> _freeChildren;
+};
+
+} // namespace CesiumGeometry
@@ -0,0 +1,350 @@
+#include "CesiumGeometry/CompactQuadtreeAvailability.h"
+
+#include "CesiumGeometry/TileAvailabilityFlags.h"
+
+#include <CesiumUtility/Assert.h>
+
+#include <glm/common.hpp>
+
+#include <algorithm>
+
+namespace CesiumGeometry {
+
+CompactQuadtreeAvailability::CompactQuadtreeAvailability(
+    const QuadtreeTilingScheme& tilingScheme,
+    uint32_t layerCount) noexcept
+    : _tilingScheme(tilingScheme),
+      _layerCount(layerCount),
+      _firstChild(
+          size_t(tilingScheme.getRootTilesX()) * tilingScheme.getRootTilesY(),
+          NoChildren),
+      _maxLevel(this->_firstChild.size() * layerCount, 0),
+      _freeChildren() {}
+
+void CompactQuadtreeAvailability::addAvailableTileRange(
+    const QuadtreeTileRectangularRange& range,
+    uint32_t layer) noexcept {
+  CESIUM_ASSERT(range.level <= 32);
+  CESIUM_ASSERT(layer < this->_layerCount);
+  const uint8_t level = static_cast<uint8_t>(range.level);
+
+  // Find the root tiles that the range overlaps.
+  const uint32_t rootTilesX = this->_tilingScheme.getRootTilesX();
+  const uint32_t rootTilesY = this->_tilingScheme.getRootTilesY();
+  const uint32_t minRootX = range.minimumX >> range.level;
+  const uint32_t minRootY = range.minimumY >> range.level;
+  const uint32_t maxRootX =
+      std::min(range.maximumX >> range.level, rootTilesX - 1);
+  const uint32_t maxRootY =
+      std::min(range.maximumY >> range.level, rootTilesY - 1);
+
+  for (uint32_t y = minRootY; y <= maxRootY; ++y) {
+    for (uint32_t x = minRootX; x <= maxRootX; ++x) {
+      this->addRangeToNode(
+          y * rootTilesX + x,
+          QuadtreeTileID(0, x, y),
+          range,
+          layer,
+          level);
+    }
+  }
+}
+
+void CompactQuadtreeAvailability::addAvailability(
+    const CompactQuadtreeAvailability& other,
+    uint32_t layer) noexcept {
+  CESIUM_ASSERT(layer < this->_layerCount);
+  CESIUM_ASSERT(
+      other._tilingScheme.getRootTilesX() ==
+          this->_tilingScheme.getRootTilesX() &&
+      other._tilingScheme.getRootTilesY() ==
+          this->_tilingScheme.getRootTilesY());
+
+  const uint32_t rootCount = this->_tilingScheme.getRootTilesX() *
+                             this->_tilingScheme.getRootTilesY();
+  for (uint32_t root = 0; root < rootCount; ++root) {
+    this->addNodeFrom(root, other, root, layer);
+  }
+}
+
+uint32_t CompactQuadtreeAvailability::computeMaximumLevelAtPosition(
+    const glm::dvec2& position) const noexcept {
+  // Find the root node that contains this position.
+  const uint32_t rootTilesX = this->_tilingScheme.getRootTilesX();
+  for (uint32_t y = 0; y < this->_tilingScheme.getRootTilesY(); ++y) {
+    for (uint32_t x = 0; x < rootTilesX; ++x) {
+      const Rectangle extent =
+          this->_tilingScheme.tileToRectangle(QuadtreeTileID(0, x, y));
+      if (extent.contains(position)) {
+        return this->findMaxLevelFromNode(y * rootTilesX + x, extent, position);
+      }
+    }
+  }
+
+  return 0;
+}
+
+uint8_t CompactQuadtreeAvailability::isTileAvailable(
+    const QuadtreeTileID& id) const noexcept {
+  if (this->findFirstAvailableLayer(id)) {
+    return TileAvailabilityFlags::TILE_AVAILABLE |
+           TileAvailabilityFlags::REACHABLE;
+  }
+
+  return 0;
+}
+
+std::optional<uint32_t> CompactQuadtreeAvailability::findFirstAvailableLayer(
+    const QuadtreeTileID& id) const noexcept {
+  const std::optional<uint32_t> maybeNode = this->findNode(id);
+  if (!maybeNode) {
+    return std::nullopt;
+  }
+
+  const size_t first = size_t(*maybeNode) * this->_layerCount;
+  for (uint32_t layer = 0; layer < this->_layerCount; ++layer) {
+    if (this->_maxLevel[first + layer] >= id.level) {
+      return layer;
+    }
+  }
+
+  return std::nullopt;
+}
+
+int64_t CompactQuadtreeAvailability::getSizeBytes() const noexcept {
+  return int64_t(
+      sizeof(CompactQuadtreeAvailability) +
+      this->_firstChild.capacity() * sizeof(uint32_t) +
+      this->_maxLevel.capacity() * sizeof(uint8_t) +
+      this->_freeChildren.capacity() * sizeof(uint32_t));
+}
+
+std::optional<uint32_t>
+CompactQuadtreeAvailability::findNode(const QuadtreeTileID& id) const noexcept {
+  const uint32_t rootX = id.x >> id.level;
+  const uint32_t rootY = id.y >> id.level;
+  if (rootX >= this->_tilingScheme.getRootTilesX() ||
+      rootY >= this->_tilingScheme.getRootTilesY()) {
+    return std::nullopt;
+  }
+
+  // Follow the bits of the tile's coordinates down to the tile, or to the
+  // node without children that contains it. Either way, the node's levels
+  // tell whether any tile at the tile's level is available within it.
+  uint32_t node = rootY * this->_tilingScheme.getRootTilesX() + rootX;
+  for (uint32_t level = 0; level < id.level; ++level) {
+    const uint32_t firstChild = this->_firstChild[node];
+    if (firstChild == NoChildren) {
+      break;
+    }
+
+    const uint32_t shift = id.level - level - 1;
+    node = firstChild + (((id.y >> shift) & 1) << 1) + ((id.x >> shift) & 1);
+  }
+
+  return node;
+}
+
+uint8_t
+CompactQuadtreeAvailability::getNodeMaxLevel(uint32_t node) const noexcept {
+  const auto first = this->_maxLevel.begin() +
+                     std::ptrdiff_t(size_t(node) * this->_layerCount);
+  return this->_layerCount == 0
+             ? 0
+             : *std::max_element(first, first + this->_layerCount);
+}
+
+uint32_t CompactQuadtreeAvailability::createChildren(uint32_t node) {
+  const size_t layerCount = this->_layerCount;
+
+  uint32_t firstChild = NoChildren;
+  if (!this->_freeChildren.empty()) {
+    firstChild = this->_freeChildren.back();
+    this->_freeChildren.pop_back();
+  } else {
+    firstChild = static_cast<uint32_t>(this->_firstChild.size());
+    this->_firstChild.resize(this->_firstChild.size() + 4, NoChildren);
+    this->_maxLevel.resize(this->_maxLevel.size() + 4 * layerCount);
+  }
+
+  // Each child starts out with the levels of its parent.
+  const auto levels =
+      this->_maxLevel.begin() + std::ptrdiff_t(node * layerCount);
+  for (uint32_t i = 0; i < 4; ++i) {
+    std::copy_n(
+        levels,
+        layerCount,
+        this->_maxLevel.begin() +
+            std::ptrdiff_t((firstChild + i) * layerCount));
+  }
+
+  this->_firstChild[node] = firstChild;
+  return firstChild;
+}
+
+void CompactQuadtreeAvailability::addRangeToNode(
+    uint32_t node,
+    const QuadtreeTileID& nodeID,
+    const QuadtreeTileRectangularRange& range,
+    uint32_t layer,
+    uint8_t level) {
+  if (this->_firstChild[node] == NoChildren &&
+      this->_maxLevel[size_t(node) * this->_layerCount + layer] >= level) {
+    // Every tile in this node is already available to at least this level.
+    return;
+  }
+
+  // The tiles at the range's level that this node covers.
+  const uint32_t shift = range.level - nodeID.level;
+  const uint64_t minX = uint64_t(nodeID.x) << shift;
+  const uint64_t minY = uint64_t(nodeID.y) << shift;
+  const uint64_t maxX = ((uint64_t(nodeID.x) + 1) << shift) - 1;
+  const uint64_t maxY = ((uint64_t(nodeID.y) + 1) << shift) - 1;
+
+  if (maxX < range.minimumX || minX > range.maximumX ||
+      maxY < range.minimumY || minY > range.maximumY) {
+    return;
+  }
+
+  if (minX >= range.minimumX && maxX <= range.maximumX &&
+      minY >= range.minimumY && maxY <= range.maximumY) {
+    this->raiseNodeLevel(node, layer, level);
+    return;
+  }
+
+  // The range covers part of this node, so it must be finer than the node.
+  CESIUM_ASSERT(nodeID.level < range.level);
+
+  uint32_t firstChild = this->_firstChild[node];
+  if (firstChild == NoChildren) {
+    firstChild = this->createChildren(node);
+  }
+
+  for (uint32_t i = 0; i < 4; ++i) {
+    this->addRangeToNode(
+        firstChild + i,
+        QuadtreeTileID(
+            nodeID.level + 1,
+            nodeID.x * 2 + (i & 1),
+            nodeID.y * 2 + (i >> 1)),
+        range,
+        layer,
+        level);
+  }
+
+  this->updateFromChildren(node);
+}
+
+void CompactQuadtreeAvailability::addNodeFrom(
+    uint32_t node,
+    const CompactQuadtreeAvailability& other,
+    uint32_t otherNode,
+    uint32_t layer) {
+  const uint8_t otherLevel = other.getNodeMaxLevel(otherNode);
+  if (this->_firstChild[node] == NoChildren &&
+      this->_maxLevel[size_t(node) * this->_layerCount + layer] >=
+          otherLevel) {
+    // Every tile in this node is already available to at least this level.
+    return;
+  }
+
+  const uint32_t otherFirstChild = other._firstChild[otherNode];
+  if (otherFirstChild == NoChildren) {
+    this->raiseNodeLevel(node, layer, otherLevel);
+    return;
+  }
+
+  // The other node is split, so split this one the same way.
+  uint32_t firstChild = this->_firstChild[node];
+  if (firstChild == NoChildren) {
+    firstChild = this->createChildren(node);
+  }
+
+  for (uint32_t i = 0; i < 4; ++i) {
+    this->addNodeFrom(firstChild + i, other, otherFirstChild + i, layer);
+  }
+
+  this->updateFromChildren(node);
+}
+
+void CompactQuadtreeAvailability::raiseNodeLevel(
+    uint32_t node,
+    uint32_t layer,
+    uint8_t level) {
+  const uint32_t firstChild = this->_firstChild[node];
+  if (firstChild == NoChildren) {
+    uint8_t& maxLevel =
+        this->_maxLevel[size_t(node) * this->_layerCount + layer];
+    maxLevel = std::max(maxLevel, level);
+    return;
+  }
+
+  for (uint32_t i = 0; i < 4; ++i) {
+    this->raiseNodeLevel(firstChild + i, layer, level);
+  }
+
+  this->updateFromChildren(node);
+}
+
+void CompactQuadtreeAvailability::updateFromChildren(uint32_t node) {
+  const size_t layerCount = this->_layerCount;
+  const uint32_t firstChild = this->_firstChild[node];
+
+  bool childrenAreUniform = true;
+  for (uint32_t i = 0; i < 4; ++i) {
+    childrenAreUniform = childrenAreUniform &&
+                         this->_firstChild[firstChild + i] == NoChildren;
+  }
+
+  for (size_t layer = 0; layer < layerCount; ++layer) {
+    const uint8_t firstLevel = this->_maxLevel[firstChild * layerCount + layer];
+    uint8_t maxLevel = firstLevel;
+    for (uint32_t i = 1; i < 4; ++i) {
+      const uint8_t level =
+          this->_maxLevel[(firstChild + i) * layerCount + layer];
+      childrenAreUniform = childrenAreUniform && level == firstLevel;
+      maxLevel = std::max(maxLevel, level);
+    }
+
+    this->_maxLevel[node * layerCount + layer] = maxLevel;
+  }
+
+  // Merge children that have the same levels everywhere back into this node.
+  if (childrenAreUniform) {
+    this->_firstChild[node] = NoChildren;
+    this->_freeChildren.push_back(firstChild);
+  }
+}
+
+uint32_t CompactQuadtreeAvailability::findMaxLevelFromNode(
+    uint32_t node,
+    const Rectangle& extent,
+    const glm::dvec2& position) const noexcept {
+  const uint32_t firstChild = this->_firstChild[node];
+  if (firstChild == NoChildren) {
+    return this->getNodeMaxLevel(node);
+  }
+
+  // If the position is on a boundary between children, it is in all of them,
+  // so check each child that contains it.
+  const glm::dvec2 center = extent.getCenter();
+  uint32_t maxLevel = 0;
+  for (uint32_t i = 0; i < 4; ++i) {
+    const bool east = (i & 1) != 0;
+    const bool north = (i >> 1) != 0;
+    const Rectangle childExtent(
+        east ? center.x : extent.minimumX,
+        north ? center.y : extent.minimumY,
+        east ? extent.maximumX : center.x,
+        north ? extent.maximumY : center.y);
+    if (childExtent.contains(position)) {
+      maxLevel = glm::max(
+          maxLevel,
+          this->findMaxLevelFromNode(firstChild + i, childExtent, position));
+    }
+  }
+
+  return maxLevel;
+}
+
+} // namespace CesiumGeometry
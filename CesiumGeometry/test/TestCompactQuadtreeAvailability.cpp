@@ -0,0 +1,244 @@
+#include <CesiumGeometry/CompactQuadtreeAvailability.h>
+#include <CesiumGeometry/QuadtreeRectangleAvailability.h>
+#include <CesiumGeometry/QuadtreeTileID.h>
+#include <CesiumGeometry/QuadtreeTileRectangularRange.h>
+#include <CesiumGeometry/QuadtreeTilingScheme.h>
+#include <CesiumGeometry/Rectangle.h>
+#include <CesiumGeometry/TileAvailabilityFlags.h>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <glm/vec2.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <vector>
+
+using namespace CesiumGeometry;
+
+namespace {
+const QuadtreeTilingScheme
+    tilingScheme(Rectangle(-180.0, -90.0, 180.0, 90.0), 2, 1);
+
+// Creates ranges that resemble the availability of global terrain: the whole
+// globe at the shallow levels, and smaller and smaller ranges at the deeper
+// levels. They are sorted by level, like those in a layer.json.
+std::vector<QuadtreeTileRectangularRange> createRanges(
+    uint32_t maximumLevel,
+    uint32_t rangesPerLevel,
+    uint32_t seed = 1234) {
+  std::mt19937 random(seed);
+  std::vector<QuadtreeTileRectangularRange> ranges;
+
+  for (uint32_t level = 0; level <= maximumLevel; ++level) {
+    const uint32_t tilesX = tilingScheme.getNumberOfXTilesAtLevel(level);
+    const uint32_t tilesY = tilingScheme.getNumberOfYTilesAtLevel(level);
+    if (level < 5) {
+      ranges.push_back({level, 0, 0, tilesX - 1, tilesY - 1});
+      continue;
+    }
+
+    for (uint32_t i = 0; i < rangesPerLevel; ++i) {
+      const uint32_t width = 1 + uint32_t(random() % 16);
+      const uint32_t height = 1 + uint32_t(random() % 16);
+      const uint32_t x = uint32_t(random() % (tilesX - width));
+      const uint32_t y = uint32_t(random() % (tilesY - height));
+      ranges.push_back({level, x, y, x + width - 1, y + height - 1});
+    }
+  }
+
+  return ranges;
+}
+
+std::vector<QuadtreeTileID>
+createTileIDs(uint32_t maximumLevel, size_t count) {
+  std::mt19937 random(5678);
+  std::vector<QuadtreeTileID> tileIDs;
+  tileIDs.reserve(count);
+
+  for (size_t i = 0; i < count; ++i) {
+    const uint32_t level = uint32_t(random() % (maximumLevel + 1));
+    tileIDs.emplace_back(
+        level,
+        uint32_t(random() % tilingScheme.getNumberOfXTilesAtLevel(level)),
+        uint32_t(random() % tilingScheme.getNumberOfYTilesAtLevel(level)));
+  }
+
+  return tileIDs;
+}
+} // namespace
+
+TEST_CASE("CompactQuadtreeAvailability") {
+  SECTION("tiles are available within a range and above it") {
+    CompactQuadtreeAvailability availability(tilingScheme);
+    availability.addAvailableTileRange({0, 0, 0, 1, 0});
+    availability.addAvailableTileRange({3, 2, 1, 4, 2});
+
+    const uint8_t available = TileAvailabilityFlags::TILE_AVAILABLE |
+                              TileAvailabilityFlags::REACHABLE;
+    CHECK(availability.isTileAvailable(QuadtreeTileID(0, 1, 0)) == available);
+    CHECK(availability.isTileAvailable(QuadtreeTileID(3, 2, 1)) == available);
+    CHECK(availability.isTileAvailable(QuadtreeTileID(3, 4, 2)) == available);
+    CHECK(availability.isTileAvailable(QuadtreeTileID(2, 1, 0)) == available);
+    CHECK(availability.isTileAvailable(QuadtreeTileID(2, 2, 1)) == available);
+    CHECK(availability.isTileAvailable(QuadtreeTileID(1, 0, 0)) == available);
+
+    CHECK(availability.isTileAvailable(QuadtreeTileID(3, 5, 2)) == 0);
+    CHECK(availability.isTileAvailable(QuadtreeTileID(3, 2, 3)) == 0);
+    CHECK(availability.isTileAvailable(QuadtreeTileID(2, 0, 0)) == 0);
+    CHECK(availability.isTileAvailable(QuadtreeTileID(4, 4, 2)) == 0);
+
+    // Tiles outside of the tiling scheme are never available.
+    CHECK(availability.isTileAvailable(QuadtreeTileID(0, 2, 0)) == 0);
+    CHECK(availability.isTileAvailable(QuadtreeTileID(1, 1, 2)) == 0);
+  }
+
+  SECTION("ranges that together cover a tile merge into it") {
+    CompactQuadtreeAvailability availability(tilingScheme);
+    availability.addAvailableTileRange({2, 0, 0, 3, 1});
+    availability.addAvailableTileRange({2, 0, 2, 3, 3});
+
+    for (uint32_t y = 0; y < 4; ++y) {
+      for (uint32_t x = 0; x < 8; ++x) {
+        CHECK(
+            (availability.isTileAvailable(QuadtreeTileID(2, x, y)) != 0) ==
+            (x < 4));
+      }
+    }
+    CHECK(
+        availability.computeMaximumLevelAtPosition(glm::dvec2(-90.0, 45.0)) ==
+        2);
+    CHECK(
+        availability.computeMaximumLevelAtPosition(glm::dvec2(90.0, 45.0)) ==
+        0);
+
+    // The nodes no longer needed after merging are reused.
+    const int64_t sizeBytes = availability.getSizeBytes();
+    availability.addAvailableTileRange({1, 2, 0, 2, 0});
+    CHECK(availability.getSizeBytes() == sizeBytes);
+    CHECK(availability.isTileAvailable(QuadtreeTileID(1, 2, 0)) != 0);
+    CHECK(availability.isTileAvailable(QuadtreeTileID(1, 3, 0)) == 0);
+  }
+
+  SECTION("maximum levels match QuadtreeRectangleAvailability") {
+    const std::vector<QuadtreeTileRectangularRange> ranges =
+        createRanges(12, 50);
+
+    CompactQuadtreeAvailability compact(tilingScheme);
+    QuadtreeRectangleAvailability rectangles(tilingScheme, 12);
+    for (const QuadtreeTileRectangularRange& range : ranges) {
+      compact.addAvailableTileRange(range);
+      rectangles.addAvailableTileRange(range);
+    }
+
+    std::mt19937 random(42);
+    std::uniform_real_distribution<double> longitude(-180.0, 180.0);
+    std::uniform_real_distribution<double> latitude(-90.0, 90.0);
+    for (size_t i = 0; i < 2000; ++i) {
+      const glm::dvec2 position(longitude(random), latitude(random));
+      CHECK(
+          compact.computeMaximumLevelAtPosition(position) ==
+          rectangles.computeMaximumLevelAtPosition(position));
+    }
+  }
+
+  SECTION("finds the first layer in which a tile is available") {
+    CompactQuadtreeAvailability layers(tilingScheme, 3);
+    layers.addAvailableTileRange({1, 2, 0, 3, 1}, 2);
+    layers.addAvailableTileRange({2, 0, 0, 3, 3}, 1);
+    layers.addAvailableTileRange({3, 2, 1, 4, 2}, 0);
+
+    CHECK(layers.getLayerCount() == 3);
+    CHECK(layers.findFirstAvailableLayer(QuadtreeTileID(0, 0, 0)) == 0U);
+    CHECK(layers.findFirstAvailableLayer(QuadtreeTileID(0, 1, 0)) == 0U);
+    CHECK(layers.findFirstAvailableLayer(QuadtreeTileID(1, 2, 0)) == 2U);
+    CHECK(layers.findFirstAvailableLayer(QuadtreeTileID(2, 1, 0)) == 0U);
+    CHECK(layers.findFirstAvailableLayer(QuadtreeTileID(2, 0, 0)) == 1U);
+    CHECK(layers.findFirstAvailableLayer(QuadtreeTileID(3, 4, 2)) == 0U);
+    CHECK(!layers.findFirstAvailableLayer(QuadtreeTileID(3, 0, 0)));
+    CHECK(!layers.findFirstAvailableLayer(QuadtreeTileID(0, 2, 0)));
+
+    CHECK(layers.isTileAvailable(QuadtreeTileID(2, 0, 0)) != 0);
+    CHECK(layers.isTileAvailable(QuadtreeTileID(3, 0, 0)) == 0);
+    CHECK(
+        layers.computeMaximumLevelAtPosition(glm::dvec2(-150.0, -80.0)) == 2);
+    CHECK(
+        layers.computeMaximumLevelAtPosition(glm::dvec2(-90.0, -30.0)) == 3);
+  }
+
+  SECTION("layers match separate instances") {
+    std::vector<CompactQuadtreeAvailability> separate;
+    CompactQuadtreeAvailability fromRanges(tilingScheme, 3);
+    CompactQuadtreeAvailability fromInstances(tilingScheme, 3);
+    for (uint32_t layer = 0; layer < 3; ++layer) {
+      CompactQuadtreeAvailability& availability =
+          separate.emplace_back(tilingScheme);
+      for (const QuadtreeTileRectangularRange& range :
+           createRanges(10 + layer, 50, layer)) {
+        availability.addAvailableTileRange(range);
+        fromRanges.addAvailableTileRange(range, layer);
+      }
+      fromInstances.addAvailability(availability, layer);
+    }
+
+    for (const QuadtreeTileID& tileID : createTileIDs(12, 20000)) {
+      std::optional<uint32_t> expected;
+      for (uint32_t layer = 0; layer < 3 && !expected; ++layer) {
+        if (separate[layer].isTileAvailable(tileID) != 0) {
+          expected = layer;
+        }
+      }
+
+      CHECK(fromRanges.findFirstAvailableLayer(tileID) == expected);
+      CHECK(fromInstances.findFirstAvailableLayer(tileID) == expected);
+    }
+  }
+}
+
+TEST_CASE("CompactQuadtreeAvailability throughput", "[.][benchmark]") {
+  const std::vector<QuadtreeTileRectangularRange> ranges =
+      createRanges(16, 500);
+  const std::vector<QuadtreeTileID> tileIDs = createTileIDs(16, 100000);
+
+  BENCHMARK("add ranges to QuadtreeRectangleAvailability") {
+    QuadtreeRectangleAvailability availability(tilingScheme, 16);
+    for (const QuadtreeTileRectangularRange& range : ranges) {
+      availability.addAvailableTileRange(range);
+    }
+    return availability.isTileAvailable(tileIDs.front());
+  };
+
+  BENCHMARK("add ranges to CompactQuadtreeAvailability") {
+    CompactQuadtreeAvailability availability(tilingScheme);
+    for (const QuadtreeTileRectangularRange& range : ranges) {
+      availability.addAvailableTileRange(range);
+    }
+    return availability.getSizeBytes();
+  };
+
+  QuadtreeRectangleAvailability rectangles(tilingScheme, 16);
+  CompactQuadtreeAvailability compact(tilingScheme);
+  for (const QuadtreeTileRectangularRange& range : ranges) {
+    rectangles.addAvailableTileRange(range);
+    compact.addAvailableTileRange(range);
+  }
+
+  BENCHMARK("QuadtreeRectangleAvailability::isTileAvailable") {
+    uint32_t availableCount = 0;
+    for (const QuadtreeTileID& tileID : tileIDs) {
+      availableCount += rectangles.isTileAvailable(tileID) != 0 ? 1U : 0U;
+    }
+    return availableCount;
+  };
+
+  BENCHMARK("CompactQuadtreeAvailability::isTileAvailable") {
+    uint32_t availableCount = 0;
+    for (const QuadtreeTileID& tileID : tileIDs) {
+      availableCount += compact.isTileAvailable(tileID) != 0 ? 1U : 0U;
+    }
+    return availableCount;
+  };
+}
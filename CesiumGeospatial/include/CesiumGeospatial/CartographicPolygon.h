@@ -64,6 +64,27 @@ public:
     return this->_boundingRectangle;
   }
 
+  /**
+   * @brief Determines whether a globe rectangle is completely inside this
+   * polygon.
+   *
+   * @param rectangle The {@link CesiumGeospatial::GlobeRectangle} to check.
+   * @return True if the rectangle is completely inside the polygon; otherwise,
+   * false.
+   */
+  bool containsRectangle(
+      const CesiumGeospatial::GlobeRectangle& rectangle) const noexcept;
+
+  /**
+   * @brief Determines whether a globe rectangle overlaps any part of this
+   * polygon.
+   *
+   * @param rectangle The {@link CesiumGeospatial::GlobeRectangle} to check.
+   * @return True if the rectangle and the polygon overlap; otherwise, false.
+   */
+  bool intersectsRectangle(
+      const CesiumGeospatial::GlobeRectangle& rectangle) const noexcept;
+
   /**
    * @brief Determines whether a globe rectangle is completely inside any of the
    * polygons in a list.
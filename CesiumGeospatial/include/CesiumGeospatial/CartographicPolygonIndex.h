@@ -0,0 +1,108 @@
+#pragma once
+
+#include "CartographicPolygon.h"
+#include "GlobeRectangle.h"
+#include "Library.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace CesiumGeospatial {
+
+/**
+ * @brief A set of {@link CartographicPolygon} instances with a spatial index
+ * over their bounding rectangles.
+ *
+ * The bounding rectangles are bucketed into a uniform longitude / latitude
+ * grid sized according to the number of polygons. Queries only visit the grid
+ * cells that overlap the query rectangle, so their cost depends on the number
+ * of nearby polygons rather than the total number of polygons.
+ */
+class CESIUMGEOSPATIAL_API CartographicPolygonIndex final {
+public:
+  /**
+   * @brief Constructs an empty index.
+   */
+  CartographicPolygonIndex() noexcept;
+
+  /**
+   * @brief Constructs an index over the given polygons.
+   *
+   * @param polygons The polygons to index. They are copied into the index.
+   */
+  explicit CartographicPolygonIndex(
+      const std::vector<CartographicPolygon>& polygons);
+
+  /**
+   * @brief Gets the indexed polygons, in the order they were provided.
+   */
+  const std::vector<CartographicPolygon>& getPolygons() const noexcept {
+    return this->_polygons;
+  }
+
+  /**
+   * @brief Finds the polygons whose bounding rectangles intersect a globe
+   * rectangle.
+   *
+   * @param rectangle The rectangle to query.
+   * @param result Receives pointers to the polygons, in the order they were
+   * provided to the constructor. Any existing contents are replaced.
+   */
+  void findPolygons(
+      const GlobeRectangle& rectangle,
+      std::vector<const CartographicPolygon*>& result) const;
+
+  /**
+   * @brief Determines whether a globe rectangle is completely inside any of the
+   * indexed polygons.
+   *
+   * This gives the same result as
+   * {@link CartographicPolygon::rectangleIsWithinPolygons}.
+   *
+   * @param rectangle The rectangle to check.
+   * @return True if the rectangle is completely inside a polygon; otherwise,
+   * false.
+   */
+  bool rectangleIsWithinPolygons(const GlobeRectangle& rectangle) const;
+
+  /**
+   * @brief Determines whether a globe rectangle is completely outside all the
+   * indexed polygons.
+   *
+   * This gives the same result as
+   * {@link CartographicPolygon::rectangleIsOutsidePolygons}.
+   *
+   * @param rectangle The rectangle to check.
+   * @return True if the rectangle is completely outside all the polygons;
+   * otherwise, false.
+   */
+  bool rectangleIsOutsidePolygons(const GlobeRectangle& rectangle) const;
+
+private:
+  void findPolygonIndices(
+      const GlobeRectangle& rectangle,
+      std::vector<uint32_t>& result) const;
+  void addCellRange(
+      double west,
+      double south,
+      double east,
+      double north,
+      std::vector<uint32_t>& result) const;
+
+  std::vector<CartographicPolygon> _polygons;
+
+  // The extent of the grid. Polygons that have a bounding rectangle that
+  // crosses the anti-meridian are not in the grid, but are instead listed in
+  // _unindexedPolygons and included in every query.
+  GlobeRectangle _gridRectangle;
+  uint32_t _cellsX;
+  uint32_t _cellsY;
+
+  // The polygon indices in grid cell `c` are
+  // _cellPolygons[_cellOffsets[c] .. _cellOffsets[c + 1]).
+  std::vector<uint32_t> _cellOffsets;
+  std::vector<uint32_t> _cellPolygons;
+  std::vector<uint32_t> _unindexedPolygons;
+};
+
+} // namespace CesiumGeospatial
@@ -8,6 +8,7 @@
 #include <glm/vec3.hpp>
 
 #include <optional>
+#include <span>
 
 // The comments are copied here so that the doc comment always shows up in
 // Intellisense whether the default is toggled or not.
@@ -112,6 +113,22 @@ public:
   glm::dvec3
   cartographicToCartesian(const Cartographic& cartographic) const noexcept;
 
+  /**
+   * @brief Converts many {@link Cartographic} positions to cartesian
+   * representations at once.
+   *
+   * The results are the same as calling the single-position overload for each
+   * position, but the conversion runs for blocks of positions in loops that
+   * the compiler can vectorize.
+   *
+   * @param cartographics The {@link Cartographic} positions.
+   * @param results The span that receives the cartesian representations. It
+   * must be at least as large as `cartographics`.
+   */
+  void cartographicToCartesian(
+      std::span<const Cartographic> cartographics,
+      std::span<glm::dvec3> results) const noexcept;
+
   /**
    * @brief Converts the provided cartesian to a {@link Cartographic}
    * representation.
@@ -126,6 +143,24 @@ public:
   std::optional<Cartographic>
   cartesianToCartographic(const glm::dvec3& cartesian) const noexcept;
 
+  /**
+   * @brief Converts many cartesian positions to {@link Cartographic}
+   * representations at once.
+   *
+   * The results are the same as calling the single-position overload for each
+   * position, but the first iterations of the projection onto the surface run
+   * for blocks of positions in loops that the compiler can vectorize.
+   *
+   * @param cartesians The cartesian positions.
+   * @param results The span that receives the {@link Cartographic}
+   * representations. It must be at least as large as `cartesians`. An element
+   * is the empty optional if the corresponding position is at the center of
+   * this ellipsoid.
+   */
+  void cartesianToCartographic(
+      std::span<const glm::dvec3> cartesians,
+      std::span<std::optional<Cartographic>> results) const noexcept;
+
   /**
    * @brief Scales the given cartesian position along the geodetic surface
    * normal so that it is on the surface of this ellipsoid.
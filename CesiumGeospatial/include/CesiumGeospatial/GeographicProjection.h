@@ -9,6 +9,8 @@
 #include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
 
+#include <span>
+
 namespace CesiumGeospatial {
 
 class Cartographic;
@@ -83,6 +85,18 @@ public:
    */
   glm::dvec3 project(const Cartographic& cartographic) const noexcept;
 
+  /**
+   * @brief Converts many geodetic ellipsoid coordinates to geographic
+   * coordinates at once.
+   *
+   * @param cartographics The geodetic coordinates in radians.
+   * @param results The span that receives the equivalent geographic X, Y, Z
+   * coordinates, in meters. It must be at least as large as `cartographics`.
+   */
+  void project(
+      std::span<const Cartographic> cartographics,
+      std::span<glm::dvec3> results) const noexcept;
+
   /**
    * @brief Projects a globe rectangle to geographic coordinates.
    *
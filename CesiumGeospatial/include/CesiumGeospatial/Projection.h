@@ -9,6 +9,7 @@
 
 #include <glm/vec2.hpp>
 
+#include <span>
 #include <variant>
 
 namespace CesiumGeospatial {
@@ -35,6 +36,24 @@ typedef std::variant<GeographicProjection, WebMercatorProjection> Projection;
 glm::dvec3
 projectPosition(const Projection& projection, const Cartographic& position);
 
+/**
+ * @brief Projects many positions on the globe using the given
+ * {@link Projection}.
+ *
+ * This is equivalent to calling {@link projectPosition} for each position, but
+ * selects the projection type only once.
+ *
+ * @param projection The projection.
+ * @param positions The {@link Cartographic} positions.
+ * @param results The span that receives the coordinates of the projected
+ * points, in the coordinate system of the given projection. It must be at
+ * least as large as `positions`.
+ */
+void projectPositions(
+    const Projection& projection,
+    std::span<const Cartographic> positions,
+    std::span<glm::dvec3> results);
+
 /**
  * @brief Unprojects a position from the globe using the given
  * {@link Projection}.
@@ -7,6 +7,8 @@
 #include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
 
+#include <span>
+
 namespace CesiumGeospatial {
 
 class Cartographic;
@@ -86,6 +88,18 @@ public:
    */
   glm::dvec3 project(const Cartographic& cartographic) const noexcept;
 
+  /**
+   * @brief Converts many geodetic ellipsoid coordinates to Web Mercator
+   * coordinates at once.
+   *
+   * @param cartographics The geodetic coordinates in radians.
+   * @param results The span that receives the equivalent Web Mercator X, Y, Z
+   * coordinates, in meters. It must be at least as large as `cartographics`.
+   */
+  void project(
+      std::span<const Cartographic> cartographics,
+      std::span<glm::dvec3> results) const noexcept;
+
   /**
    * @brief Projects a globe rectangle to Web Mercator coordinates.
    *
@@ -5,6 +5,7 @@
 #include <glm/mat2x2.hpp>
 #include <mapbox/earcut.hpp>
 
+#include <algorithm>
 #include <array>
 
 using namespace CesiumGeometry;
@@ -111,182 +112,147 @@ CartographicPolygon::CartographicPolygon(const std::vector<glm::dvec2>& polygon)
       _indices(triangulatePolygon(polygon)),
       _boundingRectangle(computeBoundingRectangle(polygon)) {}
 
-/*static*/ bool CartographicPolygon::rectangleIsWithinPolygons(
-    const CesiumGeospatial::GlobeRectangle& rectangle,
-    const std::vector<CartographicPolygon>& cartographicPolygons) noexcept {
-
-  glm::dvec2 rectangleCorners[] = {
-      glm::dvec2(rectangle.getWest(), rectangle.getSouth()),
-      glm::dvec2(rectangle.getWest(), rectangle.getNorth()),
-      glm::dvec2(rectangle.getEast(), rectangle.getNorth()),
-      glm::dvec2(rectangle.getEast(), rectangle.getSouth())};
-
-  glm::dvec2 rectangleEdges[] = {
-      rectangleCorners[1] - rectangleCorners[0],
-      rectangleCorners[2] - rectangleCorners[1],
-      rectangleCorners[3] - rectangleCorners[2],
-      rectangleCorners[0] - rectangleCorners[3]};
-
-  // Iterate through all polygons.
-  for (size_t i = 0; i < cartographicPolygons.size(); ++i) {
-    const CartographicPolygon& selection = cartographicPolygons[i];
-
-    const std::optional<CesiumGeospatial::GlobeRectangle>&
-        polygonBoundingRectangle = selection.getBoundingRectangle();
-    if (!polygonBoundingRectangle ||
-        !rectangle.computeIntersection(*polygonBoundingRectangle)) {
-      continue;
+namespace {
+struct RectangleOutline {
+  explicit RectangleOutline(const GlobeRectangle& rectangle)
+      : corners{
+            glm::dvec2(rectangle.getWest(), rectangle.getSouth()),
+            glm::dvec2(rectangle.getWest(), rectangle.getNorth()),
+            glm::dvec2(rectangle.getEast(), rectangle.getNorth()),
+            glm::dvec2(rectangle.getEast(), rectangle.getSouth())},
+        edges{
+            corners[1] - corners[0],
+            corners[2] - corners[1],
+            corners[3] - corners[2],
+            corners[0] - corners[3]} {}
+
+  glm::dvec2 corners[4];
+  glm::dvec2 edges[4];
+};
+
+bool pointInPolygon(
+    const glm::dvec2& point,
+    const std::vector<glm::dvec2>& vertices,
+    const std::vector<uint32_t>& indices) {
+  for (size_t j = 2; j < indices.size(); j += 3) {
+    if (IntersectionTests::pointInTriangle(
+            point,
+            vertices[indices[j - 2]],
+            vertices[indices[j - 1]],
+            vertices[indices[j]])) {
+      return true;
     }
+  }
+  return false;
+}
 
-    const std::vector<glm::dvec2>& vertices = selection.getVertices();
-    const std::vector<uint32_t>& indices = selection.getIndices();
-
-    // First check if an arbitrary point on the bounding globe rectangle is
-    // inside the polygon.
-    bool inside = false;
-    for (size_t j = 2; j < indices.size(); j += 3) {
-      if (IntersectionTests::pointInTriangle(
-              rectangleCorners[0],
-              vertices[indices[j - 2]],
-              vertices[indices[j - 1]],
-              vertices[indices[j]])) {
-        inside = true;
-        break;
-      }
-    }
+bool perimeterIntersectsRectangle(
+    const std::vector<glm::dvec2>& vertices,
+    const RectangleOutline& outline) {
+  for (size_t j = 0; j < vertices.size(); ++j) {
+    const glm::dvec2& a = vertices[j];
+    const glm::dvec2& b = vertices[(j + 1) % vertices.size()];
 
-    // If the arbitrary point was outside, then this polygon does not entirely
-    // cull the tile.
-    if (!inside) {
-      continue;
-    }
+    const glm::dvec2 ba = a - b;
 
-    // Check if the polygon perimeter intersects the bounding globe rectangle
-    // edges.
-    bool intersectionFound = false;
-    for (size_t j = 0; j < vertices.size(); ++j) {
-      const glm::dvec2& a = vertices[j];
-      const glm::dvec2& b = vertices[(j + 1) % vertices.size()];
-
-      const glm::dvec2 ba = a - b;
-
-      // Check each rectangle edge.
-      for (size_t k = 0; k < 4; ++k) {
-        const glm::dvec2& cd = rectangleEdges[k];
-        const glm::dmat2 lineSegmentMatrix(cd, ba);
-        const glm::dvec2 ca = a - rectangleCorners[k];
-
-        // s and t are calculated such that:
-        // line_intersection = a + t * ab = c + s * cd
-        const glm::dvec2 st = glm::inverse(lineSegmentMatrix) * ca;
-
-        // check that the intersection is within the line segments
-        if (st.x <= 1.0 && st.x >= 0.0 && st.y <= 1.0 && st.y >= 0.0) {
-          intersectionFound = true;
-          break;
-        }
-      }
+    // Check each rectangle edge.
+    for (size_t k = 0; k < 4; ++k) {
+      const glm::dvec2& cd = outline.edges[k];
+      const glm::dmat2 lineSegmentMatrix(cd, ba);
+      const glm::dvec2 ca = a - outline.corners[k];
 
-      if (intersectionFound) {
-        break;
-      }
-    }
+      // s and t are calculated such that:
+      // line_intersection = a + t * ab = c + s * cd
+      const glm::dvec2 st = glm::inverse(lineSegmentMatrix) * ca;
 
-    // There is no intersection with the perimeter and at least one point is
-    // inside the polygon so the tile is completely inside this polygon.
-    if (!intersectionFound) {
-      return true;
+      // check that the intersection is within the line segments
+      if (st.x <= 1.0 && st.x >= 0.0 && st.y <= 1.0 && st.y >= 0.0) {
+        return true;
+      }
     }
   }
 
   return false;
 }
+} // namespace
 
-/*static*/ bool CartographicPolygon::rectangleIsOutsidePolygons(
-    const CesiumGeospatial::GlobeRectangle& rectangle,
-    const std::vector<CesiumGeospatial::CartographicPolygon>&
-        cartographicPolygons) noexcept {
+bool CartographicPolygon::containsRectangle(
+    const GlobeRectangle& rectangle) const noexcept {
+  if (!this->_boundingRectangle ||
+      !rectangle.computeIntersection(*this->_boundingRectangle)) {
+    return false;
+  }
 
-  glm::dvec2 rectangleCorners[] = {
-      glm::dvec2(rectangle.getWest(), rectangle.getSouth()),
-      glm::dvec2(rectangle.getWest(), rectangle.getNorth()),
-      glm::dvec2(rectangle.getEast(), rectangle.getNorth()),
-      glm::dvec2(rectangle.getEast(), rectangle.getSouth())};
-
-  glm::dvec2 rectangleEdges[] = {
-      rectangleCorners[1] - rectangleCorners[0],
-      rectangleCorners[2] - rectangleCorners[1],
-      rectangleCorners[3] - rectangleCorners[2],
-      rectangleCorners[0] - rectangleCorners[3]};
-
-  // Iterate through all polygons.
-  for (size_t i = 0; i < cartographicPolygons.size(); ++i) {
-    const CartographicPolygon& selection = cartographicPolygons[i];
-
-    const std::optional<CesiumGeospatial::GlobeRectangle>&
-        polygonBoundingRectangle = selection.getBoundingRectangle();
-    if (!polygonBoundingRectangle ||
-        !rectangle.computeIntersection(*polygonBoundingRectangle)) {
-      continue;
-    }
+  const RectangleOutline outline(rectangle);
 
-    const std::vector<glm::dvec2>& vertices = selection.getVertices();
-    const std::vector<uint32_t>& indices = selection.getIndices();
+  // First check if an arbitrary point on the bounding globe rectangle is
+  // inside the polygon. If it is outside, then this polygon does not entirely
+  // contain the rectangle.
+  if (!pointInPolygon(outline.corners[0], this->_vertices, this->_indices)) {
+    return false;
+  }
 
-    // Check if an arbitrary point on the polygon is in the globe rectangle.
-    if (IntersectionTests::pointInTriangle(
-            vertices[0],
-            rectangleCorners[0],
-            rectangleCorners[1],
-            rectangleCorners[2]) ||
-        IntersectionTests::pointInTriangle(
-            vertices[0],
-            rectangleCorners[0],
-            rectangleCorners[2],
-            rectangleCorners[3])) {
-      return false;
-    }
+  // If there is no intersection with the perimeter and at least one point is
+  // inside the polygon, the rectangle is completely inside this polygon.
+  return !perimeterIntersectsRectangle(this->_vertices, outline);
+}
 
-    // Check if an arbitrary point on the bounding globe rectangle is
-    // inside the polygon.
-    for (size_t j = 2; j < indices.size(); j += 3) {
-      if (IntersectionTests::pointInTriangle(
-              rectangleCorners[0],
-              vertices[indices[j - 2]],
-              vertices[indices[j - 1]],
-              vertices[indices[j]])) {
-        return false;
-      }
-    }
+bool CartographicPolygon::intersectsRectangle(
+    const GlobeRectangle& rectangle) const noexcept {
+  if (!this->_boundingRectangle ||
+      !rectangle.computeIntersection(*this->_boundingRectangle)) {
+    return false;
+  }
 
-    // Now we know the rectangle does not fully contain the polygon and the
-    // polygon does not fully contain the rectangle. Now check if the polygon
-    // perimeter intersects the bounding globe rectangle edges.
-    for (size_t j = 0; j < vertices.size(); ++j) {
-      const glm::dvec2& a = vertices[j];
-      const glm::dvec2& b = vertices[(j + 1) % vertices.size()];
-
-      const glm::dvec2 ba = a - b;
-
-      // Check each rectangle edge.
-      for (size_t k = 0; k < 4; ++k) {
-        const glm::dvec2& cd = rectangleEdges[k];
-        const glm::dmat2 lineSegmentMatrix(cd, ba);
-        const glm::dvec2 ca = a - rectangleCorners[k];
-
-        // s and t are calculated such that:
-        // line_intersection = a + t * ab = c + s * cd
-        const glm::dvec2 st = glm::inverse(lineSegmentMatrix) * ca;
-
-        // check that the intersection is within the line segments
-        if (st.x <= 1.0 && st.x >= 0.0 && st.y <= 1.0 && st.y >= 0.0) {
-          return false;
-        }
-      }
-    }
+  const RectangleOutline outline(rectangle);
+
+  // Check if an arbitrary point on the polygon is in the globe rectangle.
+  if (IntersectionTests::pointInTriangle(
+          this->_vertices[0],
+          outline.corners[0],
+          outline.corners[1],
+          outline.corners[2]) ||
+      IntersectionTests::pointInTriangle(
+          this->_vertices[0],
+          outline.corners[0],
+          outline.corners[2],
+          outline.corners[3])) {
+    return true;
+  }
+
+  // Check if an arbitrary point on the bounding globe rectangle is
+  // inside the polygon.
+  if (pointInPolygon(outline.corners[0], this->_vertices, this->_indices)) {
+    return true;
   }
 
-  return true;
+  // Now we know the rectangle does not fully contain the polygon and the
+  // polygon does not fully contain the rectangle. Now check if the polygon
+  // perimeter intersects the bounding globe rectangle edges.
+  return perimeterIntersectsRectangle(this->_vertices, outline);
+}
+
+/*static*/ bool CartographicPolygon::rectangleIsWithinPolygons(
+    const CesiumGeospatial::GlobeRectangle& rectangle,
+    const std::vector<CartographicPolygon>& cartographicPolygons) noexcept {
+  return std::any_of(
+      cartographicPolygons.begin(),
+      cartographicPolygons.end(),
+      [&rectangle](const CartographicPolygon& polygon) {
+        return polygon.containsRectangle(rectangle);
+      });
+}
+
+/*static*/ bool CartographicPolygon::rectangleIsOutsidePolygons(
+    const CesiumGeospatial::GlobeRectangle& rectangle,
+    const std::vector<CesiumGeospatial::CartographicPolygon>&
+        cartographicPolygons) noexcept {
+  return std::none_of(
+      cartographicPolygons.begin(),
+      cartographicPolygons.end(),
+      [&rectangle](const CartographicPolygon& polygon) {
+        return polygon.intersectsRectangle(rectangle);
+      });
 }
 
 } // namespace CesiumGeospatial
@@ -0,0 +1,268 @@
+#include "CesiumGeospatial/CartographicPolygonIndex.h"
+
+#include <CesiumUtility/Math.h>
+
+#include <glm/common.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace CesiumUtility;
+
+namespace CesiumGeospatial {
+
+namespace {
+
+// The largest number of grid cells along each axis.
+constexpr uint32_t maximumCellsPerAxis = 1024;
+
+bool crossesAntiMeridian(const GlobeRectangle& rectangle) {
+  return rectangle.getWest() > rectangle.getEast();
+}
+
+uint32_t
+computeCell(double value, double minimum, double size, uint32_t cells) {
+  if (size <= 0.0) {
+    return 0;
+  }
+
+  const double cell = std::floor((value - minimum) / size * double(cells));
+  return uint32_t(glm::clamp(cell, 0.0, double(cells - 1)));
+}
+
+} // namespace
+
+CartographicPolygonIndex::CartographicPolygonIndex() noexcept
+    : _polygons(),
+      _gridRectangle(GlobeRectangle::EMPTY),
+      _cellsX(0),
+      _cellsY(0),
+      _cellOffsets(),
+      _cellPolygons(),
+      _unindexedPolygons() {}
+
+CartographicPolygonIndex::CartographicPolygonIndex(
+    const std::vector<CartographicPolygon>& polygons)
+    : CartographicPolygonIndex() {
+  this->_polygons = polygons;
+
+  // Compute the extent of the grid from the polygons that can go in it.
+  double west = Math::OnePi;
+  double south = Math::PiOverTwo;
+  double east = -Math::OnePi;
+  double north = -Math::PiOverTwo;
+  uint32_t indexedCount = 0;
+
+  for (size_t i = 0; i < this->_polygons.size(); ++i) {
+    const std::optional<GlobeRectangle>& maybeBounds =
+        this->_polygons[i].getBoundingRectangle();
+    if (!maybeBounds) {
+      // Polygons without a bounding rectangle never intersect anything.
+      continue;
+    }
+
+    if (crossesAntiMeridian(*maybeBounds)) {
+      this->_unindexedPolygons.emplace_back(uint32_t(i));
+      continue;
+    }
+
+    west = glm::min(west, maybeBounds->getWest());
+    south = glm::min(south, maybeBounds->getSouth());
+    east = glm::max(east, maybeBounds->getEast());
+    north = glm::max(north, maybeBounds->getNorth());
+    ++indexedCount;
+  }
+
+  if (indexedCount == 0) {
+    return;
+  }
+
+  // Aim for roughly one polygon per cell.
+  const uint32_t cellsPerAxis = glm::clamp(
+      uint32_t(std::ceil(std::sqrt(double(indexedCount)))),
+      1U,
+      maximumCellsPerAxis);
+
+  this->_gridRectangle = GlobeRectangle(west, south, east, north);
+  this->_cellsX = cellsPerAxis;
+  this->_cellsY = cellsPerAxis;
+
+  const double gridWidth = east - west;
+  const double gridHeight = north - south;
+
+  struct CellRange {
+    uint32_t minX;
+    uint32_t minY;
+    uint32_t maxX;
+    uint32_t maxY;
+  };
+
+  auto computeCellRange = [&](const GlobeRectangle& bounds) {
+    return CellRange{
+        computeCell(bounds.getWest(), west, gridWidth, this->_cellsX),
+        computeCell(bounds.getSouth(), south, gridHeight, this->_cellsY),
+        computeCell(bounds.getEast(), west, gridWidth, this->_cellsX),
+        computeCell(bounds.getNorth(), south, gridHeight, this->_cellsY)};
+  };
+
+  // Count the polygons in each cell, then convert the counts to offsets.
+  this->_cellOffsets.assign(size_t(this->_cellsX) * this->_cellsY + 1, 0);
+  for (const CartographicPolygon& polygon : this->_polygons) {
+    const std::optional<GlobeRectangle>& maybeBounds =
+        polygon.getBoundingRectangle();
+    if (!maybeBounds || crossesAntiMeridian(*maybeBounds)) {
+      continue;
+    }
+
+    const CellRange range = computeCellRange(*maybeBounds);
+    for (uint32_t y = range.minY; y <= range.maxY; ++y) {
+      for (uint32_t x = range.minX; x <= range.maxX; ++x) {
+        ++this->_cellOffsets[size_t(y) * this->_cellsX + x + 1];
+      }
+    }
+  }
+
+  for (size_t i = 1; i < this->_cellOffsets.size(); ++i) {
+    this->_cellOffsets[i] += this->_cellOffsets[i - 1];
+  }
+
+  // Fill in each cell's polygons, in ascending order.
+  this->_cellPolygons.resize(this->_cellOffsets.back());
+  std::vector<uint32_t> cellFill(
+      this->_cellOffsets.begin(),
+      this->_cellOffsets.end() - 1);
+  for (size_t i = 0; i < this->_polygons.size(); ++i) {
+    const std::optional<GlobeRectangle>& maybeBounds =
+        this->_polygons[i].getBoundingRectangle();
+    if (!maybeBounds || crossesAntiMeridian(*maybeBounds)) {
+      continue;
+    }
+
+    const CellRange range = computeCellRange(*maybeBounds);
+    for (uint32_t y = range.minY; y <= range.maxY; ++y) {
+      for (uint32_t x = range.minX; x <= range.maxX; ++x) {
+        uint32_t& fill = cellFill[size_t(y) * this->_cellsX + x];
+        this->_cellPolygons[fill++] = uint32_t(i);
+      }
+    }
+  }
+}
+
+void CartographicPolygonIndex::findPolygons(
+    const GlobeRectangle& rectangle,
+    std::vector<const CartographicPolygon*>& result) const {
+  std::vector<uint32_t> indices;
+  this->findPolygonIndices(rectangle, indices);
+
+  result.clear();
+  result.reserve(indices.size());
+  for (uint32_t index : indices) {
+    const CartographicPolygon& polygon = this->_polygons[index];
+    const std::optional<GlobeRectangle>& maybeBounds =
+        polygon.getBoundingRectangle();
+    if (maybeBounds && rectangle.computeIntersection(*maybeBounds)) {
+      result.emplace_back(&polygon);
+    }
+  }
+}
+
+bool CartographicPolygonIndex::rectangleIsWithinPolygons(
+    const GlobeRectangle& rectangle) const {
+  std::vector<uint32_t> indices;
+  this->findPolygonIndices(rectangle, indices);
+
+  return std::any_of(
+      indices.begin(),
+      indices.end(),
+      [this, &rectangle](uint32_t index) {
+        return this->_polygons[index].containsRectangle(rectangle);
+      });
+}
+
+bool CartographicPolygonIndex::rectangleIsOutsidePolygons(
+    const GlobeRectangle& rectangle) const {
+  std::vector<uint32_t> indices;
+  this->findPolygonIndices(rectangle, indices);
+
+  return std::none_of(
+      indices.begin(),
+      indices.end(),
+      [this, &rectangle](uint32_t index) {
+        return this->_polygons[index].intersectsRectangle(rectangle);
+      });
+}
+
+void CartographicPolygonIndex::findPolygonIndices(
+    const GlobeRectangle& rectangle,
+    std::vector<uint32_t>& result) const {
+  result.assign(
+      this->_unindexedPolygons.begin(),
+      this->_unindexedPolygons.end());
+
+  if (crossesAntiMeridian(rectangle)) {
+    this->addCellRange(
+        rectangle.getWest(),
+        rectangle.getSouth(),
+        Math::OnePi,
+        rectangle.getNorth(),
+        result);
+    this->addCellRange(
+        -Math::OnePi,
+        rectangle.getSouth(),
+        rectangle.getEast(),
+        rectangle.getNorth(),
+        result);
+  } else {
+    this->addCellRange(
+        rectangle.getWest(),
+        rectangle.getSouth(),
+        rectangle.getEast(),
+        rectangle.getNorth(),
+        result);
+  }
+
+  // A polygon that spans several cells is found once per cell.
+  std::sort(result.begin(), result.end());
+  result.erase(std::unique(result.begin(), result.end()), result.end());
+}
+
+void CartographicPolygonIndex::addCellRange(
+    double west,
+    double south,
+    double east,
+    double north,
+    std::vector<uint32_t>& result) const {
+  if (this->_cellPolygons.empty()) {
+    return;
+  }
+
+  const GlobeRectangle& grid = this->_gridRectangle;
+  if (west > grid.getEast() || east < grid.getWest() ||
+      south > grid.getNorth() || north < grid.getSouth()) {
+    return;
+  }
+
+  const double gridWidth = grid.getEast() - grid.getWest();
+  const double gridHeight = grid.getNorth() - grid.getSouth();
+
+  const uint32_t minX =
+      computeCell(west, grid.getWest(), gridWidth, this->_cellsX);
+  const uint32_t maxX =
+      computeCell(east, grid.getWest(), gridWidth, this->_cellsX);
+  const uint32_t minY =
+      computeCell(south, grid.getSouth(), gridHeight, this->_cellsY);
+  const uint32_t maxY =
+      computeCell(north, grid.getSouth(), gridHeight, this->_cellsY);
+
+  for (uint32_t y = minY; y <= maxY; ++y) {
+    for (uint32_t x = minX; x <= maxX; ++x) {
+      const size_t cell = size_t(y) * this->_cellsX + x;
+      result.insert(
+          result.end(),
+          this->_cellPolygons.begin() + this->_cellOffsets[cell],
+          this->_cellPolygons.begin() + this->_cellOffsets[cell + 1]);
+    }
+  }
+}
+
+} // namespace CesiumGeospatial
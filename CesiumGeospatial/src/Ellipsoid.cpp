@@ -1,10 +1,14 @@
 #include "CesiumGeospatial/Ellipsoid.h"
 
+#include <CesiumUtility/Assert.h>
 #include <CesiumUtility/Math.h>
 
 #include <glm/geometric.hpp>
 #include <glm/trigonometric.hpp>
 
+#include <algorithm>
+#include <array>
+
 using namespace CesiumUtility;
 
 namespace CesiumGeospatial {
@@ -12,6 +16,65 @@ namespace CesiumGeospatial {
 const Ellipsoid Ellipsoid::WGS84(6378137.0, 6378137.0, 6356752.3142451793);
 const Ellipsoid Ellipsoid::UNIT_SPHERE(1.0, 1.0, 1.0);
 
+namespace {
+
+Cartographic cartographicFromSurfacePosition(
+    const Ellipsoid& ellipsoid,
+    const glm::dvec3& cartesian,
+    const glm::dvec3& surfacePosition) {
+  const glm::dvec3 n = ellipsoid.geodeticSurfaceNormal(surfacePosition);
+  const glm::dvec3 h = cartesian - surfacePosition;
+
+  const double longitude = glm::atan(n.y, n.x);
+  const double latitude = glm::asin(n.z);
+  const double height = Math::sign(glm::dot(h, cartesian)) * glm::length(h);
+
+  return Cartographic(longitude, latitude, height);
+}
+
+/**
+ * @brief The state of the Newton's method solve in
+ * {@link Ellipsoid::scaleToGeodeticSurface} for a single position.
+ */
+struct SurfaceSolveStep {
+  double xMultiplier;
+  double yMultiplier;
+  double zMultiplier;
+  double func;
+  double correction;
+};
+
+SurfaceSolveStep evaluateSurfaceSolve(
+    double x2,
+    double y2,
+    double z2,
+    double lambda,
+    const glm::dvec3& oneOverRadiiSquared) noexcept {
+  const double xMultiplier = 1.0 / (1.0 + lambda * oneOverRadiiSquared.x);
+  const double yMultiplier = 1.0 / (1.0 + lambda * oneOverRadiiSquared.y);
+  const double zMultiplier = 1.0 / (1.0 + lambda * oneOverRadiiSquared.z);
+
+  const double xMultiplier2 = xMultiplier * xMultiplier;
+  const double yMultiplier2 = yMultiplier * yMultiplier;
+  const double zMultiplier2 = zMultiplier * zMultiplier;
+
+  const double func =
+      x2 * xMultiplier2 + y2 * yMultiplier2 + z2 * zMultiplier2 - 1.0;
+  const double denominator =
+      x2 * xMultiplier2 * xMultiplier * oneOverRadiiSquared.x +
+      y2 * yMultiplier2 * yMultiplier * oneOverRadiiSquared.y +
+      z2 * zMultiplier2 * zMultiplier * oneOverRadiiSquared.z;
+
+  return SurfaceSolveStep{
+      xMultiplier,
+      yMultiplier,
+      zMultiplier,
+      func,
+      func / (-2.0 * denominator)};
+}
+
+} // namespace
+
 glm::dvec3
 Ellipsoid::geodeticSurfaceNormal(const glm::dvec3& position) const noexcept {
   return glm::normalize(position * this->_oneOverRadiiSquared);
@@ -39,6 +102,56 @@ glm::dvec3 Ellipsoid::cartographicToCartesian(
   return k + n;
 }
 
+void Ellipsoid::cartographicToCartesian(
+    std::span<const Cartographic> cartographics,
+    std::span<glm::dvec3> results) const noexcept {
+  CESIUM_ASSERT(results.size() >= cartographics.size());
+
+  // The trigonometry and the scaling onto the ellipsoid are done in separate
+  // passes over structure-of-arrays blocks so that each pass is a simple loop
+  // the compiler can vectorize.
+  constexpr size_t blockSize = 64;
+  std::array<double, blockSize> nx;
+  std::array<double, blockSize> ny;
+  std::array<double, blockSize> nz;
+
+  const double radiiSquaredX = this->_radiiSquared.x;
+  const double radiiSquaredY = this->_radiiSquared.y;
+  const double radiiSquaredZ = this->_radiiSquared.z;
+
+  for (size_t blockStart = 0; blockStart < cartographics.size();
+       blockStart += blockSize) {
+    const size_t count = std::min(blockSize, cartographics.size() - blockStart);
+    const Cartographic* pBlock = cartographics.data() + blockStart;
+
+    for (size_t i = 0; i < count; ++i) {
+      const double cosLatitude = glm::cos(pBlock[i].latitude);
+      nx[i] = cosLatitude * glm::cos(pBlock[i].longitude);
+      ny[i] = cosLatitude * glm::sin(pBlock[i].longitude);
+      nz[i] = glm::sin(pBlock[i].latitude);
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+      const double oneOverLength =
+          1.0 / sqrt(nx[i] * nx[i] + ny[i] * ny[i] + nz[i] * nz[i]);
+      const double x = nx[i] * oneOverLength;
+      const double y = ny[i] * oneOverLength;
+      const double z = nz[i] * oneOverLength;
+
+      const double kx = radiiSquaredX * x;
+      const double ky = radiiSquaredY * y;
+      const double kz = radiiSquaredZ * z;
+      const double gamma = sqrt(x * kx + y * ky + z * kz);
+      const double height = pBlock[i].height;
+
+      results[blockStart + i] = glm::dvec3(
+          kx / gamma + x * height,
+          ky / gamma + y * height,
+          kz / gamma + z * height);
+    }
+  }
+}
+
 std::optional<Cartographic>
 Ellipsoid::cartesianToCartographic(const glm::dvec3& cartesian) const noexcept {
   std::optional<glm::dvec3> p = this->scaleToGeodeticSurface(cartesian);
@@ -47,14 +160,96 @@ Ellipsoid::cartesianToCartographic(const glm::dvec3& cartesian) const noexcept {
     return std::optional<Cartographic>();
   }
 
-  const glm::dvec3 n = this->geodeticSurfaceNormal(p.value());
-  const glm::dvec3 h = cartesian - p.value();
-
-  const double longitude = glm::atan(n.y, n.x);
-  const double latitude = glm::asin(n.z);
-  const double height = Math::sign(glm::dot(h, cartesian)) * glm::length(h);
+  return cartographicFromSurfacePosition(*this, cartesian, p.value());
+}
 
-  return Cartographic(longitude, latitude, height);
+void Ellipsoid::cartesianToCartographic(
+    std::span<const glm::dvec3> cartesians,
+    std::span<std::optional<Cartographic>> results) const noexcept {
+  CESIUM_ASSERT(results.size() >= cartesians.size());
+
+  // Nearly all positions converge within a couple of Newton iterations, so
+  // those iterations are run for a whole block without branches. Positions
+  // that still haven't converged, or that are near the center, are finished
+  // individually.
+  constexpr size_t blockSize = 64;
+  constexpr int32_t unconditionalIterations = 2;
+
+  std::array<double, blockSize> x2;
+  std::array<double, blockSize> y2;
+  std::array<double, blockSize> z2;
+  std::array<double, blockSize> squaredNorm;
+  std::array<double, blockSize> lambda;
+  std::array<SurfaceSolveStep, blockSize> steps;
+
+  const glm::dvec3 oneOverRadii = this->_oneOverRadii;
+  const glm::dvec3 oneOverRadiiSquared = this->_oneOverRadiiSquared;
+
+  for (size_t blockStart = 0; blockStart < cartesians.size();
+       blockStart += blockSize) {
+    const size_t count = std::min(blockSize, cartesians.size() - blockStart);
+    const glm::dvec3* pBlock = cartesians.data() + blockStart;
+
+    for (size_t i = 0; i < count; ++i) {
+      const glm::dvec3& cartesian = pBlock[i];
+      const glm::dvec3 scaled = cartesian * oneOverRadii;
+      x2[i] = scaled.x * scaled.x;
+      y2[i] = scaled.y * scaled.y;
+      z2[i] = scaled.z * scaled.z;
+      squaredNorm[i] = x2[i] + y2[i] + z2[i];
+
+      // Same initial guess as scaleToGeodeticSurface. Positions near the
+      // center produce non-finite values here, but they are discarded below.
+      const double ratio = sqrt(1.0 / squaredNorm[i]);
+      const glm::dvec3 gradient =
+          cartesian * ratio * oneOverRadiiSquared * 2.0;
+      lambda[i] = ((1.0 - ratio) * glm::length(cartesian)) /
+                  (0.5 * glm::length(gradient));
+      steps[i].correction = 0.0;
+    }
+
+    for (int32_t iteration = 0; iteration < unconditionalIterations;
+         ++iteration) {
+      for (size_t i = 0; i < count; ++i) {
+        lambda[i] -= steps[i].correction;
+        steps[i] = evaluateSurfaceSolve(
+            x2[i],
+            y2[i],
+            z2[i],
+            lambda[i],
+            oneOverRadiiSquared);
+      }
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+      const glm::dvec3& cartesian = pBlock[i];
+      std::optional<Cartographic>& result = results[blockStart + i];
+
+      if (squaredNorm[i] < this->_centerToleranceSquared) {
+        result = this->cartesianToCartographic(cartesian);
+        continue;
+      }
+
+      SurfaceSolveStep step = steps[i];
+      double currentLambda = lambda[i];
+      while (glm::abs(step.func) > Math::Epsilon12) {
+        currentLambda -= step.correction;
+        step = evaluateSurfaceSolve(
+            x2[i],
+            y2[i],
+            z2[i],
+            currentLambda,
+            oneOverRadiiSquared);
+      }
+
+      const glm::dvec3 surfacePosition(
+          cartesian.x * step.xMultiplier,
+          cartesian.y * step.yMultiplier,
+          cartesian.z * step.zMultiplier);
+      result =
+          cartographicFromSurfacePosition(*this, cartesian, surfacePosition);
+    }
+  }
 }
 
 std::optional<glm::dvec3>
@@ -2,6 +2,7 @@
 
 #include "CesiumGeospatial/Cartographic.h"
 
+#include <CesiumUtility/Assert.h>
 #include <CesiumUtility/Math.h>
 
 namespace CesiumGeospatial {
@@ -20,6 +21,21 @@ GeographicProjection::project(const Cartographic& cartographic) const noexcept {
       cartographic.height);
 }
 
+void GeographicProjection::project(
+    std::span<const Cartographic> cartographics,
+    std::span<glm::dvec3> results) const noexcept {
+  CESIUM_ASSERT(results.size() >= cartographics.size());
+
+  const double semimajorAxis = this->_semimajorAxis;
+  for (size_t i = 0; i < cartographics.size(); ++i) {
+    const Cartographic& cartographic = cartographics[i];
+    results[i] = glm::dvec3(
+        cartographic.longitude * semimajorAxis,
+        cartographic.latitude * semimajorAxis,
+        cartographic.height);
+  }
+}
+
 CesiumGeometry::Rectangle GeographicProjection::project(
     const CesiumGeospatial::GlobeRectangle& rectangle) const noexcept {
   const glm::dvec3 sw = this->project(rectangle.getSouthwest());
@@ -22,6 +22,26 @@ projectPosition(const Projection& projection, const Cartographic& position) {
   return std::visit(Operation{position}, projection);
 }
 
+void projectPositions(
+    const Projection& projection,
+    std::span<const Cartographic> positions,
+    std::span<glm::dvec3> results) {
+  struct Operation {
+    std::span<const Cartographic> positions;
+    std::span<glm::dvec3> results;
+
+    void operator()(const GeographicProjection& geographic) noexcept {
+      geographic.project(positions, results);
+    }
+
+    void operator()(const WebMercatorProjection& webMercator) noexcept {
+      webMercator.project(positions, results);
+    }
+  };
+
+  std::visit(Operation{positions, results}, projection);
+}
+
 Cartographic
 unprojectPosition(const Projection& projection, const glm::dvec3& position) {
   struct Operation {
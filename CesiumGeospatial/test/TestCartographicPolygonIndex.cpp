@@ -0,0 +1,108 @@
+#include <CesiumGeospatial/CartographicPolygon.h>
+#include <CesiumGeospatial/CartographicPolygonIndex.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <glm/vec2.hpp>
+
+#include <cstddef>
+#include <vector>
+
+using namespace CesiumGeospatial;
+
+namespace {
+CartographicPolygon createSquare(double west, double south, double size) {
+  return CartographicPolygon(std::vector<glm::dvec2>{
+      glm::dvec2(west, south),
+      glm::dvec2(west + size, south),
+      glm::dvec2(west + size, south + size),
+      glm::dvec2(west, south + size)});
+}
+
+// Creates a grid of small squares, like building footprints.
+std::vector<CartographicPolygon> createFootprints(size_t across) {
+  std::vector<CartographicPolygon> polygons;
+  polygons.reserve(across * across);
+
+  const double spacing = 0.0001;
+  for (size_t j = 0; j < across; ++j) {
+    for (size_t i = 0; i < across; ++i) {
+      polygons.emplace_back(createSquare(
+          0.5 + double(i) * spacing,
+          0.2 + double(j) * spacing,
+          spacing * 0.5));
+    }
+  }
+
+  return polygons;
+}
+} // namespace
+
+TEST_CASE("CartographicPolygonIndex") {
+  std::vector<CartographicPolygon> polygons = createFootprints(20);
+
+  // Add a large polygon and one that crosses the anti-meridian.
+  polygons.emplace_back(createSquare(-1.0, -1.0, 0.5));
+  polygons.emplace_back(CartographicPolygon(std::vector<glm::dvec2>{
+      glm::dvec2(3.1, 0.0),
+      glm::dvec2(-3.1, 0.0),
+      glm::dvec2(-3.1, 0.1),
+      glm::dvec2(3.1, 0.1)}));
+
+  const CartographicPolygonIndex index(polygons);
+  CHECK(index.getPolygons().size() == polygons.size());
+
+  const std::vector<GlobeRectangle> queries{
+      GlobeRectangle(0.5, 0.2, 0.5005, 0.2005),
+      GlobeRectangle(0.50002, 0.20002, 0.50004, 0.20004),
+      GlobeRectangle(0.500051, 0.200051, 0.500099, 0.200099),
+      GlobeRectangle(-0.9, -0.9, -0.8, -0.8),
+      GlobeRectangle(-2.0, -2.0, -1.9, -1.9),
+      GlobeRectangle(3.11, 0.01, -3.11, 0.02),
+      GlobeRectangle(3.0, 0.0, 3.05, 0.05),
+      GlobeRectangle::MAXIMUM};
+
+  for (const GlobeRectangle& query : queries) {
+    CHECK(
+        index.rectangleIsWithinPolygons(query) ==
+        CartographicPolygon::rectangleIsWithinPolygons(query, polygons));
+    CHECK(
+        index.rectangleIsOutsidePolygons(query) ==
+        CartographicPolygon::rectangleIsOutsidePolygons(query, polygons));
+
+    std::vector<const CartographicPolygon*> expected;
+    for (const CartographicPolygon& polygon : index.getPolygons()) {
+      if (polygon.getBoundingRectangle() &&
+          query.computeIntersection(*polygon.getBoundingRectangle())) {
+        expected.emplace_back(&polygon);
+      }
+    }
+
+    std::vector<const CartographicPolygon*> found;
+    index.findPolygons(query, found);
+    CHECK(found == expected);
+  }
+
+  SECTION("an empty index finds nothing") {
+    const CartographicPolygonIndex empty;
+    std::vector<const CartographicPolygon*> found;
+    empty.findPolygons(GlobeRectangle::MAXIMUM, found);
+    CHECK(found.empty());
+    CHECK(!empty.rectangleIsWithinPolygons(GlobeRectangle::MAXIMUM));
+    CHECK(empty.rectangleIsOutsidePolygons(GlobeRectangle::MAXIMUM));
+  }
+}
+
+TEST_CASE("CartographicPolygonIndex query throughput", "[.][benchmark]") {
+  const std::vector<CartographicPolygon> polygons = createFootprints(100);
+  const CartographicPolygonIndex index(polygons);
+  const GlobeRectangle tile(0.5042, 0.2042, 0.5046, 0.2046);
+
+  BENCHMARK("all polygons") {
+    return CartographicPolygon::rectangleIsOutsidePolygons(tile, polygons);
+  };
+
+  BENCHMARK("indexed") { return index.rectangleIsOutsidePolygons(tile); };
+}
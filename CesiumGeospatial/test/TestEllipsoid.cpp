@@ -0,0 +1,130 @@
+#include <CesiumGeospatial/Cartographic.h>
+#include <CesiumGeospatial/Ellipsoid.h>
+#include <CesiumUtility/Math.h>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <glm/vec3.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+using namespace CesiumGeospatial;
+using namespace CesiumUtility;
+
+namespace {
+std::vector<glm::dvec3> createPositionsAroundGlobe(size_t count) {
+  std::vector<glm::dvec3> positions;
+  positions.reserve(count);
+
+  for (size_t i = 0; i < count; ++i) {
+    const double t = double(i) / double(count);
+    const Cartographic cartographic(
+        Math::lerp(-Math::OnePi, Math::OnePi, t),
+        Math::lerp(-Math::PiOverTwo, Math::PiOverTwo, std::fmod(t * 7.0, 1.0)),
+        Math::lerp(-1000.0, 10000.0, std::fmod(t * 3.0, 1.0)));
+    positions.emplace_back(
+        Ellipsoid::WGS84.cartographicToCartesian(cartographic));
+  }
+
+  return positions;
+}
+} // namespace
+
+TEST_CASE("Ellipsoid::cartesianToCartographic") {
+  SECTION("batch conversion matches single-position conversion") {
+    std::vector<glm::dvec3> positions = createPositionsAroundGlobe(1000);
+
+    // Include positions at and near the center, which take a different path.
+    positions[10] = glm::dvec3(0.0, 0.0, 0.0);
+    positions[500] = glm::dvec3(1.0, 2.0, 3.0);
+
+    std::vector<std::optional<Cartographic>> results(positions.size());
+    Ellipsoid::WGS84.cartesianToCartographic(positions, results);
+
+    for (size_t i = 0; i < positions.size(); ++i) {
+      const std::optional<Cartographic> expected =
+          Ellipsoid::WGS84.cartesianToCartographic(positions[i]);
+      REQUIRE(results[i].has_value() == expected.has_value());
+      if (!expected) {
+        continue;
+      }
+
+      CHECK(Math::equalsEpsilon(
+          results[i]->longitude,
+          expected->longitude,
+          Math::Epsilon12));
+      CHECK(Math::equalsEpsilon(
+          results[i]->latitude,
+          expected->latitude,
+          Math::Epsilon12));
+      CHECK(Math::equalsEpsilon(
+          results[i]->height,
+          expected->height,
+          Math::Epsilon8,
+          Math::Epsilon6));
+    }
+
+    CHECK(!results[10]);
+  }
+
+  SECTION("handles an empty batch") {
+    std::vector<glm::dvec3> positions;
+    std::vector<std::optional<Cartographic>> results;
+    Ellipsoid::WGS84.cartesianToCartographic(positions, results);
+    CHECK(results.empty());
+  }
+}
+
+TEST_CASE("Ellipsoid::cartographicToCartesian") {
+  SECTION("batch conversion matches single-position conversion") {
+    std::vector<Cartographic> cartographics;
+    for (size_t i = 0; i < 1000; ++i) {
+      const double t = double(i) / 1000.0;
+      cartographics.emplace_back(
+          Math::lerp(-Math::OnePi, Math::OnePi, t),
+          Math::lerp(
+              -Math::PiOverTwo,
+              Math::PiOverTwo,
+              std::fmod(t * 7.0, 1.0)),
+          Math::lerp(-1000.0, 10000.0, std::fmod(t * 3.0, 1.0)));
+    }
+
+    std::vector<glm::dvec3> results(cartographics.size());
+    Ellipsoid::WGS84.cartographicToCartesian(cartographics, results);
+
+    for (size_t i = 0; i < cartographics.size(); ++i) {
+      const glm::dvec3 expected =
+          Ellipsoid::WGS84.cartographicToCartesian(cartographics[i]);
+      CHECK(Math::equalsEpsilon(results[i], expected, Math::Epsilon12));
+    }
+  }
+
+  SECTION("handles an empty batch") {
+    std::vector<Cartographic> cartographics;
+    std::vector<glm::dvec3> results;
+    Ellipsoid::WGS84.cartographicToCartesian(cartographics, results);
+    CHECK(results.empty());
+  }
+}
+
+TEST_CASE("Ellipsoid::cartesianToCartographic throughput", "[.][benchmark]") {
+  const std::vector<glm::dvec3> positions =
+      createPositionsAroundGlobe(1000000);
+  std::vector<std::optional<Cartographic>> results(positions.size());
+
+  BENCHMARK("one position at a time") {
+    for (size_t i = 0; i < positions.size(); ++i) {
+      results[i] = Ellipsoid::WGS84.cartesianToCartographic(positions[i]);
+    }
+    return results.back();
+  };
+
+  BENCHMARK("batched") {
+    Ellipsoid::WGS84.cartesianToCartographic(positions, results);
+    return results.back();
+  };
+}
@@ -1,3 +1,4 @@
+#include "CesiumGeospatial/Cartographic.h"
 #include "CesiumGeospatial/GlobeRectangle.h"
 #include "CesiumGeospatial/Projection.h"
 
@@ -7,6 +8,9 @@
 #include <catch2/catch_test_macros.hpp>
 #include <glm/geometric.hpp>
 
+#include <cstddef>
+#include <vector>
+
 using namespace CesiumGeometry;
 using namespace CesiumGeospatial;
 using namespace CesiumUtility;
@@ -122,3 +126,27 @@ TEST_CASE("computeProjectedRectangleSize") {
         1.0));
   }
 }
+
+TEST_CASE("projectPositions") {
+  const std::vector<Cartographic> positions{
+      Cartographic::fromDegrees(0.0, 0.0, 0.0),
+      Cartographic::fromDegrees(-75.0, 40.0, 100.0),
+      Cartographic::fromDegrees(179.0, -80.0, -10.0)};
+  std::vector<glm::dvec3> results(positions.size());
+
+  SECTION("Geographic") {
+    Projection projection = GeographicProjection(Ellipsoid::WGS84);
+    projectPositions(projection, positions, results);
+    for (size_t i = 0; i < positions.size(); ++i) {
+      CHECK(results[i] == projectPosition(projection, positions[i]));
+    }
+  }
+
+  SECTION("Web Mercator") {
+    Projection projection = WebMercatorProjection(Ellipsoid::WGS84);
+    projectPositions(projection, positions, results);
+    for (size_t i = 0; i < positions.size(); ++i) {
+      CHECK(results[i] == projectPosition(projection, positions[i]));
+    }
+  }
+}
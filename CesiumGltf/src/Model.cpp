@@ -873,6 +873,12 @@ void Model::generateMissingNormalsSmooth() {
           return;
         }
 
+        // the positions of a Draco-compressed primitive cannot be read until
+        // it is decoded
+        if (primitive.hasExtension<ExtensionKhrDracoMeshCompression>()) {
+          return;
+        }
+
         // if positions do not exist, we cannot create normals.
         auto positionIt = primitive.attributes.find("POSITION");
         if (positionIt == primitive.attributes.end()) {
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "GltfUtilities.h"
+#include "Library.h"
+
+#include <CesiumGeometry/Ray.h>
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace CesiumGltf {
+struct Model;
+} // namespace CesiumGltf
+
+namespace CesiumGltfContent {
+
+/**
+ * @brief A bounding volume hierarchy over the triangles of a glTF model, used
+ * to intersect rays with the model much faster than
+ * {@link GltfUtilities::intersectRayGltfModel}.
+ *
+ * A separate hierarchy is built, with the surface area heuristic, for each
+ * triangle primitive in the model's scene. The hierarchy keeps its own copy
+ * of the vertex positions of each triangle, so it does not refer to the model
+ * after it is constructed. It must be rebuilt if the model's geometry changes.
+ */
+class CESIUMGLTFCONTENT_API GltfTriangleBvh {
+public:
+  /**
+   * @brief Builds the hierarchy for the triangles of a glTF model.
+   *
+   * Primitives that cannot be intersected by
+   * {@link GltfUtilities::intersectRayGltfModel} are skipped, and the warnings
+   * explaining why are reported by every subsequent {@link intersectRay}.
+   *
+   * @param gltf The glTF model.
+   */
+  explicit GltfTriangleBvh(const CesiumGltf::Model& gltf);
+
+  /**
+   * @brief Intersects a ray with the glTF model from which this hierarchy was
+   * built and returns the first intersection point.
+   *
+   * The result is the same as the one from
+   * {@link GltfUtilities::intersectRayGltfModel} with the same parameters,
+   * except that the accessor `min` and `max` of each primitive are not
+   * consulted.
+   *
+   * @param ray A ray in world space.
+   * @param cullBackFaces Ignore triangles that face away from ray. Front faces
+   * use CCW winding order.
+   * @param gltfTransform Optional matrix to apply to entire gltf model.
+   * @returns IntersectResult describing outcome
+   */
+  GltfUtilities::IntersectResult intersectRay(
+      const CesiumGeometry::Ray& ray,
+      bool cullBackFaces = true,
+      const glm::dmat4x4& gltfTransform = glm::dmat4x4(1.0)) const;
+
+  /**
+   * @brief Intersects many rays with the glTF model from which this hierarchy
+   * was built and returns the first intersection point of each.
+   *
+   * The rays are traversed through the hierarchy in packets, in the given
+   * order, so this is fastest when consecutive rays are near each other and
+   * point in similar directions. Each result is the same as the one from
+   * {@link intersectRay} for the same ray.
+   *
+   * @param rays The rays in world space.
+   * @param warnings Warnings encountered when traversing the glTF model are
+   * added to this vector, once for all of the rays.
+   * @param cullBackFaces Ignore triangles that face away from ray. Front faces
+   * use CCW winding order.
+   * @param gltfTransform Optional matrix to apply to entire gltf model.
+   * @returns The hit for each ray, in the same order as the rays, or
+   * `std::nullopt` for rays that miss the model.
+   */
+  std::vector<std::optional<GltfUtilities::RayGltfHit>> intersectRays(
+      std::span<const CesiumGeometry::Ray> rays,
+      std::vector<std::string>& warnings,
+      bool cullBackFaces = true,
+      const glm::dmat4x4& gltfTransform = glm::dmat4x4(1.0)) const;
+
+  /**
+   * @brief Gets the number of triangles in the hierarchy.
+   */
+  size_t getTriangleCount() const noexcept {
+    return this->_vertices.size() / 3;
+  }
+
+  /**
+   * @brief Gets the number of bytes of memory used by the hierarchy.
+   */
+  int64_t getSizeBytes() const noexcept;
+
+private:
+  // An interior node has a count of zero. Its first child immediately follows
+  // it and its second child is at `offset`. A leaf node refers to `count`
+  // triangles starting at triangle `offset`.
+  struct Node {
+    glm::vec3 min;
+    uint32_t offset;
+    glm::vec3 max;
+    uint32_t count;
+  };
+
+  struct Primitive {
+    glm::dmat4x4 nodeTransform;
+    int32_t meshId;
+    int32_t primitiveId;
+    uint32_t rootNode;
+  };
+
+  class Builder;
+
+  glm::dmat4x4 _rtcTransform;
+  glm::dmat4x4 _upAxisTransform;
+  std::vector<Primitive> _primitives;
+  std::vector<Node> _nodes;
+  std::vector<glm::vec3> _vertices;
+  std::vector<std::string> _warnings;
+};
+
+} // namespace CesiumGltfContent
@@ -271,6 +271,22 @@ struct CESIUMGLTFCONTENT_API GltfUtilities {
    */
   static void compactBuffer(CesiumGltf::Model& gltf, int32_t bufferIndex);
 
+  /**
+   * @brief Computes the number of bytes saved by keeping mesh data that is
+   * compressed with `KHR_draco_mesh_compression` or `EXT_meshopt_compression`
+   * in its compressed form rather than decoding it.
+   *
+   * For each compressed primitive or buffer view, this is the size of the
+   * decoded data, as described by its accessors or by the extension, minus the
+   * size of the compressed data. A model whose mesh data has already been
+   * decoded saves zero bytes.
+   *
+   * @param gltf The glTF to inspect.
+   * @return The number of bytes saved.
+   */
+  static int64_t
+  computeCompressedMeshByteSavings(const CesiumGltf::Model& gltf);
+
   /**
    * @brief Data describing a hit from a ray / gltf intersection test
    */
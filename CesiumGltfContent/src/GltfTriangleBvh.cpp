@@ -0,0 +1,726 @@
+#include "IntersectGltfUnsupportedExtensions.h"
+
+#include <CesiumGeometry/IntersectionTests.h>
+#include <CesiumGeometry/Ray.h>
+#include <CesiumGltf/AccessorView.h>
+#include <CesiumGltf/Model.h>
+#include <CesiumGltfContent/GltfTriangleBvh.h>
+#include <CesiumGltfContent/GltfUtilities.h>
+#include <CesiumUtility/Assert.h>
+
+#include <fmt/format.h>
+#include <glm/common.hpp>
+#include <glm/geometric.hpp>
+#include <glm/matrix.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <string_view>
+
+using namespace CesiumGeometry;
+using namespace CesiumGltf;
+
+namespace CesiumGltfContent {
+
+namespace {
+
+// Triangles are split into bins along the longest axis of their centroids'
+// bounds, and the split between bins with the lowest surface area heuristic
+// cost is used.
+constexpr size_t binCount = 16;
+constexpr size_t maximumLeafTriangles = 4;
+
+// Nodes deeper than this are always leaves, which bounds the size of the
+// traversal stack.
+constexpr uint32_t maximumDepth = 64;
+
+// Rays are intersected in packets of up to this many, so that each node is
+// visited once for all of the rays of a packet that enter it. Each ray is one
+// bit of a mask.
+constexpr size_t rayPacketSize = 64;
+
+// Node bounds are enlarged by this fraction of their coordinates so that
+// rounding in the ray / box test never rejects a triangle hit.
+constexpr float boundsPadding = 1e-6f;
+
+template <typename TCallback>
+void createPositionView(
+    const Model& model,
+    const Accessor& accessor,
+    TCallback&& callback) {
+  switch (accessor.componentType) {
+  case Accessor::ComponentType::BYTE:
+    callback(AccessorView<AccessorTypes::VEC3<int8_t>>(model, accessor));
+    break;
+  case Accessor::ComponentType::UNSIGNED_BYTE:
+    callback(AccessorView<AccessorTypes::VEC3<uint8_t>>(model, accessor));
+    break;
+  case Accessor::ComponentType::SHORT:
+    callback(AccessorView<AccessorTypes::VEC3<int16_t>>(model, accessor));
+    break;
+  case Accessor::ComponentType::UNSIGNED_SHORT:
+    callback(AccessorView<AccessorTypes::VEC3<uint16_t>>(model, accessor));
+    break;
+  case Accessor::ComponentType::UNSIGNED_INT:
+    callback(AccessorView<AccessorTypes::VEC3<uint32_t>>(model, accessor));
+    break;
+  case Accessor::ComponentType::FLOAT:
+    callback(AccessorView<AccessorTypes::VEC3<float>>(model, accessor));
+    break;
+  default:
+    callback(AccessorView<AccessorTypes::VEC3<float>>(
+        AccessorViewStatus::InvalidComponentType));
+    break;
+  }
+}
+
+// Calls the callback with the vertex indices of each triangle of the
+// primitive, in the winding order used by intersectRayGltfModel.
+template <typename TGetIndex, typename TCallback>
+void forEachTriangle(
+    int32_t mode,
+    int64_t indexCount,
+    TGetIndex&& getIndex,
+    TCallback&& callback) {
+  if (mode == MeshPrimitive::Mode::TRIANGLES) {
+    for (int64_t i = 2; i < indexCount; i += 3) {
+      callback(getIndex(i - 2), getIndex(i - 1), getIndex(i));
+    }
+  } else if (mode == MeshPrimitive::Mode::TRIANGLE_STRIP) {
+    for (int64_t i = 2; i < indexCount; ++i) {
+      if (i % 2) {
+        callback(getIndex(i - 2), getIndex(i), getIndex(i - 1));
+      } else {
+        callback(getIndex(i - 2), getIndex(i - 1), getIndex(i));
+      }
+    }
+  } else {
+    CESIUM_ASSERT(mode == MeshPrimitive::Mode::TRIANGLE_FAN);
+    for (int64_t i = 2; i < indexCount; ++i) {
+      callback(getIndex(0), getIndex(i - 1), getIndex(i));
+    }
+  }
+}
+
+float halfSurfaceArea(const glm::vec3& min, const glm::vec3& max) {
+  glm::vec3 extent = max - min;
+  return extent.x * extent.y + extent.y * extent.z + extent.z * extent.x;
+}
+
+} // namespace
+
+class GltfTriangleBvh::Builder {
+public:
+  explicit Builder(GltfTriangleBvh& bvh) : _bvh(bvh), _triangles() {}
+
+  void addTriangle(
+      const glm::vec3& vertex0,
+      const glm::vec3& vertex1,
+      const glm::vec3& vertex2) {
+    BuildTriangle& triangle = this->_triangles.emplace_back();
+    triangle.vertices = {vertex0, vertex1, vertex2};
+    triangle.min = glm::min(glm::min(vertex0, vertex1), vertex2);
+    triangle.max = glm::max(glm::max(vertex0, vertex1), vertex2);
+    triangle.centroid = (triangle.min + triangle.max) * 0.5f;
+  }
+
+  bool empty() const noexcept { return this->_triangles.empty(); }
+
+  // Builds the nodes for the triangles added since the last call, and appends
+  // their vertices to the hierarchy in leaf order. Returns the root node.
+  uint32_t build() {
+    uint32_t rootNode = uint32_t(this->_bvh._nodes.size());
+    this->_firstTriangle = this->_bvh._vertices.size() / 3;
+    this->buildNode(0, this->_triangles.size(), 0);
+
+    for (const BuildTriangle& triangle : this->_triangles) {
+      this->_bvh._vertices.insert(
+          this->_bvh._vertices.end(),
+          triangle.vertices.begin(),
+          triangle.vertices.end());
+    }
+    this->_triangles.clear();
+
+    return rootNode;
+  }
+
+private:
+  struct BuildTriangle {
+    std::array<glm::vec3, 3> vertices;
+    glm::vec3 min;
+    glm::vec3 max;
+    glm::vec3 centroid;
+  };
+
+  struct Bin {
+    glm::vec3 min{std::numeric_limits<float>::max()};
+    glm::vec3 max{std::numeric_limits<float>::lowest()};
+    size_t count = 0;
+  };
+
+  void buildNode(size_t begin, size_t end, uint32_t depth) {
+    size_t nodeIndex = this->_bvh._nodes.size();
+    Node& node = this->_bvh._nodes.emplace_back();
+
+    glm::vec3 min(std::numeric_limits<float>::max());
+    glm::vec3 max(std::numeric_limits<float>::lowest());
+    glm::vec3 centroidMin = min;
+    glm::vec3 centroidMax = max;
+    for (size_t i = begin; i < end; ++i) {
+      const BuildTriangle& triangle = this->_triangles[i];
+      min = glm::min(min, triangle.min);
+      max = glm::max(max, triangle.max);
+      centroidMin = glm::min(centroidMin, triangle.centroid);
+      centroidMax = glm::max(centroidMax, triangle.centroid);
+    }
+
+    glm::vec3 padding = (glm::abs(min) + glm::abs(max)) * boundsPadding;
+    node.min = min - padding;
+    node.max = max + padding;
+
+    size_t count = end - begin;
+    if (count <= maximumLeafTriangles || depth >= maximumDepth) {
+      node.offset = uint32_t(this->_firstTriangle + begin);
+      node.count = uint32_t(count);
+      return;
+    }
+
+    glm::vec3 centroidExtent = centroidMax - centroidMin;
+    glm::length_t axis = 0;
+    if (centroidExtent.y > centroidExtent[axis])
+      axis = 1;
+    if (centroidExtent.z > centroidExtent[axis])
+      axis = 2;
+
+    size_t middle = this->findSplit(
+        begin,
+        end,
+        axis,
+        centroidMin[axis],
+        centroidExtent[axis]);
+
+    // The node may have been invalidated by the recursion resizing the node
+    // vector, so refer to it by index from here on.
+    this->buildNode(begin, middle, depth + 1);
+    uint32_t secondChild = uint32_t(this->_bvh._nodes.size());
+    this->buildNode(middle, end, depth + 1);
+
+    this->_bvh._nodes[nodeIndex].offset = secondChild;
+    this->_bvh._nodes[nodeIndex].count = 0;
+  }
+
+  // Partitions the triangles in the range and returns the start of the second
+  // partition, which is never at either end of the range.
+  size_t findSplit(
+      size_t begin,
+      size_t end,
+      glm::length_t axis,
+      float centroidMin,
+      float centroidExtent) {
+    auto triangleBegin = this->_triangles.begin() + int64_t(begin);
+    auto triangleEnd = this->_triangles.begin() + int64_t(end);
+
+    float scale = float(binCount) / centroidExtent;
+    if (centroidExtent > 0.0f && std::isfinite(scale)) {
+      auto getBin = [axis, centroidMin, scale](const BuildTriangle& triangle) {
+        float position = (triangle.centroid[axis] - centroidMin) * scale;
+        return std::min(size_t(position), binCount - 1);
+      };
+
+      std::array<Bin, binCount> bins;
+      for (auto it = triangleBegin; it != triangleEnd; ++it) {
+        Bin& bin = bins[getBin(*it)];
+        bin.min = glm::min(bin.min, it->min);
+        bin.max = glm::max(bin.max, it->max);
+        ++bin.count;
+      }
+
+      // The cost of splitting before bin i is the sum of the half surface
+      // area of each side multiplied by the number of triangles on that side.
+      std::array<float, binCount> costs{};
+      Bin accumulated;
+      for (size_t i = 1; i < binCount; ++i) {
+        accumulated.min = glm::min(accumulated.min, bins[i - 1].min);
+        accumulated.max = glm::max(accumulated.max, bins[i - 1].max);
+        accumulated.count += bins[i - 1].count;
+        costs[i] = accumulated.count == 0
+                       ? 0.0f
+                       : halfSurfaceArea(accumulated.min, accumulated.max) *
+                             float(accumulated.count);
+      }
+
+      accumulated = Bin();
+      size_t bestSplit = 0;
+      float bestCost = std::numeric_limits<float>::max();
+      for (size_t i = binCount - 1; i > 0; --i) {
+        accumulated.min = glm::min(accumulated.min, bins[i].min);
+        accumulated.max = glm::max(accumulated.max, bins[i].max);
+        accumulated.count += bins[i].count;
+
+        size_t firstCount = end - begin - accumulated.count;
+        if (accumulated.count == 0 || firstCount == 0)
+          continue;
+
+        float cost = costs[i] +
+                     halfSurfaceArea(accumulated.min, accumulated.max) *
+                         float(accumulated.count);
+        if (cost < bestCost) {
+          bestCost = cost;
+          bestSplit = i;
+        }
+      }
+
+      if (bestSplit > 0) {
+        auto middle = std::partition(
+            triangleBegin,
+            triangleEnd,
+            [&getBin, bestSplit](const BuildTriangle& triangle) {
+              return getBin(triangle) < bestSplit;
+            });
+        return size_t(middle - this->_triangles.begin());
+      }
+    }
+
+    // All of the centroids are in the same place, so split the triangles
+    // evenly.
+    size_t middle = begin + (end - begin) / 2;
+    std::nth_element(
+        triangleBegin,
+        this->_triangles.begin() + int64_t(middle),
+        triangleEnd,
+        [axis](const BuildTriangle& a, const BuildTriangle& b) {
+          return a.centroid[axis] < b.centroid[axis];
+        });
+    return middle;
+  }
+
+  GltfTriangleBvh& _bvh;
+  std::vector<BuildTriangle> _triangles;
+  size_t _firstTriangle = 0;
+};
+
+GltfTriangleBvh::GltfTriangleBvh(const CesiumGltf::Model& gltf)
+    : _rtcTransform(GltfUtilities::applyRtcCenter(gltf, glm::dmat4x4(1.0))),
+      _upAxisTransform(
+          GltfUtilities::applyGltfUpAxisTransform(gltf, glm::dmat4x4(1.0))),
+      _primitives(),
+      _nodes(),
+      _vertices(),
+      _warnings() {
+  for (std::string_view unsupportedExtension :
+       intersectGltfUnsupportedExtensions) {
+    if (gltf.isExtensionRequired(std::string(unsupportedExtension))) {
+      this->_warnings.emplace_back(fmt::format(
+          "Cannot intersect a ray with a glTF model with the {} extension.",
+          unsupportedExtension));
+      return;
+    }
+  }
+
+  Builder builder(*this);
+
+  gltf.forEachPrimitiveInScene(
+      -1,
+      [this, &builder](
+          const Model& model,
+          const CesiumGltf::Node& /*node*/,
+          const Mesh& mesh,
+          const MeshPrimitive& primitive,
+          const glm::dmat4& nodeTransform) {
+        // Ignore non-triangles. Points and lines have no area to intersect
+        bool isTriangleMode =
+            primitive.mode == MeshPrimitive::Mode::TRIANGLES ||
+            primitive.mode == MeshPrimitive::Mode::TRIANGLE_STRIP ||
+            primitive.mode == MeshPrimitive::Mode::TRIANGLE_FAN;
+        if (!isTriangleMode)
+          return;
+
+        auto positionAccessorIt = primitive.attributes.find("POSITION");
+        if (positionAccessorIt == primitive.attributes.end()) {
+          this->_warnings.emplace_back(
+              "Skipping mesh without a position attribute");
+          return;
+        }
+        const Accessor* pPositionAccessor =
+            Model::getSafe(&model.accessors, positionAccessorIt->second);
+        if (!pPositionAccessor) {
+          this->_warnings.emplace_back(
+              "Skipping mesh with an invalid position accessor id");
+          return;
+        }
+        if (pPositionAccessor->type != AccessorSpec::Type::VEC3) {
+          this->_warnings.emplace_back(
+              "Skipping mesh with a non-vec3 position accessor");
+          return;
+        }
+
+        createPositionView(
+            model,
+            *pPositionAccessor,
+            [this, &builder, &model, &primitive](const auto& positionView) {
+              if (positionView.status() != AccessorViewStatus::Valid) {
+                this->_warnings.emplace_back(
+                    "Skipping mesh with an invalid position component type");
+                return;
+              }
+
+              int64_t positionsCount = positionView.size();
+              auto getPosition = [&positionView](int64_t index) {
+                const auto& value = positionView[index].value;
+                return glm::vec3(
+                    static_cast<float>(value[0]),
+                    static_cast<float>(value[1]),
+                    static_cast<float>(value[2]));
+              };
+
+              if (primitive.indices == -1) {
+                if (positionsCount < 3) {
+                  this->_warnings.emplace_back(
+                      "Skipping mesh with less than 3 vertex positions");
+                  return;
+                }
+
+                forEachTriangle(
+                    primitive.mode,
+                    positionsCount,
+                    [](int64_t i) { return i; },
+                    [&builder, &getPosition](int64_t a, int64_t b, int64_t c) {
+                      builder.addTriangle(
+                          getPosition(a),
+                          getPosition(b),
+                          getPosition(c));
+                    });
+                return;
+              }
+
+              const Accessor* pIndexAccessor =
+                  Model::getSafe(&model.accessors, primitive.indices);
+              if (!pIndexAccessor) {
+                this->_warnings.emplace_back(
+                    "Skipping mesh with an invalid index accessor id");
+                return;
+              }
+              if (pIndexAccessor->componentType ==
+                  Accessor::ComponentType::FLOAT) {
+                this->_warnings.emplace_back(
+                    "Skipping mesh with an invalid index component type");
+                return;
+              }
+
+              createAccessorView(
+                  model,
+                  *pIndexAccessor,
+                  [this, &builder, &primitive, &getPosition, positionsCount](
+                      const auto& indexView) {
+                    if (indexView.status() != AccessorViewStatus::Valid) {
+                      this->_warnings.emplace_back(
+                          "Could not create accessor view for mesh indices");
+                      return;
+                    }
+                    if (indexView.size() < 3) {
+                      this->_warnings.emplace_back(
+                          "Skipping indexed mesh with less than 3 indices");
+                      return;
+                    }
+
+                    bool foundInvalidIndex = false;
+                    forEachTriangle(
+                        primitive.mode,
+                        indexView.size(),
+                        [&indexView](int64_t i) {
+                          return static_cast<int64_t>(indexView[i].value[0]);
+                        },
+                        [&](int64_t a, int64_t b, int64_t c) {
+                          bool validIndices =
+                              a >= 0 && a < positionsCount && b >= 0 &&
+                              b < positionsCount && c >= 0 &&
+                              c < positionsCount;
+                          if (!validIndices) {
+                            foundInvalidIndex = true;
+                            return;
+                          }
+                          builder.addTriangle(
+                              getPosition(a),
+                              getPosition(b),
+                              getPosition(c));
+                        });
+
+                    if (foundInvalidIndex) {
+                      this->_warnings.emplace_back(
+                          "Found one or more invalid index values for indexed "
+                          "mesh");
+                    }
+                  });
+            });
+
+        if (builder.empty())
+          return;
+
+        this->_primitives.emplace_back(Primitive{
+            nodeTransform,
+            static_cast<int32_t>(&mesh - &model.meshes[0]),
+            static_cast<int32_t>(&primitive - &mesh.primitives[0]),
+            builder.build()});
+      });
+}
+
+GltfUtilities::IntersectResult GltfTriangleBvh::intersectRay(
+    const CesiumGeometry::Ray& ray,
+    bool cullBackFaces,
+    const glm::dmat4x4& gltfTransform) const {
+  GltfUtilities::IntersectResult result;
+  std::vector<std::optional<GltfUtilities::RayGltfHit>> hits =
+      this->intersectRays(
+          std::span<const Ray>(&ray, 1),
+          result.warnings,
+          cullBackFaces,
+          gltfTransform);
+  result.hit = std::move(hits[0]);
+  return result;
+}
+
+namespace {
+
+// The distance along each ray of a packet at which it was last hit, or -1.0 if
+// it has not been hit, and the origin and inverse direction used for ray / box
+// tests. These are kept in separate arrays so that the box tests of a whole
+// packet can be vectorized.
+struct RayPacket {
+  size_t count = 0;
+  std::array<double, rayPacketSize> tClosest;
+  std::array<double, rayPacketSize> originX;
+  std::array<double, rayPacketSize> originY;
+  std::array<double, rayPacketSize> originZ;
+  std::array<double, rayPacketSize> inverseDirectionX;
+  std::array<double, rayPacketSize> inverseDirectionY;
+  std::array<double, rayPacketSize> inverseDirectionZ;
+};
+
+// Avoids the infinities that would otherwise produce NaNs in the ray / box
+// test of a ray that is parallel to an axis and starts on a box face. The box
+// test may then be conservative, which the triangle test corrects.
+double safeInverse(double value) {
+  return value == 0.0 ? std::numeric_limits<double>::max() : 1.0 / value;
+}
+
+} // namespace
+
+std::vector<std::optional<GltfUtilities::RayGltfHit>>
+GltfTriangleBvh::intersectRays(
+    std::span<const CesiumGeometry::Ray> rays,
+    std::vector<std::string>& warnings,
+    bool cullBackFaces,
+    const glm::dmat4x4& gltfTransform) const {
+  warnings.insert(
+      warnings.end(),
+      this->_warnings.begin(),
+      this->_warnings.end());
+
+  std::vector<std::optional<GltfUtilities::RayGltfHit>> hits(rays.size());
+
+  glm::dmat4x4 rootTransform =
+      gltfTransform * this->_rtcTransform * this->_upAxisTransform;
+
+  // Returns the rays in the mask that enter the node before their closest hit
+  // so far, and the nearest distance at which any of them enters it.
+  auto intersectNode = [](const Node& node,
+                          const RayPacket& packet,
+                          uint64_t mask,
+                          double& tNearest) {
+    const double minX = double(node.min.x);
+    const double minY = double(node.min.y);
+    const double minZ = double(node.min.z);
+    const double maxX = double(node.max.x);
+    const double maxY = double(node.max.y);
+    const double maxZ = double(node.max.z);
+
+    uint64_t result = 0;
+    tNearest = std::numeric_limits<double>::max();
+    for (size_t i = 0; i < packet.count; ++i) {
+      double tMin = 0.0;
+      double tMax = packet.tClosest[i] < 0.0
+                        ? std::numeric_limits<double>::max()
+                        : packet.tClosest[i];
+
+      double t0 = (minX - packet.originX[i]) * packet.inverseDirectionX[i];
+      double t1 = (maxX - packet.originX[i]) * packet.inverseDirectionX[i];
+      tMin = std::max(tMin, std::min(t0, t1));
+      tMax = std::min(tMax, std::max(t0, t1));
+
+      t0 = (minY - packet.originY[i]) * packet.inverseDirectionY[i];
+      t1 = (maxY - packet.originY[i]) * packet.inverseDirectionY[i];
+      tMin = std::max(tMin, std::min(t0, t1));
+      tMax = std::min(tMax, std::max(t0, t1));
+
+      t0 = (minZ - packet.originZ[i]) * packet.inverseDirectionZ[i];
+      t1 = (maxZ - packet.originZ[i]) * packet.inverseDirectionZ[i];
+      tMin = std::max(tMin, std::min(t0, t1));
+      tMax = std::min(tMax, std::max(t0, t1));
+
+      bool hit = tMin <= tMax && ((mask >> i) & 1);
+      result |= uint64_t(hit) << i;
+      tNearest = hit ? std::min(tNearest, tMin) : tNearest;
+    }
+    return result;
+  };
+
+  std::vector<Ray> transformedRays;
+  transformedRays.reserve(std::min(rays.size(), rayPacketSize));
+
+  for (const Primitive& primitive : this->_primitives) {
+    glm::dmat4x4 primitiveToWorld = rootTransform * primitive.nodeTransform;
+    glm::dmat4x4 worldToPrimitive = glm::inverse(primitiveToWorld);
+
+    for (size_t packetStart = 0; packetStart < rays.size();
+         packetStart += rayPacketSize) {
+      RayPacket packet;
+      packet.count = std::min(rayPacketSize, rays.size() - packetStart);
+
+      transformedRays.clear();
+      for (size_t i = 0; i < packet.count; ++i) {
+        const Ray& transformedRay = transformedRays.emplace_back(
+            rays[packetStart + i].transform(worldToPrimitive));
+        const glm::dvec3& origin = transformedRay.getOrigin();
+        const glm::dvec3& direction = transformedRay.getDirection();
+        packet.tClosest[i] = -1.0;
+        packet.originX[i] = origin.x;
+        packet.originY[i] = origin.y;
+        packet.originZ[i] = origin.z;
+        packet.inverseDirectionX[i] = safeInverse(direction.x);
+        packet.inverseDirectionY[i] = safeInverse(direction.y);
+        packet.inverseDirectionZ[i] = safeInverse(direction.z);
+      }
+
+      uint64_t allRays = packet.count == rayPacketSize
+                             ? ~uint64_t(0)
+                             : (uint64_t(1) << packet.count) - 1;
+
+      std::array<std::pair<uint32_t, uint64_t>, maximumDepth + 1> stack;
+      size_t stackSize = 0;
+
+      double tNearest = 0.0;
+      uint64_t rootMask = intersectNode(
+          this->_nodes[primitive.rootNode],
+          packet,
+          allRays,
+          tNearest);
+      if (rootMask != 0)
+        stack[stackSize++] = {primitive.rootNode, rootMask};
+
+      while (stackSize > 0) {
+        auto [nodeIndex, mask] = stack[--stackSize];
+        const Node& node = this->_nodes[nodeIndex];
+
+        if (node.count > 0) {
+          for (uint32_t triangle = 0; triangle < node.count; ++triangle) {
+            size_t vertex = size_t(node.offset + triangle) * 3;
+            glm::dvec3 vertex0(this->_vertices[vertex]);
+            glm::dvec3 vertex1(this->_vertices[vertex + 1]);
+            glm::dvec3 vertex2(this->_vertices[vertex + 2]);
+
+            for (uint64_t remaining = mask; remaining != 0;
+                 remaining &= remaining - 1) {
+              size_t i = size_t(std::countr_zero(remaining));
+              std::optional<double> t =
+                  IntersectionTests::rayTriangleParametric(
+                      transformedRays[i],
+                      vertex0,
+                      vertex1,
+                      vertex2,
+                      cullBackFaces);
+              if (t && *t >= 0 &&
+                  (packet.tClosest[i] == -1.0 || *t < packet.tClosest[i]))
+                packet.tClosest[i] = *t;
+            }
+          }
+          continue;
+        }
+
+        // Visit the nearer child first, so that farther nodes can be culled by
+        // the closest hits found so far.
+        uint32_t first = nodeIndex + 1;
+        uint32_t second = node.offset;
+        double tFirst = 0.0;
+        double tSecond = 0.0;
+        uint64_t firstMask =
+            intersectNode(this->_nodes[first], packet, mask, tFirst);
+        uint64_t secondMask =
+            intersectNode(this->_nodes[second], packet, mask, tSecond);
+        if (firstMask != 0 && secondMask != 0) {
+          if (tSecond < tFirst) {
+            std::swap(first, second);
+            std::swap(firstMask, secondMask);
+          }
+          stack[stackSize++] = {second, secondMask};
+          stack[stackSize++] = {first, firstMask};
+        } else if (firstMask != 0) {
+          stack[stackSize++] = {first, firstMask};
+        } else if (secondMask != 0) {
+          stack[stackSize++] = {second, secondMask};
+        }
+      }
+
+      for (size_t i = 0; i < packet.count; ++i) {
+        double tClosest = packet.tClosest[i];
+        if (tClosest == -1.0)
+          continue;
+
+        const Ray& ray = rays[packetStart + i];
+        glm::dvec3 primitivePoint =
+            transformedRays[i].pointFromDistance(tClosest);
+
+        // Normalize the homogeneous coordinates
+        // Ex. transformed by projection matrx
+        glm::dvec4 homogeneousWorldPoint =
+            primitiveToWorld * glm::dvec4(primitivePoint, 1.0);
+        bool needsWDivide =
+            homogeneousWorldPoint.w != 1.0 && homogeneousWorldPoint.w != 0.0;
+        if (needsWDivide) {
+          homogeneousWorldPoint.x /= homogeneousWorldPoint.w;
+          homogeneousWorldPoint.y /= homogeneousWorldPoint.w;
+          homogeneousWorldPoint.z /= homogeneousWorldPoint.w;
+        }
+        glm::dvec3 worldPoint(
+            homogeneousWorldPoint.x,
+            homogeneousWorldPoint.y,
+            homogeneousWorldPoint.z);
+
+        glm::dvec3 rayToWorldPoint = worldPoint - ray.getOrigin();
+        double rayToWorldPointDistanceSq =
+            glm::dot(rayToWorldPoint, rayToWorldPoint);
+
+        std::optional<GltfUtilities::RayGltfHit>& hit =
+            hits[packetStart + i];
+        if (!hit ||
+            rayToWorldPointDistanceSq < hit->rayToWorldPointDistanceSq) {
+          hit = GltfUtilities::RayGltfHit{
+              primitivePoint,
+              primitiveToWorld,
+              worldPoint,
+              rayToWorldPointDistanceSq,
+              primitive.meshId,
+              primitive.primitiveId};
+        }
+      }
+    }
+  }
+
+  return hits;
+}
+
+int64_t GltfTriangleBvh::getSizeBytes() const noexcept {
+  int64_t size = int64_t(sizeof(GltfTriangleBvh));
+  size += int64_t(this->_primitives.capacity() * sizeof(Primitive));
+  size += int64_t(this->_nodes.capacity() * sizeof(Node));
+  size += int64_t(this->_vertices.capacity() * sizeof(glm::vec3));
+  for (const std::string& warning : this->_warnings) {
+    size += int64_t(sizeof(std::string) + warning.capacity());
+  }
+  return size;
+}
+
+} // namespace CesiumGltfContent
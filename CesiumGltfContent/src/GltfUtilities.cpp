@@ -1,3 +1,5 @@
+#include "IntersectGltfUnsupportedExtensions.h"
+
 #include <CesiumGeometry/Axis.h>
 #include <CesiumGeometry/IntersectionTests.h>
 #include <CesiumGeometry/Ray.h>
@@ -26,6 +28,8 @@
 #include <algorithm>
 #include <array>
 #include <cstring>
+#include <string>
+#include <string_view>
 #include <unordered_set>
 #include <vector>
 
@@ -199,6 +203,12 @@ GltfUtilities::computeBoundingRegion(
           const CesiumGltf::Mesh& /*mesh*/,
           const CesiumGltf::MeshPrimitive& primitive,
           const glm::dmat4& nodeTransform) {
+        // The positions of a primitive that was left Draco-compressed cannot
+        // be read.
+        if (primitive.hasExtension<ExtensionKhrDracoMeshCompression>()) {
+          return;
+        }
+
         auto positionIt = primitive.attributes.find("POSITION");
         if (positionIt == primitive.attributes.end()) {
           return;
@@ -1068,6 +1078,59 @@ void GltfUtilities::compactBuffers(CesiumGltf::Model& gltf) {
   }
 }
 
+int64_t
+GltfUtilities::computeCompressedMeshByteSavings(const CesiumGltf::Model& gltf) {
+  int64_t savings = 0;
+
+  for (const Mesh& mesh : gltf.meshes) {
+    for (const MeshPrimitive& primitive : mesh.primitives) {
+      const ExtensionKhrDracoMeshCompression* pDraco =
+          primitive.getExtension<ExtensionKhrDracoMeshCompression>();
+      if (!pDraco) {
+        continue;
+      }
+
+      const BufferView* pCompressedBufferView =
+          Model::getSafe(&gltf.bufferViews, pDraco->bufferView);
+      if (!pCompressedBufferView) {
+        continue;
+      }
+
+      int64_t decodedBytes = 0;
+
+      const Accessor* pIndices =
+          Model::getSafe(&gltf.accessors, primitive.indices);
+      if (pIndices) {
+        decodedBytes += pIndices->count * pIndices->computeBytesPerVertex();
+      }
+
+      for (const auto& [name, dracoId] : pDraco->attributes) {
+        auto it = primitive.attributes.find(name);
+        if (it == primitive.attributes.end()) {
+          continue;
+        }
+
+        const Accessor* pAccessor = Model::getSafe(&gltf.accessors, it->second);
+        if (pAccessor) {
+          decodedBytes += pAccessor->count * pAccessor->computeBytesPerVertex();
+        }
+      }
+
+      savings += decodedBytes - pCompressedBufferView->byteLength;
+    }
+  }
+
+  for (const BufferView& bufferView : gltf.bufferViews) {
+    const ExtensionBufferViewExtMeshoptCompression* pMeshOpt =
+        bufferView.getExtension<ExtensionBufferViewExtMeshoptCompression>();
+    if (pMeshOpt) {
+      savings += pMeshOpt->count * pMeshOpt->byteStride - pMeshOpt->byteLength;
+    }
+  }
+
+  return savings;
+}
+
 namespace {
 
 void deleteBufferRange(
@@ -1377,12 +1440,6 @@ std::optional<glm::dvec3> intersectRayScenePrimitive(
   return transformedRay.pointFromDistance(tClosest);
 }
 
-std::string intersectGltfUnsupportedExtensions[] = {
-    ExtensionKhrDracoMeshCompression::ExtensionName,
-    ExtensionBufferViewExtMeshoptCompression::ExtensionName,
-    ExtensionExtMeshGpuInstancing::ExtensionName,
-    "KHR_mesh_quantization"};
-
 } // namespace
 
 GltfUtilities::IntersectResult GltfUtilities::intersectRayGltfModel(
@@ -1392,9 +1449,9 @@ GltfUtilities::IntersectResult GltfUtilities::intersectRayGltfModel(
     const glm::dmat4x4& gltfTransform) {
   // We can't currently intersect a ray with a model if the model has any funny
   // business with its vertex positions or if it uses instancing.
-  for (const std::string& unsupportedExtension :
+  for (std::string_view unsupportedExtension :
        intersectGltfUnsupportedExtensions) {
-    if (gltf.isExtensionRequired(unsupportedExtension)) {
+    if (gltf.isExtensionRequired(std::string(unsupportedExtension))) {
       return IntersectResult{
           std::nullopt,
           {fmt::format(
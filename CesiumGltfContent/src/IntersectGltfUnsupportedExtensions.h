@@ -0,0 +1,27 @@
+#pragma once
+
+#include <CesiumGltf/ExtensionBufferViewExtMeshoptCompression.h>
+#include <CesiumGltf/ExtensionExtMeshGpuInstancing.h>
+#include <CesiumGltf/ExtensionKhrDracoMeshCompression.h>
+
+#include <array>
+#include <string_view>
+
+namespace CesiumGltfContent {
+
+/**
+ * @brief The required extensions that prevent a ray from being intersected
+ * with a glTF model, because they change its vertex positions or instance it.
+ *
+ * Both {@link GltfUtilities::intersectRayGltfModel} and
+ * {@link GltfTriangleBvh} reject models that require any of these, so that
+ * they always accept the same models.
+ */
+inline constexpr std::array<std::string_view, 4>
+    intersectGltfUnsupportedExtensions = {
+        CesiumGltf::ExtensionKhrDracoMeshCompression::ExtensionName,
+        CesiumGltf::ExtensionBufferViewExtMeshoptCompression::ExtensionName,
+        CesiumGltf::ExtensionExtMeshGpuInstancing::ExtensionName,
+        "KHR_mesh_quantization"};
+
+} // namespace CesiumGltfContent
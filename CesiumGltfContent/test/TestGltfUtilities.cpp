@@ -1,5 +1,6 @@
 #include <CesiumGltf/ExtensionBufferExtMeshoptCompression.h>
 #include <CesiumGltf/ExtensionBufferViewExtMeshoptCompression.h>
+#include <CesiumGltf/ExtensionKhrDracoMeshCompression.h>
 #include <CesiumGltf/Model.h>
 #include <CesiumGltf/Node.h>
 #include <CesiumGltfContent/GltfUtilities.h>
@@ -705,3 +706,54 @@ TEST_CASE("GltfUtilities::collapseToSingleBuffer") {
     CHECK(m.bufferViews[2].byteLength == 100);
   }
 }
+
+TEST_CASE("GltfUtilities::computeCompressedMeshByteSavings") {
+  Model m;
+
+  SECTION("returns zero for a model without compressed mesh data") {
+    BufferView& bv = m.bufferViews.emplace_back();
+    bv.byteLength = 100;
+
+    CHECK(GltfUtilities::computeCompressedMeshByteSavings(m) == 0);
+  }
+
+  SECTION("counts meshopt-compressed buffer views") {
+    BufferView& bv = m.bufferViews.emplace_back();
+    bv.byteLength = 1200;
+    ExtensionBufferViewExtMeshoptCompression& meshOpt =
+        bv.addExtension<ExtensionBufferViewExtMeshoptCompression>();
+    meshOpt.byteLength = 300;
+    meshOpt.byteStride = 12;
+    meshOpt.count = 100;
+
+    CHECK(GltfUtilities::computeCompressedMeshByteSavings(m) == 900);
+  }
+
+  SECTION("counts Draco-compressed primitives") {
+    BufferView& compressed = m.bufferViews.emplace_back();
+    compressed.byteLength = 200;
+
+    Accessor& indices = m.accessors.emplace_back();
+    indices.componentType = Accessor::ComponentType::UNSIGNED_SHORT;
+    indices.type = Accessor::Type::SCALAR;
+    indices.count = 300;
+
+    Accessor& position = m.accessors.emplace_back();
+    position.componentType = Accessor::ComponentType::FLOAT;
+    position.type = Accessor::Type::VEC3;
+    position.count = 100;
+
+    MeshPrimitive& primitive =
+        m.meshes.emplace_back().primitives.emplace_back();
+    primitive.indices = 0;
+    primitive.attributes["POSITION"] = 1;
+
+    ExtensionKhrDracoMeshCompression& draco =
+        primitive.addExtension<ExtensionKhrDracoMeshCompression>();
+    draco.bufferView = 0;
+    draco.attributes["POSITION"] = 0;
+
+    // 300 * 2 bytes of indices plus 100 * 12 bytes of positions.
+    CHECK(GltfUtilities::computeCompressedMeshByteSavings(m) == 1600);
+  }
+}
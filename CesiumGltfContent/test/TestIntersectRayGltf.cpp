@@ -1,17 +1,23 @@
 #include "CesiumGeometry/IntersectionTests.h"
 #include "CesiumGeometry/Ray.h"
+#include "CesiumGltfContent/GltfTriangleBvh.h"
 #include "CesiumGltfContent/GltfUtilities.h"
 #include "CesiumGltfReader/GltfReader.h"
 
+#include <CesiumGeometry/Axis.h>
 #include <CesiumNativeTests/readFile.h>
 #include <CesiumUtility/Math.h>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <glm/glm.hpp>
 
+#include <cmath>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <random>
 
 using namespace CesiumUtility;
 using namespace CesiumGltf;
@@ -19,6 +25,20 @@ using namespace CesiumGeometry;
 using namespace CesiumGltfReader;
 using namespace CesiumGltfContent;
 
+void checkBvhMatchesBruteForce(
+    const GltfUtilities::IntersectResult& bruteForceResult,
+    const GltfUtilities::IntersectResult& bvhResult) {
+  REQUIRE(bvhResult.hit.has_value() == bruteForceResult.hit.has_value());
+  if (!bvhResult.hit.has_value())
+    return;
+
+  CHECK(glm::all(glm::lessThan(
+      glm::abs(bvhResult.hit->worldPoint - bruteForceResult.hit->worldPoint),
+      glm::dvec3(CesiumUtility::Math::Epsilon9))));
+  CHECK(bvhResult.hit->meshId == bruteForceResult.hit->meshId);
+  CHECK(bvhResult.hit->primitiveId == bruteForceResult.hit->primitiveId);
+}
+
 void checkIntersection(
     const Ray& ray,
     const Model& model,
@@ -33,6 +53,10 @@ void checkIntersection(
           cullBackFaces,
           modelToWorld);
 
+  checkBvhMatchesBruteForce(
+      hitResult,
+      GltfTriangleBvh(model).intersectRay(ray, cullBackFaces, modelToWorld));
+
   if (shouldHit) {
     CHECK(hitResult.hit.has_value());
     if (!hitResult.hit.has_value())
@@ -97,6 +121,14 @@ void checkBadUnitCube(const std::string& testModelName, bool shouldHitAnyway) {
   // and we should get some warnings about that
   CHECK(hitResult.warnings.size() > 0);
 
+  GltfUtilities::IntersectResult bvhResult =
+      GltfTriangleBvh(testModel).intersectRay(
+          Ray(glm::dvec3(0.0, 0.0, 2.0), glm::dvec3(0.0, 0.0, -1.0)),
+          true,
+          glm::dmat4x4(1.0));
+  CHECK(bvhResult.warnings.size() > 0);
+  CHECK(bvhResult.hit.has_value() == hitResult.hit.has_value());
+
   // Check for a bad model that is mostly good, and should produce good results
   if (shouldHitAnyway) {
     CHECK(hitResult.hit.has_value());
@@ -225,3 +257,206 @@ TEST_CASE("GltfUtilities::intersectRayGltfModel") {
   checkBadUnitCube("cubeInvalidVertCount.glb", false);
   checkBadUnitCube("cubeSomeBadIndices.glb", true);
 }
+
+namespace {
+
+// Creates a model with a single indexed primitive in the shape of a bumpy
+// square grid of terrain, with z up and its corner at the origin.
+Model createTerrainGrid(uint32_t verticesPerSide) {
+  std::vector<glm::vec3> positions;
+  positions.reserve(size_t(verticesPerSide) * verticesPerSide);
+  for (uint32_t y = 0; y < verticesPerSide; ++y) {
+    for (uint32_t x = 0; x < verticesPerSide; ++x) {
+      float height = std::sin(float(x) * 0.3f) * std::cos(float(y) * 0.2f);
+      positions.emplace_back(float(x), float(y), height);
+    }
+  }
+
+  std::vector<uint32_t> indices;
+  for (uint32_t y = 0; y + 1 < verticesPerSide; ++y) {
+    for (uint32_t x = 0; x + 1 < verticesPerSide; ++x) {
+      uint32_t index = y * verticesPerSide + x;
+      indices.insert(
+          indices.end(),
+          {index,
+           index + 1,
+           index + verticesPerSide,
+           index + 1,
+           index + verticesPerSide + 1,
+           index + verticesPerSide});
+    }
+  }
+
+  Model model;
+  model.extras["gltfUpAxis"] = int64_t(CesiumGeometry::Axis::Z);
+
+  Buffer& buffer = model.buffers.emplace_back();
+  size_t positionsBytes = positions.size() * sizeof(glm::vec3);
+  size_t indicesBytes = indices.size() * sizeof(uint32_t);
+  buffer.cesium.data.resize(positionsBytes + indicesBytes);
+  std::memcpy(buffer.cesium.data.data(), positions.data(), positionsBytes);
+  std::memcpy(
+      buffer.cesium.data.data() + positionsBytes,
+      indices.data(),
+      indicesBytes);
+  buffer.byteLength = int64_t(buffer.cesium.data.size());
+
+  BufferView& positionsView = model.bufferViews.emplace_back();
+  positionsView.buffer = 0;
+  positionsView.byteLength = int64_t(positionsBytes);
+
+  BufferView& indicesView = model.bufferViews.emplace_back();
+  indicesView.buffer = 0;
+  indicesView.byteOffset = int64_t(positionsBytes);
+  indicesView.byteLength = int64_t(indicesBytes);
+
+  Accessor& positionAccessor = model.accessors.emplace_back();
+  positionAccessor.bufferView = 0;
+  positionAccessor.count = int64_t(positions.size());
+  positionAccessor.componentType = Accessor::ComponentType::FLOAT;
+  positionAccessor.type = Accessor::Type::VEC3;
+
+  Accessor& indexAccessor = model.accessors.emplace_back();
+  indexAccessor.bufferView = 1;
+  indexAccessor.count = int64_t(indices.size());
+  indexAccessor.componentType = Accessor::ComponentType::UNSIGNED_INT;
+  indexAccessor.type = Accessor::Type::SCALAR;
+
+  MeshPrimitive& primitive =
+      model.meshes.emplace_back().primitives.emplace_back();
+  primitive.attributes["POSITION"] = 0;
+  primitive.indices = 1;
+  primitive.mode = MeshPrimitive::Mode::TRIANGLES;
+
+  return model;
+}
+
+// Creates rays that point mostly down at the terrain grid.
+std::vector<Ray>
+createRaysAtTerrainGrid(uint32_t verticesPerSide, size_t count) {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> position(
+      -1.0,
+      double(verticesPerSide));
+  std::uniform_real_distribution<double> tilt(-0.5, 0.5);
+
+  std::vector<Ray> rays;
+  rays.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    rays.emplace_back(
+        glm::dvec3(position(generator), position(generator), 10.0),
+        glm::normalize(glm::dvec3(tilt(generator), tilt(generator), -1.0)));
+  }
+  return rays;
+}
+
+} // namespace
+
+TEST_CASE("GltfTriangleBvh") {
+  SECTION("matches intersectRayGltfModel on a terrain grid") {
+    const uint32_t verticesPerSide = 65;
+    Model model = createTerrainGrid(verticesPerSide);
+    GltfTriangleBvh bvh(model);
+    CHECK(bvh.getTriangleCount() == 64 * 64 * 2);
+    CHECK(bvh.getSizeBytes() > 0);
+
+    glm::dmat4x4 transform(1.0);
+    transform[3] = glm::dvec4(100.0, -50.0, 3.0, 1.0);
+
+    size_t hits = 0;
+    for (const Ray& ray : createRaysAtTerrainGrid(verticesPerSide, 1000)) {
+      for (bool cullBackFaces : {true, false}) {
+        Ray transformedRay(
+            ray.getOrigin() + glm::dvec3(transform[3]),
+            ray.getDirection());
+        GltfUtilities::IntersectResult bruteForceResult =
+            GltfUtilities::intersectRayGltfModel(
+                transformedRay,
+                model,
+                cullBackFaces,
+                transform);
+        GltfUtilities::IntersectResult bvhResult =
+            bvh.intersectRay(transformedRay, cullBackFaces, transform);
+        checkBvhMatchesBruteForce(bruteForceResult, bvhResult);
+        if (bvhResult.hit)
+          ++hits;
+      }
+    }
+
+    // Some rays start outside the grid and miss it, but most hit.
+    CHECK(hits > 1000);
+    CHECK(hits < 2000);
+  }
+
+  SECTION("intersects packets of rays like individual rays") {
+    const uint32_t verticesPerSide = 33;
+    Model model = createTerrainGrid(verticesPerSide);
+    GltfTriangleBvh bvh(model);
+
+    // More than one packet, with the last one partially full.
+    std::vector<Ray> rays = createRaysAtTerrainGrid(verticesPerSide, 1000);
+
+    std::vector<std::string> warnings;
+    std::vector<std::optional<GltfUtilities::RayGltfHit>> hits =
+        bvh.intersectRays(rays, warnings, false);
+    CHECK(warnings.empty());
+    REQUIRE(hits.size() == rays.size());
+
+    for (size_t i = 0; i < rays.size(); ++i) {
+      GltfUtilities::IntersectResult result = bvh.intersectRay(rays[i], false);
+      REQUIRE(hits[i].has_value() == result.hit.has_value());
+      if (hits[i]) {
+        CHECK(hits[i]->worldPoint == result.hit->worldPoint);
+      }
+    }
+  }
+
+  SECTION("reports warnings for models it cannot intersect") {
+    Model model = createTerrainGrid(3);
+    model.extensionsRequired.emplace_back("KHR_draco_mesh_compression");
+
+    GltfTriangleBvh bvh(model);
+    CHECK(bvh.getTriangleCount() == 0);
+
+    GltfUtilities::IntersectResult result = bvh.intersectRay(
+        Ray(glm::dvec3(1.0, 1.0, 10.0), glm::dvec3(0.0, 0.0, -1.0)));
+    CHECK(!result.hit);
+    REQUIRE(result.warnings.size() == 1);
+    CHECK(
+        result.warnings[0].find("KHR_draco_mesh_compression") !=
+        std::string::npos);
+  }
+}
+
+TEST_CASE("GltfTriangleBvh throughput", "[.][benchmark]") {
+  const uint32_t verticesPerSide = 129;
+  Model model = createTerrainGrid(verticesPerSide);
+  const std::vector<Ray> rays =
+      createRaysAtTerrainGrid(verticesPerSide, 10000);
+  GltfTriangleBvh bvh(model);
+
+  BENCHMARK("build") { return GltfTriangleBvh(model).getTriangleCount(); };
+
+  BENCHMARK("10k rays with GltfTriangleBvh") {
+    size_t hits = 0;
+    for (const Ray& ray : rays) {
+      if (bvh.intersectRay(ray).hit)
+        ++hits;
+    }
+    return hits;
+  };
+
+  BENCHMARK("10k rays in packets with GltfTriangleBvh") {
+    std::vector<std::string> warnings;
+    return bvh.intersectRays(rays, warnings).size();
+  };
+
+  BENCHMARK("10k rays with intersectRayGltfModel") {
+    size_t hits = 0;
+    for (const Ray& ray : rays) {
+      if (GltfUtilities::intersectRayGltfModel(ray, model).hit)
+        ++hits;
+    }
+    return hits;
+  };
+}
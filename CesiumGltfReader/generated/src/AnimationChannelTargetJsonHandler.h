@@ -27,7 +27,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyAnimationChannelTarget(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumGltf::AnimationChannelTarget& o);
 
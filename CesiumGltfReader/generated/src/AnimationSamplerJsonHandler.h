@@ -26,7 +26,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyAnimationSampler(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumGltf::AnimationSampler& o);
 
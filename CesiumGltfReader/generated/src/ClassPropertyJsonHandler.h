@@ -27,7 +27,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyClassProperty(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumGltf::ClassProperty& o);
 
@@ -25,7 +25,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyEnumValue(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumGltf::EnumValue& o);
 
@@ -36,7 +36,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyExtensionBufferExtMeshoptCompression(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumGltf::ExtensionBufferExtMeshoptCompression& o);
 
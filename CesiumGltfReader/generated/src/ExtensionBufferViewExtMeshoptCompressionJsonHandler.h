@@ -37,7 +37,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyExtensionBufferViewExtMeshoptCompression(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumGltf::ExtensionBufferViewExtMeshoptCompression& o);
 
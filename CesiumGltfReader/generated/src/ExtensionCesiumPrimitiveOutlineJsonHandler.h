@@ -36,7 +36,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyExtensionCesiumPrimitiveOutline(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumGltf::ExtensionCesiumPrimitiveOutline& o);
 
@@ -36,7 +36,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyExtensionCesiumRTC(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumGltf::ExtensionCesiumRTC& o);
 
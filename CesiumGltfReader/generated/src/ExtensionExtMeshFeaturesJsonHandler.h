@@ -38,7 +38,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyExtensionExtMeshFeatures(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumGltf::ExtensionExtMeshFeatures& o);
 
@@ -37,7 +37,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyExtensionExtMeshGpuInstancing(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumGltf::ExtensionExtMeshGpuInstancing& o);
 
@@ -38,7 +38,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyExtensionExtStructuralMetadata(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumGltf::ExtensionExtStructuralMetadata& o);
 
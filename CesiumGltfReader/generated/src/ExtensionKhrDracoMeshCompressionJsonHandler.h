@@ -37,7 +37,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyExtensionKhrDracoMeshCompression(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumGltf::ExtensionKhrDracoMeshCompression& o);
 
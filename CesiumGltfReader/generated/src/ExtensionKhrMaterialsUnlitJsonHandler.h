@@ -35,7 +35,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyExtensionKhrMaterialsUnlit(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumGltf::ExtensionKhrMaterialsUnlit& o);
 
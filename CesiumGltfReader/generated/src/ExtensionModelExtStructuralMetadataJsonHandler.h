@@ -42,7 +42,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyExtensionModelExtStructuralMetadata(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumGltf::ExtensionModelExtStructuralMetadata& o);
 
@@ -39,7 +39,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyExtensionModelMaxarMeshVariants(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumGltf::ExtensionModelMaxarMeshVariants& o);
 
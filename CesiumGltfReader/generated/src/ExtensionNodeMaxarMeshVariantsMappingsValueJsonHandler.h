@@ -28,7 +28,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyExtensionNodeMaxarMeshVariantsMappingsValue(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumGltf::ExtensionNodeMaxarMeshVariantsMappingsValue& o);
 
@@ -26,7 +26,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyFeatureIdTexture(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumGltf::FeatureIdTexture& o);
 
@@ -59,12 +59,12 @@ void ExtensionCesiumRTCJsonHandler::reset(
 
 CesiumJsonReader::IJsonHandler*
 ExtensionCesiumRTCJsonHandler::readObjectKeyExtensionCesiumRTC(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::ExtensionCesiumRTC& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("center"s == str) {
+  if ("center"sv == str) {
     return property("center", this->_center, o.center);
   }
 
@@ -175,21 +175,21 @@ void ExtensionCesiumTileEdgesJsonHandler::reset(
 
 CesiumJsonReader::IJsonHandler*
 ExtensionCesiumTileEdgesJsonHandler::readObjectKeyExtensionCesiumTileEdges(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::ExtensionCesiumTileEdges& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("left"s == str) {
+  if ("left"sv == str) {
     return property("left", this->_left, o.left);
   }
-  if ("bottom"s == str) {
+  if ("bottom"sv == str) {
     return property("bottom", this->_bottom, o.bottom);
   }
-  if ("right"s == str) {
+  if ("right"sv == str) {
     return property("right", this->_right, o.right);
   }
-  if ("top"s == str) {
+  if ("top"sv == str) {
     return property("top", this->_top, o.top);
   }
 
@@ -301,12 +301,12 @@ void ExtensionExtInstanceFeaturesJsonHandler::reset(
 
 CesiumJsonReader::IJsonHandler* ExtensionExtInstanceFeaturesJsonHandler::
     readObjectKeyExtensionExtInstanceFeatures(
-        const std::string& objectType,
+        const std::string_view& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionExtInstanceFeatures& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("featureIds"s == str) {
+  if ("featureIds"sv == str) {
     return property("featureIds", this->_featureIds, o.featureIds);
   }
 
@@ -417,12 +417,12 @@ void ExtensionExtMeshFeaturesJsonHandler::reset(
 
 CesiumJsonReader::IJsonHandler*
 ExtensionExtMeshFeaturesJsonHandler::readObjectKeyExtensionExtMeshFeatures(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::ExtensionExtMeshFeatures& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("featureIds"s == str) {
+  if ("featureIds"sv == str) {
     return property("featureIds", this->_featureIds, o.featureIds);
   }
 
@@ -533,12 +533,12 @@ void ExtensionExtMeshGpuInstancingJsonHandler::reset(
 
 CesiumJsonReader::IJsonHandler* ExtensionExtMeshGpuInstancingJsonHandler::
     readObjectKeyExtensionExtMeshGpuInstancing(
-        const std::string& objectType,
+        const std::string_view& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionExtMeshGpuInstancing& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("attributes"s == str) {
+  if ("attributes"sv == str) {
     return property("attributes", this->_attributes, o.attributes);
   }
 
@@ -651,12 +651,12 @@ void ExtensionBufferExtMeshoptCompressionJsonHandler::reset(
 CesiumJsonReader::IJsonHandler*
 ExtensionBufferExtMeshoptCompressionJsonHandler::
     readObjectKeyExtensionBufferExtMeshoptCompression(
-        const std::string& objectType,
+        const std::string_view& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionBufferExtMeshoptCompression& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("fallback"s == str) {
+  if ("fallback"sv == str) {
     return property("fallback", this->_fallback, o.fallback);
   }
 
@@ -781,30 +781,30 @@ void ExtensionBufferViewExtMeshoptCompressionJsonHandler::reset(
 CesiumJsonReader::IJsonHandler*
 ExtensionBufferViewExtMeshoptCompressionJsonHandler::
     readObjectKeyExtensionBufferViewExtMeshoptCompression(
-        const std::string& objectType,
+        const std::string_view& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionBufferViewExtMeshoptCompression& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("buffer"s == str) {
+  if ("buffer"sv == str) {
     return property("buffer", this->_buffer, o.buffer);
   }
-  if ("byteOffset"s == str) {
+  if ("byteOffset"sv == str) {
     return property("byteOffset", this->_byteOffset, o.byteOffset);
   }
-  if ("byteLength"s == str) {
+  if ("byteLength"sv == str) {
     return property("byteLength", this->_byteLength, o.byteLength);
   }
-  if ("byteStride"s == str) {
+  if ("byteStride"sv == str) {
     return property("byteStride", this->_byteStride, o.byteStride);
   }
-  if ("count"s == str) {
+  if ("count"sv == str) {
     return property("count", this->_count, o.count);
   }
-  if ("mode"s == str) {
+  if ("mode"sv == str) {
     return property("mode", this->_mode, o.mode);
   }
-  if ("filter"s == str) {
+  if ("filter"sv == str) {
     return property("filter", this->_filter, o.filter);
   }
 
@@ -920,15 +920,15 @@ void ExtensionExtStructuralMetadataJsonHandler::reset(
 
 CesiumJsonReader::IJsonHandler* ExtensionExtStructuralMetadataJsonHandler::
     readObjectKeyExtensionExtStructuralMetadata(
-        const std::string& objectType,
+        const std::string_view& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionExtStructuralMetadata& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("class"s == str) {
+  if ("class"sv == str) {
     return property("class", this->_classProperty, o.classProperty);
   }
-  if ("properties"s == str) {
+  if ("properties"sv == str) {
     return property("properties", this->_properties, o.properties);
   }
 
@@ -1045,27 +1045,27 @@ void ExtensionModelExtStructuralMetadataJsonHandler::reset(
 
 CesiumJsonReader::IJsonHandler* ExtensionModelExtStructuralMetadataJsonHandler::
     readObjectKeyExtensionModelExtStructuralMetadata(
-        const std::string& objectType,
+        const std::string_view& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionModelExtStructuralMetadata& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("schema"s == str) {
+  if ("schema"sv == str) {
     return property("schema", this->_schema, o.schema);
   }
-  if ("schemaUri"s == str) {
+  if ("schemaUri"sv == str) {
     return property("schemaUri", this->_schemaUri, o.schemaUri);
   }
-  if ("propertyTables"s == str) {
+  if ("propertyTables"sv == str) {
     return property("propertyTables", this->_propertyTables, o.propertyTables);
   }
-  if ("propertyTextures"s == str) {
+  if ("propertyTextures"sv == str) {
     return property(
         "propertyTextures",
         this->_propertyTextures,
         o.propertyTextures);
   }
-  if ("propertyAttributes"s == str) {
+  if ("propertyAttributes"sv == str) {
     return property(
         "propertyAttributes",
         this->_propertyAttributes,
@@ -1188,18 +1188,18 @@ void ExtensionMeshPrimitiveExtStructuralMetadataJsonHandler::reset(
 CesiumJsonReader::IJsonHandler*
 ExtensionMeshPrimitiveExtStructuralMetadataJsonHandler::
     readObjectKeyExtensionMeshPrimitiveExtStructuralMetadata(
-        const std::string& objectType,
+        const std::string_view& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionMeshPrimitiveExtStructuralMetadata& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("propertyTextures"s == str) {
+  if ("propertyTextures"sv == str) {
     return property(
         "propertyTextures",
         this->_propertyTextures,
         o.propertyTextures);
   }
-  if ("propertyAttributes"s == str) {
+  if ("propertyAttributes"sv == str) {
     return property(
         "propertyAttributes",
         this->_propertyAttributes,
@@ -1321,15 +1321,15 @@ void ExtensionKhrDracoMeshCompressionJsonHandler::reset(
 
 CesiumJsonReader::IJsonHandler* ExtensionKhrDracoMeshCompressionJsonHandler::
     readObjectKeyExtensionKhrDracoMeshCompression(
-        const std::string& objectType,
+        const std::string_view& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionKhrDracoMeshCompression& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("bufferView"s == str) {
+  if ("bufferView"sv == str) {
     return property("bufferView", this->_bufferView, o.bufferView);
   }
-  if ("attributes"s == str) {
+  if ("attributes"sv == str) {
     return property("attributes", this->_attributes, o.attributes);
   }
 
@@ -1440,10 +1440,10 @@ void ExtensionKhrMaterialsUnlitJsonHandler::reset(
 
 CesiumJsonReader::IJsonHandler*
 ExtensionKhrMaterialsUnlitJsonHandler::readObjectKeyExtensionKhrMaterialsUnlit(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::ExtensionKhrMaterialsUnlit& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
   (void)o;
 
@@ -1556,12 +1556,12 @@ void ExtensionModelKhrMaterialsVariantsJsonHandler::reset(
 
 CesiumJsonReader::IJsonHandler* ExtensionModelKhrMaterialsVariantsJsonHandler::
     readObjectKeyExtensionModelKhrMaterialsVariants(
-        const std::string& objectType,
+        const std::string_view& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionModelKhrMaterialsVariants& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("variants"s == str) {
+  if ("variants"sv == str) {
     return property("variants", this->_variants, o.variants);
   }
 
@@ -1678,12 +1678,12 @@ void ExtensionMeshPrimitiveKhrMaterialsVariantsJsonHandler::reset(
 CesiumJsonReader::IJsonHandler*
 ExtensionMeshPrimitiveKhrMaterialsVariantsJsonHandler::
     readObjectKeyExtensionMeshPrimitiveKhrMaterialsVariants(
-        const std::string& objectType,
+        const std::string_view& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionMeshPrimitiveKhrMaterialsVariants& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("mappings"s == str) {
+  if ("mappings"sv == str) {
     return property("mappings", this->_mappings, o.mappings);
   }
 
@@ -1796,12 +1796,12 @@ void ExtensionKhrTextureBasisuJsonHandler::reset(
 
 CesiumJsonReader::IJsonHandler*
 ExtensionKhrTextureBasisuJsonHandler::readObjectKeyExtensionKhrTextureBasisu(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::ExtensionKhrTextureBasisu& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("source"s == str) {
+  if ("source"sv == str) {
     return property("source", this->_source, o.source);
   }
 
@@ -1914,15 +1914,15 @@ void ExtensionModelMaxarMeshVariantsJsonHandler::reset(
 
 CesiumJsonReader::IJsonHandler* ExtensionModelMaxarMeshVariantsJsonHandler::
     readObjectKeyExtensionModelMaxarMeshVariants(
-        const std::string& objectType,
+        const std::string_view& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionModelMaxarMeshVariants& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("default"s == str) {
+  if ("default"sv == str) {
     return property("default", this->_defaultProperty, o.defaultProperty);
   }
-  if ("variants"s == str) {
+  if ("variants"sv == str) {
     return property("variants", this->_variants, o.variants);
   }
 
@@ -2034,12 +2034,12 @@ void ExtensionNodeMaxarMeshVariantsJsonHandler::reset(
 
 CesiumJsonReader::IJsonHandler* ExtensionNodeMaxarMeshVariantsJsonHandler::
     readObjectKeyExtensionNodeMaxarMeshVariants(
-        const std::string& objectType,
+        const std::string_view& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionNodeMaxarMeshVariants& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("mappings"s == str) {
+  if ("mappings"sv == str) {
     return property("mappings", this->_mappings, o.mappings);
   }
 
@@ -2154,21 +2154,21 @@ void ExtensionKhrTextureTransformJsonHandler::reset(
 
 CesiumJsonReader::IJsonHandler* ExtensionKhrTextureTransformJsonHandler::
     readObjectKeyExtensionKhrTextureTransform(
-        const std::string& objectType,
+        const std::string_view& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionKhrTextureTransform& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("offset"s == str) {
+  if ("offset"sv == str) {
     return property("offset", this->_offset, o.offset);
   }
-  if ("rotation"s == str) {
+  if ("rotation"sv == str) {
     return property("rotation", this->_rotation, o.rotation);
   }
-  if ("scale"s == str) {
+  if ("scale"sv == str) {
     return property("scale", this->_scale, o.scale);
   }
-  if ("texCoord"s == str) {
+  if ("texCoord"sv == str) {
     return property("texCoord", this->_texCoord, o.texCoord);
   }
 
@@ -2276,12 +2276,12 @@ void ExtensionTextureWebpJsonHandler::reset(
 
 CesiumJsonReader::IJsonHandler*
 ExtensionTextureWebpJsonHandler::readObjectKeyExtensionTextureWebp(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::ExtensionTextureWebp& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("source"s == str) {
+  if ("source"sv == str) {
     return property("source", this->_source, o.source);
   }
 
@@ -2389,12 +2389,12 @@ void ExtensionCesiumPrimitiveOutlineJsonHandler::reset(
 
 CesiumJsonReader::IJsonHandler* ExtensionCesiumPrimitiveOutlineJsonHandler::
     readObjectKeyExtensionCesiumPrimitiveOutline(
-        const std::string& objectType,
+        const std::string_view& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionCesiumPrimitiveOutline& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("indices"s == str) {
+  if ("indices"sv == str) {
     return property("indices", this->_indices, o.indices);
   }
 
@@ -2494,18 +2494,18 @@ ExtensionNodeMaxarMeshVariantsMappingsValueJsonHandler::readObjectKey(
 CesiumJsonReader::IJsonHandler*
 ExtensionNodeMaxarMeshVariantsMappingsValueJsonHandler::
     readObjectKeyExtensionNodeMaxarMeshVariantsMappingsValue(
-        const std::string& objectType,
+        const std::string_view& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionNodeMaxarMeshVariantsMappingsValue& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("variants"s == str) {
+  if ("variants"sv == str) {
     return property("variants", this->_variants, o.variants);
   }
-  if ("mesh"s == str) {
+  if ("mesh"sv == str) {
     return property("mesh", this->_mesh, o.mesh);
   }
-  if ("name"s == str) {
+  if ("name"sv == str) {
     return property("name", this->_name, o.name);
   }
 
@@ -2607,12 +2607,12 @@ ExtensionModelMaxarMeshVariantsValueJsonHandler::readObjectKey(
 CesiumJsonReader::IJsonHandler*
 ExtensionModelMaxarMeshVariantsValueJsonHandler::
     readObjectKeyExtensionModelMaxarMeshVariantsValue(
-        const std::string& objectType,
+        const std::string_view& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionModelMaxarMeshVariantsValue& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("name"s == str) {
+  if ("name"sv == str) {
     return property("name", this->_name, o.name);
   }
 
@@ -2718,19 +2718,19 @@ ExtensionMeshPrimitiveKhrMaterialsVariantsMappingsValueJsonHandler::
 CesiumJsonReader::IJsonHandler*
 ExtensionMeshPrimitiveKhrMaterialsVariantsMappingsValueJsonHandler::
     readObjectKeyExtensionMeshPrimitiveKhrMaterialsVariantsMappingsValue(
-        const std::string& objectType,
+        const std::string_view& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionMeshPrimitiveKhrMaterialsVariantsMappingsValue&
             o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("variants"s == str) {
+  if ("variants"sv == str) {
     return property("variants", this->_variants, o.variants);
   }
-  if ("material"s == str) {
+  if ("material"sv == str) {
     return property("material", this->_material, o.material);
   }
-  if ("name"s == str) {
+  if ("name"sv == str) {
     return property("name", this->_name, o.name);
   }
 
@@ -2833,12 +2833,12 @@ ExtensionModelKhrMaterialsVariantsValueJsonHandler::readObjectKey(
 CesiumJsonReader::IJsonHandler*
 ExtensionModelKhrMaterialsVariantsValueJsonHandler::
     readObjectKeyExtensionModelKhrMaterialsVariantsValue(
-        const std::string& objectType,
+        const std::string_view& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionModelKhrMaterialsVariantsValue& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("name"s == str) {
+  if ("name"sv == str) {
     return property("name", this->_name, o.name);
   }
 
@@ -2938,18 +2938,18 @@ PropertyAttributeJsonHandler::readObjectKey(const std::string_view& str) {
 
 CesiumJsonReader::IJsonHandler*
 PropertyAttributeJsonHandler::readObjectKeyPropertyAttribute(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::PropertyAttribute& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("name"s == str) {
+  if ("name"sv == str) {
     return property("name", this->_name, o.name);
   }
-  if ("class"s == str) {
+  if ("class"sv == str) {
     return property("class", this->_classProperty, o.classProperty);
   }
-  if ("properties"s == str) {
+  if ("properties"sv == str) {
     return property("properties", this->_properties, o.properties);
   }
 
@@ -3046,24 +3046,24 @@ PropertyAttributePropertyJsonHandler::readObjectKey(
 
 CesiumJsonReader::IJsonHandler*
 PropertyAttributePropertyJsonHandler::readObjectKeyPropertyAttributeProperty(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::PropertyAttributeProperty& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("attribute"s == str) {
+  if ("attribute"sv == str) {
     return property("attribute", this->_attribute, o.attribute);
   }
-  if ("offset"s == str) {
+  if ("offset"sv == str) {
     return property("offset", this->_offset, o.offset);
   }
-  if ("scale"s == str) {
+  if ("scale"sv == str) {
     return property("scale", this->_scale, o.scale);
   }
-  if ("max"s == str) {
+  if ("max"sv == str) {
     return property("max", this->_max, o.max);
   }
-  if ("min"s == str) {
+  if ("min"sv == str) {
     return property("min", this->_min, o.min);
   }
 
@@ -3160,18 +3160,18 @@ PropertyTextureJsonHandler::readObjectKey(const std::string_view& str) {
 
 CesiumJsonReader::IJsonHandler*
 PropertyTextureJsonHandler::readObjectKeyPropertyTexture(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::PropertyTexture& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("name"s == str) {
+  if ("name"sv == str) {
     return property("name", this->_name, o.name);
   }
-  if ("class"s == str) {
+  if ("class"sv == str) {
     return property("class", this->_classProperty, o.classProperty);
   }
-  if ("properties"s == str) {
+  if ("properties"sv == str) {
     return property("properties", this->_properties, o.properties);
   }
 
@@ -3265,24 +3265,24 @@ PropertyTexturePropertyJsonHandler::readObjectKey(const std::string_view& str) {
 
 CesiumJsonReader::IJsonHandler*
 PropertyTexturePropertyJsonHandler::readObjectKeyPropertyTextureProperty(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::PropertyTextureProperty& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("channels"s == str) {
+  if ("channels"sv == str) {
     return property("channels", this->_channels, o.channels);
   }
-  if ("offset"s == str) {
+  if ("offset"sv == str) {
     return property("offset", this->_offset, o.offset);
   }
-  if ("scale"s == str) {
+  if ("scale"sv == str) {
     return property("scale", this->_scale, o.scale);
   }
-  if ("max"s == str) {
+  if ("max"sv == str) {
     return property("max", this->_max, o.max);
   }
-  if ("min"s == str) {
+  if ("min"sv == str) {
     return property("min", this->_min, o.min);
   }
 
@@ -3378,15 +3378,15 @@ TextureInfoJsonHandler::readObjectKey(const std::string_view& str) {
 
 CesiumJsonReader::IJsonHandler*
 TextureInfoJsonHandler::readObjectKeyTextureInfo(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::TextureInfo& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("index"s == str) {
+  if ("index"sv == str) {
     return property("index", this->_index, o.index);
   }
-  if ("texCoord"s == str) {
+  if ("texCoord"sv == str) {
     return property("texCoord", this->_texCoord, o.texCoord);
   }
 
@@ -3478,21 +3478,21 @@ PropertyTableJsonHandler::readObjectKey(const std::string_view& str) {
 
 CesiumJsonReader::IJsonHandler*
 PropertyTableJsonHandler::readObjectKeyPropertyTable(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::PropertyTable& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("name"s == str) {
+  if ("name"sv == str) {
     return property("name", this->_name, o.name);
   }
-  if ("class"s == str) {
+  if ("class"sv == str) {
     return property("class", this->_classProperty, o.classProperty);
   }
-  if ("count"s == str) {
+  if ("count"sv == str) {
     return property("count", this->_count, o.count);
   }
-  if ("properties"s == str) {
+  if ("properties"sv == str) {
     return property("properties", this->_properties, o.properties);
   }
 
@@ -3590,42 +3590,42 @@ PropertyTablePropertyJsonHandler::readObjectKey(const std::string_view& str) {
 
 CesiumJsonReader::IJsonHandler*
 PropertyTablePropertyJsonHandler::readObjectKeyPropertyTableProperty(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::PropertyTableProperty& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("values"s == str) {
+  if ("values"sv == str) {
     return property("values", this->_values, o.values);
   }
-  if ("arrayOffsets"s == str) {
+  if ("arrayOffsets"sv == str) {
     return property("arrayOffsets", this->_arrayOffsets, o.arrayOffsets);
   }
-  if ("stringOffsets"s == str) {
+  if ("stringOffsets"sv == str) {
     return property("stringOffsets", this->_stringOffsets, o.stringOffsets);
   }
-  if ("arrayOffsetType"s == str) {
+  if ("arrayOffsetType"sv == str) {
     return property(
         "arrayOffsetType",
         this->_arrayOffsetType,
         o.arrayOffsetType);
   }
-  if ("stringOffsetType"s == str) {
+  if ("stringOffsetType"sv == str) {
     return property(
         "stringOffsetType",
         this->_stringOffsetType,
         o.stringOffsetType);
   }
-  if ("offset"s == str) {
+  if ("offset"sv == str) {
     return property("offset", this->_offset, o.offset);
   }
-  if ("scale"s == str) {
+  if ("scale"sv == str) {
     return property("scale", this->_scale, o.scale);
   }
-  if ("max"s == str) {
+  if ("max"sv == str) {
     return property("max", this->_max, o.max);
   }
-  if ("min"s == str) {
+  if ("min"sv == str) {
     return property("min", this->_min, o.min);
   }
 
@@ -3721,27 +3721,27 @@ SchemaJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* SchemaJsonHandler::readObjectKeySchema(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::Schema& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("id"s == str) {
+  if ("id"sv == str) {
     return property("id", this->_id, o.id);
   }
-  if ("name"s == str) {
+  if ("name"sv == str) {
     return property("name", this->_name, o.name);
   }
-  if ("description"s == str) {
+  if ("description"sv == str) {
     return property("description", this->_description, o.description);
   }
-  if ("version"s == str) {
+  if ("version"sv == str) {
     return property("version", this->_version, o.version);
   }
-  if ("classes"s == str) {
+  if ("classes"sv == str) {
     return property("classes", this->_classes, o.classes);
   }
-  if ("enums"s == str) {
+  if ("enums"sv == str) {
     return property("enums", this->_enums, o.enums);
   }
 
@@ -3828,21 +3828,21 @@ EnumJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* EnumJsonHandler::readObjectKeyEnum(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::Enum& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("name"s == str) {
+  if ("name"sv == str) {
     return property("name", this->_name, o.name);
   }
-  if ("description"s == str) {
+  if ("description"sv == str) {
     return property("description", this->_description, o.description);
   }
-  if ("valueType"s == str) {
+  if ("valueType"sv == str) {
     return property("valueType", this->_valueType, o.valueType);
   }
-  if ("values"s == str) {
+  if ("values"sv == str) {
     return property("values", this->_values, o.values);
   }
 
@@ -3928,18 +3928,18 @@ EnumValueJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* EnumValueJsonHandler::readObjectKeyEnumValue(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::EnumValue& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("name"s == str) {
+  if ("name"sv == str) {
     return property("name", this->_name, o.name);
   }
-  if ("description"s == str) {
+  if ("description"sv == str) {
     return property("description", this->_description, o.description);
   }
-  if ("value"s == str) {
+  if ("value"sv == str) {
     return property("value", this->_value, o.value);
   }
 
@@ -4026,18 +4026,18 @@ ClassJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* ClassJsonHandler::readObjectKeyClass(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::Class& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("name"s == str) {
+  if ("name"sv == str) {
     return property("name", this->_name, o.name);
   }
-  if ("description"s == str) {
+  if ("description"sv == str) {
     return property("description", this->_description, o.description);
   }
-  if ("properties"s == str) {
+  if ("properties"sv == str) {
     return property("properties", this->_properties, o.properties);
   }
 
@@ -4137,57 +4137,57 @@ ClassPropertyJsonHandler::readObjectKey(const std::string_view& str) {
 
 CesiumJsonReader::IJsonHandler*
 ClassPropertyJsonHandler::readObjectKeyClassProperty(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::ClassProperty& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("name"s == str) {
+  if ("name"sv == str) {
     return property("name", this->_name, o.name);
   }
-  if ("description"s == str) {
+  if ("description"sv == str) {
     return property("description", this->_description, o.description);
   }
-  if ("type"s == str) {
+  if ("type"sv == str) {
     return property("type", this->_type, o.type);
   }
-  if ("componentType"s == str) {
+  if ("componentType"sv == str) {
     return property("componentType", this->_componentType, o.componentType);
   }
-  if ("enumType"s == str) {
+  if ("enumType"sv == str) {
     return property("enumType", this->_enumType, o.enumType);
   }
-  if ("array"s == str) {
+  if ("array"sv == str) {
     return property("array", this->_array, o.array);
   }
-  if ("count"s == str) {
+  if ("count"sv == str) {
     return property("count", this->_count, o.count);
   }
-  if ("normalized"s == str) {
+  if ("normalized"sv == str) {
     return property("normalized", this->_normalized, o.normalized);
   }
-  if ("offset"s == str) {
+  if ("offset"sv == str) {
     return property("offset", this->_offset, o.offset);
   }
-  if ("scale"s == str) {
+  if ("scale"sv == str) {
     return property("scale", this->_scale, o.scale);
   }
-  if ("max"s == str) {
+  if ("max"sv == str) {
     return property("max", this->_max, o.max);
   }
-  if ("min"s == str) {
+  if ("min"sv == str) {
     return property("min", this->_min, o.min);
   }
-  if ("required"s == str) {
+  if ("required"sv == str) {
     return property("required", this->_required, o.required);
   }
-  if ("noData"s == str) {
+  if ("noData"sv == str) {
     return property("noData", this->_noData, o.noData);
   }
-  if ("default"s == str) {
+  if ("default"sv == str) {
     return property("default", this->_defaultProperty, o.defaultProperty);
   }
-  if ("semantic"s == str) {
+  if ("semantic"sv == str) {
     return property("semantic", this->_semantic, o.semantic);
   }
 
@@ -4281,27 +4281,27 @@ FeatureIdJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* FeatureIdJsonHandler::readObjectKeyFeatureId(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::FeatureId& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("featureCount"s == str) {
+  if ("featureCount"sv == str) {
     return property("featureCount", this->_featureCount, o.featureCount);
   }
-  if ("nullFeatureId"s == str) {
+  if ("nullFeatureId"sv == str) {
     return property("nullFeatureId", this->_nullFeatureId, o.nullFeatureId);
   }
-  if ("label"s == str) {
+  if ("label"sv == str) {
     return property("label", this->_label, o.label);
   }
-  if ("attribute"s == str) {
+  if ("attribute"sv == str) {
     return property("attribute", this->_attribute, o.attribute);
   }
-  if ("texture"s == str) {
+  if ("texture"sv == str) {
     return property("texture", this->_texture, o.texture);
   }
-  if ("propertyTable"s == str) {
+  if ("propertyTable"sv == str) {
     return property("propertyTable", this->_propertyTable, o.propertyTable);
   }
 
@@ -4386,12 +4386,12 @@ FeatureIdTextureJsonHandler::readObjectKey(const std::string_view& str) {
 
 CesiumJsonReader::IJsonHandler*
 FeatureIdTextureJsonHandler::readObjectKeyFeatureIdTexture(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::FeatureIdTexture& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("channels"s == str) {
+  if ("channels"sv == str) {
     return property("channels", this->_channels, o.channels);
   }
 
@@ -4489,24 +4489,24 @@ ExtensionExtInstanceFeaturesFeatureIdJsonHandler::readObjectKey(
 CesiumJsonReader::IJsonHandler*
 ExtensionExtInstanceFeaturesFeatureIdJsonHandler::
     readObjectKeyExtensionExtInstanceFeaturesFeatureId(
-        const std::string& objectType,
+        const std::string_view& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionExtInstanceFeaturesFeatureId& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("featureCount"s == str) {
+  if ("featureCount"sv == str) {
     return property("featureCount", this->_featureCount, o.featureCount);
   }
-  if ("nullFeatureId"s == str) {
+  if ("nullFeatureId"sv == str) {
     return property("nullFeatureId", this->_nullFeatureId, o.nullFeatureId);
   }
-  if ("label"s == str) {
+  if ("label"sv == str) {
     return property("label", this->_label, o.label);
   }
-  if ("attribute"s == str) {
+  if ("attribute"sv == str) {
     return property("attribute", this->_attribute, o.attribute);
   }
-  if ("propertyTable"s == str) {
+  if ("propertyTable"sv == str) {
     return property("propertyTable", this->_propertyTable, o.propertyTable);
   }
 
@@ -4619,63 +4619,63 @@ ModelJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* ModelJsonHandler::readObjectKeyModel(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::Model& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("extensionsUsed"s == str) {
+  if ("extensionsUsed"sv == str) {
     return property("extensionsUsed", this->_extensionsUsed, o.extensionsUsed);
   }
-  if ("extensionsRequired"s == str) {
+  if ("extensionsRequired"sv == str) {
     return property(
         "extensionsRequired",
         this->_extensionsRequired,
         o.extensionsRequired);
   }
-  if ("accessors"s == str) {
+  if ("accessors"sv == str) {
     return property("accessors", this->_accessors, o.accessors);
   }
-  if ("animations"s == str) {
+  if ("animations"sv == str) {
     return property("animations", this->_animations, o.animations);
   }
-  if ("asset"s == str) {
+  if ("asset"sv == str) {
     return property("asset", this->_asset, o.asset);
   }
-  if ("buffers"s == str) {
+  if ("buffers"sv == str) {
     return property("buffers", this->_buffers, o.buffers);
   }
-  if ("bufferViews"s == str) {
+  if ("bufferViews"sv == str) {
     return property("bufferViews", this->_bufferViews, o.bufferViews);
   }
-  if ("cameras"s == str) {
+  if ("cameras"sv == str) {
     return property("cameras", this->_cameras, o.cameras);
   }
-  if ("images"s == str) {
+  if ("images"sv == str) {
     return property("images", this->_images, o.images);
   }
-  if ("materials"s == str) {
+  if ("materials"sv == str) {
     return property("materials", this->_materials, o.materials);
   }
-  if ("meshes"s == str) {
+  if ("meshes"sv == str) {
     return property("meshes", this->_meshes, o.meshes);
   }
-  if ("nodes"s == str) {
+  if ("nodes"sv == str) {
     return property("nodes", this->_nodes, o.nodes);
   }
-  if ("samplers"s == str) {
+  if ("samplers"sv == str) {
     return property("samplers", this->_samplers, o.samplers);
   }
-  if ("scene"s == str) {
+  if ("scene"sv == str) {
     return property("scene", this->_scene, o.scene);
   }
-  if ("scenes"s == str) {
+  if ("scenes"sv == str) {
     return property("scenes", this->_scenes, o.scenes);
   }
-  if ("skins"s == str) {
+  if ("skins"sv == str) {
     return property("skins", this->_skins, o.skins);
   }
-  if ("textures"s == str) {
+  if ("textures"sv == str) {
     return property("textures", this->_textures, o.textures);
   }
 
@@ -4760,15 +4760,15 @@ TextureJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* TextureJsonHandler::readObjectKeyTexture(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::Texture& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("sampler"s == str) {
+  if ("sampler"sv == str) {
     return property("sampler", this->_sampler, o.sampler);
   }
-  if ("source"s == str) {
+  if ("source"sv == str) {
     return property("source", this->_source, o.source);
   }
 
@@ -4854,21 +4854,21 @@ SkinJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* SkinJsonHandler::readObjectKeySkin(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::Skin& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("inverseBindMatrices"s == str) {
+  if ("inverseBindMatrices"sv == str) {
     return property(
         "inverseBindMatrices",
         this->_inverseBindMatrices,
         o.inverseBindMatrices);
   }
-  if ("skeleton"s == str) {
+  if ("skeleton"sv == str) {
     return property("skeleton", this->_skeleton, o.skeleton);
   }
-  if ("joints"s == str) {
+  if ("joints"sv == str) {
     return property("joints", this->_joints, o.joints);
   }
 
@@ -4951,12 +4951,12 @@ SceneJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* SceneJsonHandler::readObjectKeyScene(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::Scene& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("nodes"s == str) {
+  if ("nodes"sv == str) {
     return property("nodes", this->_nodes, o.nodes);
   }
 
@@ -5043,21 +5043,21 @@ SamplerJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* SamplerJsonHandler::readObjectKeySampler(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::Sampler& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("magFilter"s == str) {
+  if ("magFilter"sv == str) {
     return property("magFilter", this->_magFilter, o.magFilter);
   }
-  if ("minFilter"s == str) {
+  if ("minFilter"sv == str) {
     return property("minFilter", this->_minFilter, o.minFilter);
   }
-  if ("wrapS"s == str) {
+  if ("wrapS"sv == str) {
     return property("wrapS", this->_wrapS, o.wrapS);
   }
-  if ("wrapT"s == str) {
+  if ("wrapT"sv == str) {
     return property("wrapT", this->_wrapT, o.wrapT);
   }
 
@@ -5149,36 +5149,36 @@ NodeJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* NodeJsonHandler::readObjectKeyNode(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::Node& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("camera"s == str) {
+  if ("camera"sv == str) {
     return property("camera", this->_camera, o.camera);
   }
-  if ("children"s == str) {
+  if ("children"sv == str) {
     return property("children", this->_children, o.children);
   }
-  if ("skin"s == str) {
+  if ("skin"sv == str) {
     return property("skin", this->_skin, o.skin);
   }
-  if ("matrix"s == str) {
+  if ("matrix"sv == str) {
     return property("matrix", this->_matrix, o.matrix);
   }
-  if ("mesh"s == str) {
+  if ("mesh"sv == str) {
     return property("mesh", this->_mesh, o.mesh);
   }
-  if ("rotation"s == str) {
+  if ("rotation"sv == str) {
     return property("rotation", this->_rotation, o.rotation);
   }
-  if ("scale"s == str) {
+  if ("scale"sv == str) {
     return property("scale", this->_scale, o.scale);
   }
-  if ("translation"s == str) {
+  if ("translation"sv == str) {
     return property("translation", this->_translation, o.translation);
   }
-  if ("weights"s == str) {
+  if ("weights"sv == str) {
     return property("weights", this->_weights, o.weights);
   }
 
@@ -5263,15 +5263,15 @@ MeshJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* MeshJsonHandler::readObjectKeyMesh(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::Mesh& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("primitives"s == str) {
+  if ("primitives"sv == str) {
     return property("primitives", this->_primitives, o.primitives);
   }
-  if ("weights"s == str) {
+  if ("weights"sv == str) {
     return property("weights", this->_weights, o.weights);
   }
 
@@ -5360,24 +5360,24 @@ MeshPrimitiveJsonHandler::readObjectKey(const std::string_view& str) {
 
 CesiumJsonReader::IJsonHandler*
 MeshPrimitiveJsonHandler::readObjectKeyMeshPrimitive(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::MeshPrimitive& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("attributes"s == str) {
+  if ("attributes"sv == str) {
     return property("attributes", this->_attributes, o.attributes);
   }
-  if ("indices"s == str) {
+  if ("indices"sv == str) {
     return property("indices", this->_indices, o.indices);
   }
-  if ("material"s == str) {
+  if ("material"sv == str) {
     return property("material", this->_material, o.material);
   }
-  if ("mode"s == str) {
+  if ("mode"sv == str) {
     return property("mode", this->_mode, o.mode);
   }
-  if ("targets"s == str) {
+  if ("targets"sv == str) {
     return property("targets", this->_targets, o.targets);
   }
 
@@ -5473,42 +5473,42 @@ MaterialJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* MaterialJsonHandler::readObjectKeyMaterial(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::Material& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("pbrMetallicRoughness"s == str) {
+  if ("pbrMetallicRoughness"sv == str) {
     return property(
         "pbrMetallicRoughness",
         this->_pbrMetallicRoughness,
         o.pbrMetallicRoughness);
   }
-  if ("normalTexture"s == str) {
+  if ("normalTexture"sv == str) {
     return property("normalTexture", this->_normalTexture, o.normalTexture);
   }
-  if ("occlusionTexture"s == str) {
+  if ("occlusionTexture"sv == str) {
     return property(
         "occlusionTexture",
         this->_occlusionTexture,
         o.occlusionTexture);
   }
-  if ("emissiveTexture"s == str) {
+  if ("emissiveTexture"sv == str) {
     return property(
         "emissiveTexture",
         this->_emissiveTexture,
         o.emissiveTexture);
   }
-  if ("emissiveFactor"s == str) {
+  if ("emissiveFactor"sv == str) {
     return property("emissiveFactor", this->_emissiveFactor, o.emissiveFactor);
   }
-  if ("alphaMode"s == str) {
+  if ("alphaMode"sv == str) {
     return property("alphaMode", this->_alphaMode, o.alphaMode);
   }
-  if ("alphaCutoff"s == str) {
+  if ("alphaCutoff"sv == str) {
     return property("alphaCutoff", this->_alphaCutoff, o.alphaCutoff);
   }
-  if ("doubleSided"s == str) {
+  if ("doubleSided"sv == str) {
     return property("doubleSided", this->_doubleSided, o.doubleSided);
   }
 
@@ -5594,12 +5594,12 @@ MaterialOcclusionTextureInfoJsonHandler::readObjectKey(
 
 CesiumJsonReader::IJsonHandler* MaterialOcclusionTextureInfoJsonHandler::
     readObjectKeyMaterialOcclusionTextureInfo(
-        const std::string& objectType,
+        const std::string_view& objectType,
         const std::string_view& str,
         CesiumGltf::MaterialOcclusionTextureInfo& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("strength"s == str) {
+  if ("strength"sv == str) {
     return property("strength", this->_strength, o.strength);
   }
 
@@ -5694,12 +5694,12 @@ MaterialNormalTextureInfoJsonHandler::readObjectKey(
 
 CesiumJsonReader::IJsonHandler*
 MaterialNormalTextureInfoJsonHandler::readObjectKeyMaterialNormalTextureInfo(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::MaterialNormalTextureInfo& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("scale"s == str) {
+  if ("scale"sv == str) {
     return property("scale", this->_scale, o.scale);
   }
 
@@ -5800,33 +5800,33 @@ MaterialPBRMetallicRoughnessJsonHandler::readObjectKey(
 
 CesiumJsonReader::IJsonHandler* MaterialPBRMetallicRoughnessJsonHandler::
     readObjectKeyMaterialPBRMetallicRoughness(
-        const std::string& objectType,
+        const std::string_view& objectType,
         const std::string_view& str,
         CesiumGltf::MaterialPBRMetallicRoughness& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("baseColorFactor"s == str) {
+  if ("baseColorFactor"sv == str) {
     return property(
         "baseColorFactor",
         this->_baseColorFactor,
         o.baseColorFactor);
   }
-  if ("baseColorTexture"s == str) {
+  if ("baseColorTexture"sv == str) {
     return property(
         "baseColorTexture",
         this->_baseColorTexture,
         o.baseColorTexture);
   }
-  if ("metallicFactor"s == str) {
+  if ("metallicFactor"sv == str) {
     return property("metallicFactor", this->_metallicFactor, o.metallicFactor);
   }
-  if ("roughnessFactor"s == str) {
+  if ("roughnessFactor"sv == str) {
     return property(
         "roughnessFactor",
         this->_roughnessFactor,
         o.roughnessFactor);
   }
-  if ("metallicRoughnessTexture"s == str) {
+  if ("metallicRoughnessTexture"sv == str) {
     return property(
         "metallicRoughnessTexture",
         this->_metallicRoughnessTexture,
@@ -5925,18 +5925,18 @@ ImageJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* ImageJsonHandler::readObjectKeyImage(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::Image& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("uri"s == str) {
+  if ("uri"sv == str) {
     return property("uri", this->_uri, o.uri);
   }
-  if ("mimeType"s == str) {
+  if ("mimeType"sv == str) {
     return property("mimeType", this->_mimeType, o.mimeType);
   }
-  if ("bufferView"s == str) {
+  if ("bufferView"sv == str) {
     return property("bufferView", this->_bufferView, o.bufferView);
   }
 
@@ -6022,18 +6022,18 @@ CameraJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* CameraJsonHandler::readObjectKeyCamera(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::Camera& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("orthographic"s == str) {
+  if ("orthographic"sv == str) {
     return property("orthographic", this->_orthographic, o.orthographic);
   }
-  if ("perspective"s == str) {
+  if ("perspective"sv == str) {
     return property("perspective", this->_perspective, o.perspective);
   }
-  if ("type"s == str) {
+  if ("type"sv == str) {
     return property("type", this->_type, o.type);
   }
 
@@ -6121,21 +6121,21 @@ CameraPerspectiveJsonHandler::readObjectKey(const std::string_view& str) {
 
 CesiumJsonReader::IJsonHandler*
 CameraPerspectiveJsonHandler::readObjectKeyCameraPerspective(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::CameraPerspective& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("aspectRatio"s == str) {
+  if ("aspectRatio"sv == str) {
     return property("aspectRatio", this->_aspectRatio, o.aspectRatio);
   }
-  if ("yfov"s == str) {
+  if ("yfov"sv == str) {
     return property("yfov", this->_yfov, o.yfov);
   }
-  if ("zfar"s == str) {
+  if ("zfar"sv == str) {
     return property("zfar", this->_zfar, o.zfar);
   }
-  if ("znear"s == str) {
+  if ("znear"sv == str) {
     return property("znear", this->_znear, o.znear);
   }
 
@@ -6230,21 +6230,21 @@ CameraOrthographicJsonHandler::readObjectKey(const std::string_view& str) {
 
 CesiumJsonReader::IJsonHandler*
 CameraOrthographicJsonHandler::readObjectKeyCameraOrthographic(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::CameraOrthographic& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("xmag"s == str) {
+  if ("xmag"sv == str) {
     return property("xmag", this->_xmag, o.xmag);
   }
-  if ("ymag"s == str) {
+  if ("ymag"sv == str) {
     return property("ymag", this->_ymag, o.ymag);
   }
-  if ("zfar"s == str) {
+  if ("zfar"sv == str) {
     return property("zfar", this->_zfar, o.zfar);
   }
-  if ("znear"s == str) {
+  if ("znear"sv == str) {
     return property("znear", this->_znear, o.znear);
   }
 
@@ -6339,24 +6339,24 @@ BufferViewJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* BufferViewJsonHandler::readObjectKeyBufferView(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::BufferView& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("buffer"s == str) {
+  if ("buffer"sv == str) {
     return property("buffer", this->_buffer, o.buffer);
   }
-  if ("byteOffset"s == str) {
+  if ("byteOffset"sv == str) {
     return property("byteOffset", this->_byteOffset, o.byteOffset);
   }
-  if ("byteLength"s == str) {
+  if ("byteLength"sv == str) {
     return property("byteLength", this->_byteLength, o.byteLength);
   }
-  if ("byteStride"s == str) {
+  if ("byteStride"sv == str) {
     return property("byteStride", this->_byteStride, o.byteStride);
   }
-  if ("target"s == str) {
+  if ("target"sv == str) {
     return property("target", this->_target, o.target);
   }
 
@@ -6445,15 +6445,15 @@ BufferJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* BufferJsonHandler::readObjectKeyBuffer(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::Buffer& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("uri"s == str) {
+  if ("uri"sv == str) {
     return property("uri", this->_uri, o.uri);
   }
-  if ("byteLength"s == str) {
+  if ("byteLength"sv == str) {
     return property("byteLength", this->_byteLength, o.byteLength);
   }
 
@@ -6540,21 +6540,21 @@ AssetJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* AssetJsonHandler::readObjectKeyAsset(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::Asset& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("copyright"s == str) {
+  if ("copyright"sv == str) {
     return property("copyright", this->_copyright, o.copyright);
   }
-  if ("generator"s == str) {
+  if ("generator"sv == str) {
     return property("generator", this->_generator, o.generator);
   }
-  if ("version"s == str) {
+  if ("version"sv == str) {
     return property("version", this->_version, o.version);
   }
-  if ("minVersion"s == str) {
+  if ("minVersion"sv == str) {
     return property("minVersion", this->_minVersion, o.minVersion);
   }
 
@@ -6639,15 +6639,15 @@ AnimationJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* AnimationJsonHandler::readObjectKeyAnimation(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::Animation& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("channels"s == str) {
+  if ("channels"sv == str) {
     return property("channels", this->_channels, o.channels);
   }
-  if ("samplers"s == str) {
+  if ("samplers"sv == str) {
     return property("samplers", this->_samplers, o.samplers);
   }
 
@@ -6735,18 +6735,18 @@ AnimationSamplerJsonHandler::readObjectKey(const std::string_view& str) {
 
 CesiumJsonReader::IJsonHandler*
 AnimationSamplerJsonHandler::readObjectKeyAnimationSampler(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::AnimationSampler& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("input"s == str) {
+  if ("input"sv == str) {
     return property("input", this->_input, o.input);
   }
-  if ("interpolation"s == str) {
+  if ("interpolation"sv == str) {
     return property("interpolation", this->_interpolation, o.interpolation);
   }
-  if ("output"s == str) {
+  if ("output"sv == str) {
     return property("output", this->_output, o.output);
   }
 
@@ -6838,15 +6838,15 @@ AnimationChannelJsonHandler::readObjectKey(const std::string_view& str) {
 
 CesiumJsonReader::IJsonHandler*
 AnimationChannelJsonHandler::readObjectKeyAnimationChannel(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::AnimationChannel& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("sampler"s == str) {
+  if ("sampler"sv == str) {
     return property("sampler", this->_sampler, o.sampler);
   }
-  if ("target"s == str) {
+  if ("target"sv == str) {
     return property("target", this->_target, o.target);
   }
 
@@ -6938,15 +6938,15 @@ AnimationChannelTargetJsonHandler::readObjectKey(const std::string_view& str) {
 
 CesiumJsonReader::IJsonHandler*
 AnimationChannelTargetJsonHandler::readObjectKeyAnimationChannelTarget(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::AnimationChannelTarget& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("node"s == str) {
+  if ("node"sv == str) {
     return property("node", this->_node, o.node);
   }
-  if ("path"s == str) {
+  if ("path"sv == str) {
     return property("path", this->_path, o.path);
   }
 
@@ -7048,36 +7048,36 @@ AccessorJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* AccessorJsonHandler::readObjectKeyAccessor(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::Accessor& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("bufferView"s == str) {
+  if ("bufferView"sv == str) {
     return property("bufferView", this->_bufferView, o.bufferView);
   }
-  if ("byteOffset"s == str) {
+  if ("byteOffset"sv == str) {
     return property("byteOffset", this->_byteOffset, o.byteOffset);
   }
-  if ("componentType"s == str) {
+  if ("componentType"sv == str) {
     return property("componentType", this->_componentType, o.componentType);
   }
-  if ("normalized"s == str) {
+  if ("normalized"sv == str) {
     return property("normalized", this->_normalized, o.normalized);
   }
-  if ("count"s == str) {
+  if ("count"sv == str) {
     return property("count", this->_count, o.count);
   }
-  if ("type"s == str) {
+  if ("type"sv == str) {
     return property("type", this->_type, o.type);
   }
-  if ("max"s == str) {
+  if ("max"sv == str) {
     return property("max", this->_max, o.max);
   }
-  if ("min"s == str) {
+  if ("min"sv == str) {
     return property("min", this->_min, o.min);
   }
-  if ("sparse"s == str) {
+  if ("sparse"sv == str) {
     return property("sparse", this->_sparse, o.sparse);
   }
 
@@ -7164,18 +7164,18 @@ AccessorSparseJsonHandler::readObjectKey(const std::string_view& str) {
 
 CesiumJsonReader::IJsonHandler*
 AccessorSparseJsonHandler::readObjectKeyAccessorSparse(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::AccessorSparse& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("count"s == str) {
+  if ("count"sv == str) {
     return property("count", this->_count, o.count);
   }
-  if ("indices"s == str) {
+  if ("indices"sv == str) {
     return property("indices", this->_indices, o.indices);
   }
-  if ("values"s == str) {
+  if ("values"sv == str) {
     return property("values", this->_values, o.values);
   }
 
@@ -7266,15 +7266,15 @@ AccessorSparseValuesJsonHandler::readObjectKey(const std::string_view& str) {
 
 CesiumJsonReader::IJsonHandler*
 AccessorSparseValuesJsonHandler::readObjectKeyAccessorSparseValues(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::AccessorSparseValues& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("bufferView"s == str) {
+  if ("bufferView"sv == str) {
     return property("bufferView", this->_bufferView, o.bufferView);
   }
-  if ("byteOffset"s == str) {
+  if ("byteOffset"sv == str) {
     return property("byteOffset", this->_byteOffset, o.byteOffset);
   }
 
@@ -7368,18 +7368,18 @@ AccessorSparseIndicesJsonHandler::readObjectKey(const std::string_view& str) {
 
 CesiumJsonReader::IJsonHandler*
 AccessorSparseIndicesJsonHandler::readObjectKeyAccessorSparseIndices(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::AccessorSparseIndices& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("bufferView"s == str) {
+  if ("bufferView"sv == str) {
     return property("bufferView", this->_bufferView, o.bufferView);
   }
-  if ("byteOffset"s == str) {
+  if ("byteOffset"sv == str) {
     return property("byteOffset", this->_byteOffset, o.byteOffset);
   }
-  if ("componentType"s == str) {
+  if ("componentType"sv == str) {
     return property("componentType", this->_componentType, o.componentType);
   }
 
@@ -31,7 +31,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyMaterial(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumGltf::Material& o);
 
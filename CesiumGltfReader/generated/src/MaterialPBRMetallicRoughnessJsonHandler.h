@@ -29,7 +29,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyMaterialPBRMetallicRoughness(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumGltf::MaterialPBRMetallicRoughness& o);
 
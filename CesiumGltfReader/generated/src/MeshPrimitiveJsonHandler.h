@@ -26,7 +26,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyMeshPrimitive(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumGltf::MeshPrimitive& o);
 
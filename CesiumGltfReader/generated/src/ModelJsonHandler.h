@@ -40,7 +40,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyModel(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumGltf::Model& o);
 
@@ -28,7 +28,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyPropertyTable(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumGltf::PropertyTable& o);
 
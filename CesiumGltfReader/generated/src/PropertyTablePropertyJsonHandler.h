@@ -28,7 +28,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyPropertyTableProperty(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumGltf::PropertyTableProperty& o);
 
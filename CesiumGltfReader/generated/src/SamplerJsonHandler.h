@@ -24,7 +24,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeySampler(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumGltf::Sampler& o);
 
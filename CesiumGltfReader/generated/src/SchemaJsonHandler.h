@@ -27,7 +27,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeySchema(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumGltf::Schema& o);
 
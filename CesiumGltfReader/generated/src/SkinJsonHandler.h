@@ -25,7 +25,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeySkin(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumGltf::Skin& o);
 
@@ -24,7 +24,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyTexture(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumGltf::Texture& o);
 
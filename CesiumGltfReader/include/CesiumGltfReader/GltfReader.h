@@ -80,13 +80,20 @@ struct CESIUMGLTFREADER_API GltfReaderOptions {
   /**
    * @brief Whether geometry compressed using the `KHR_draco_mesh_compression`
    * extension should be automatically decoded as part of the load process.
+   *
+   * If false, the compressed data is left in place for renderers that decode
+   * it on the GPU. The compressed buffer views and Draco headers are still
+   * validated, and problems are reported as warnings.
    */
   bool decodeDraco = true;
 
   /**
    * @brief Whether the mesh data are decompressed as part of the load process,
    * or left in the compressed format according to the EXT_meshopt_compression
-   * extension
+   * extension.
+   *
+   * If false, the ranges of the compressed buffer views are still validated,
+   * and problems are reported as warnings.
    */
   bool decodeMeshOptData = true;
 
@@ -94,6 +101,11 @@ struct CESIUMGLTFREADER_API GltfReaderOptions {
    * @brief Whether the quantized mesh data are dequantized and converted to
    * floating-point values when loading, according to the KHR_mesh_quantization
    * extension.
+   *
+   * The dequantized attributes of each primitive are written to a single new
+   * buffer. Renderers that can consume normalized integer vertex attributes
+   * directly should set this to `false` to leave the compact quantized data in
+   * place.
    */
   bool dequantizeMeshData = true;
 
@@ -158,6 +170,11 @@ public:
    * @brief Reads a glTF or binary glTF file from a URL and resolves external
    * buffers and images.
    *
+   * All external resources are requested concurrently. Images embedded in
+   * buffers that are already in memory, such as the binary chunk of a GLB,
+   * are decoded in a worker thread while the external resources are being
+   * downloaded.
+   *
    * @param asyncSystem The async system to use for resolving external data.
    * @param url The url for reading the file.
    * @param headers http headers needed to make the request.
@@ -68,6 +68,24 @@ public:
   static std::optional<std::string>
   generateMipMaps(CesiumGltf::ImageAsset& image);
 
+  /**
+   * @brief Compresses an image into a GPU block-compressed pixel format.
+   *
+   * Mipmaps are generated first if the image does not already have them,
+   * because they cannot be generated from the compressed pixels. The image is
+   * then encoded as UASTC and transcoded to the target format with the KTX
+   * library. On success, the image's pixel data, mip positions, and
+   * compressed pixel format are replaced. On failure, the image is left
+   * unchanged.
+   *
+   * @param image The 8-bit RGBA image to compress.
+   * @param targetFormat The format to compress the image into.
+   * @return A string describing the error, if unable to compress the image.
+   */
+  static std::optional<std::string> compressImage(
+      CesiumGltf::ImageAsset& image,
+      CesiumGltf::GpuCompressedPixelFormat targetFormat);
+
   /**
    * @brief Resize an image, without validating the provided pointers or ranges.
    *
@@ -27,8 +27,13 @@
 #include <algorithm>
 #include <cstddef>
 #include <iomanip>
+#include <optional>
+#include <span>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 using namespace CesiumAsync;
 using namespace CesiumGltf;
@@ -231,6 +236,139 @@ GltfReaderResult readBinaryGltf(
   return result;
 }
 
+constexpr std::string_view dataUriPrefix = "data:";
+
+bool isExternalUri(const std::optional<std::string>& uri) {
+  return uri && !uri->starts_with(dataUriPrefix);
+}
+
+/**
+ * @brief Determines if {@link GltfReader::resolveExternalData} will need to
+ * make any requests for this model.
+ */
+bool hasExternalData(const Model& model, const GltfReaderOptions& options) {
+  for (const Buffer& buffer : model.buffers) {
+    if (isExternalUri(buffer.uri)) {
+      return true;
+    }
+  }
+
+  if (options.resolveExternalImages) {
+    for (const Image& image : model.images) {
+      if (isExternalUri(image.uri)) {
+        return true;
+      }
+    }
+  }
+
+  const ExtensionModelExtStructuralMetadata* pStructuralMetadata =
+      model.getExtension<ExtensionModelExtStructuralMetadata>();
+  return options.resolveExternalStructuralMetadata && pStructuralMetadata &&
+         pStructuralMetadata->schemaUri.has_value();
+}
+
+void applyDecodedImage(
+    GltfReaderResult& readGltf,
+    Image& image,
+    ImageReaderResult&& imageResult) {
+  readGltf.warnings.insert(
+      readGltf.warnings.end(),
+      imageResult.warnings.begin(),
+      imageResult.warnings.end());
+  readGltf.errors.insert(
+      readGltf.errors.end(),
+      imageResult.errors.begin(),
+      imageResult.errors.end());
+  if (imageResult.pImage) {
+    image.pAsset = imageResult.pImage;
+  } else {
+    if (image.mimeType) {
+      readGltf.errors.emplace_back(
+          "Declared image MIME Type: " + image.mimeType.value());
+    } else {
+      readGltf.errors.emplace_back("Image does not declare a MIME Type");
+    }
+  }
+}
+
+/**
+ * @brief An embedded image whose encoded bytes are already in memory, so it
+ * can be decoded before the model's external data has been resolved.
+ *
+ * The bytes are a copy, so that decoding does not depend on the lifetime of
+ * the model, which is released if resolving its external data fails.
+ */
+struct ResidentImage {
+  size_t imageIndex;
+  std::vector<std::byte> data;
+};
+
+struct DecodedResidentImage {
+  size_t imageIndex;
+  ImageReaderResult result;
+};
+
+std::vector<ResidentImage> findResidentImages(const Model& model) {
+  std::vector<ResidentImage> result;
+
+  for (size_t i = 0; i < model.images.size(); ++i) {
+    const Image& image = model.images[i];
+    if (image.uri || (image.pAsset && !image.pAsset->pixelData.empty())) {
+      continue;
+    }
+
+    const BufferView* pBufferView =
+        Model::getSafe(&model.bufferViews, image.bufferView);
+    if (!pBufferView) {
+      continue;
+    }
+
+    // Buffers with a URI, including data URIs, do not have their data yet.
+    const Buffer* pBuffer = Model::getSafe(&model.buffers, pBufferView->buffer);
+    if (!pBuffer || pBuffer->uri) {
+      continue;
+    }
+
+    if (pBufferView->byteOffset < 0 || pBufferView->byteLength < 0 ||
+        pBufferView->byteOffset + pBufferView->byteLength >
+            static_cast<int64_t>(pBuffer->cesium.data.size())) {
+      continue;
+    }
+
+    const auto begin = pBuffer->cesium.data.begin() + pBufferView->byteOffset;
+    result.emplace_back(ResidentImage{
+        i,
+        std::vector<std::byte>(begin, begin + pBufferView->byteLength)});
+  }
+
+  return result;
+}
+
+/**
+ * @brief Stores the successfully decoded resident images in the model. Images
+ * that failed to decode are left alone so that {@link postprocess} decodes
+ * them again and reports the errors in the usual way.
+ */
+void applyResidentImages(
+    GltfReaderResult& readGltf,
+    std::vector<DecodedResidentImage>&& decodedImages) {
+  if (!readGltf.model) {
+    return;
+  }
+
+  for (DecodedResidentImage& decoded : decodedImages) {
+    if (!decoded.result.pImage ||
+        decoded.imageIndex >= readGltf.model->images.size()) {
+      continue;
+    }
+
+    applyDecodedImage(
+        readGltf,
+        readGltf.model->images[decoded.imageIndex],
+        std::move(decoded.result));
+  }
+}
+
 void postprocess(GltfReaderResult& readGltf, const GltfReaderOptions& options) {
   Model& model = readGltf.model.value();
 
@@ -285,24 +423,7 @@ void postprocess(GltfReaderResult& readGltf, const GltfReaderOptions& options) {
           static_cast<size_t>(bufferView.byteLength));
       ImageReaderResult imageResult =
           ImageDecoder::readImage(bufferViewSpan, options.ktx2TranscodeTargets);
-      readGltf.warnings.insert(
-          readGltf.warnings.end(),
-          imageResult.warnings.begin(),
-          imageResult.warnings.end());
-      readGltf.errors.insert(
-          readGltf.errors.end(),
-          imageResult.errors.begin(),
-          imageResult.errors.end());
-      if (imageResult.pImage) {
-        image.pAsset = imageResult.pImage;
-      } else {
-        if (image.mimeType) {
-          readGltf.errors.emplace_back(
-              "Declared image MIME Type: " + image.mimeType.value());
-        } else {
-          readGltf.errors.emplace_back("Image does not declare a MIME Type");
-        }
-      }
+      applyDecodedImage(readGltf, image, std::move(imageResult));
     }
 
     // Copy the source property in texture extensions to the main Texture. The
@@ -325,14 +446,19 @@ void postprocess(GltfReaderResult& readGltf, const GltfReaderOptions& options) {
 
   if (options.decodeDraco) {
     decodeDraco(readGltf);
+  } else {
+    validateDraco(readGltf);
   }
 
-  if (options.decodeMeshOptData &&
-      std::find(
+  if (std::find(
           model.extensionsUsed.begin(),
           model.extensionsUsed.end(),
           "EXT_meshopt_compression") != model.extensionsUsed.end()) {
-    decodeMeshOpt(model, readGltf);
+    if (options.decodeMeshOptData) {
+      decodeMeshOpt(model, readGltf);
+    } else {
+      validateMeshOpt(model, readGltf);
+    }
   }
 
   if (options.dequantizeMeshData &&
@@ -422,13 +548,59 @@ CesiumAsync::Future<GltfReaderResult> GltfReader::loadGltf(
               return asyncSystem.createResolvedFuture(std::move(result));
             }
 
+            if (!options.decodeEmbeddedImages ||
+                !hasExternalData(*result.model, options)) {
+              return resolveExternalData(
+                  asyncSystem,
+                  uri,
+                  pRequest->headers(),
+                  pAssetAccessor,
+                  options,
+                  std::move(result));
+            }
+
+            // Decode the embedded images that are already in memory while
+            // the external buffers and images are being downloaded. The
+            // worker owns copies of the encoded images, because the model
+            // is released if resolving the external data fails.
+            Future<std::vector<DecodedResidentImage>> decodedImagesFuture =
+                asyncSystem.runInWorkerThread(
+                    [images = findResidentImages(*result.model),
+                     ktx2TranscodeTargets = options.ktx2TranscodeTargets]() {
+                      CESIUM_TRACE("CesiumGltfReader::decodeResidentImages");
+                      std::vector<DecodedResidentImage> decoded;
+                      decoded.reserve(images.size());
+                      for (const ResidentImage& image : images) {
+                        decoded.emplace_back(DecodedResidentImage{
+                            image.imageIndex,
+                            ImageDecoder::readImage(
+                                image.data,
+                                ktx2TranscodeTargets)});
+                      }
+                      return decoded;
+                    });
+
             return resolveExternalData(
-                asyncSystem,
-                uri,
-                pRequest->headers(),
-                pAssetAccessor,
-                options,
-                std::move(result));
+                       asyncSystem,
+                       uri,
+                       pRequest->headers(),
+                       pAssetAccessor,
+                       options,
+                       std::move(result))
+                .thenImmediately(
+                    [decodedImagesFuture = std::move(decodedImagesFuture)](
+                        GltfReaderResult&& resolvedResult) mutable {
+                      return std::move(decodedImagesFuture)
+                          .thenImmediately(
+                              [result = std::move(resolvedResult)](
+                                  std::vector<DecodedResidentImage>&&
+                                      decodedImages) mutable {
+                                applyResidentImages(
+                                    result,
+                                    std::move(decodedImages));
+                                return std::move(result);
+                              });
+                    });
           })
       .thenInWorkerThread([options](GltfReaderResult&& result) {
         postprocess(result, options);
@@ -502,12 +674,8 @@ void CesiumGltfReader::GltfReader::postprocessGltf(
   std::vector<Future<ExternalBufferLoadResult>> resolvedBuffers;
   resolvedBuffers.reserve(uriBuffersCount);
 
-  // We need to skip data uris.
-  constexpr std::string_view dataPrefix = "data:";
-  constexpr size_t dataPrefixLength = dataPrefix.size();
-
   for (Buffer& buffer : pResult->model->buffers) {
-    if (buffer.uri && buffer.uri->substr(0, dataPrefixLength) != dataPrefix) {
+    if (isExternalUri(buffer.uri)) {
       resolvedBuffers.push_back(
           pAssetAccessor
               ->get(asyncSystem, Uri::resolve(baseUrl, *buffer.uri), tHeaders)
@@ -545,7 +713,7 @@ void CesiumGltfReader::GltfReader::postprocessGltf(
 
   if (options.resolveExternalImages) {
     for (Image& image : pResult->model->images) {
-      if (image.uri && image.uri->substr(0, dataPrefixLength) != dataPrefix) {
+      if (isExternalUri(image.uri)) {
         const std::string uri = Uri::resolve(baseUrl, *image.uri);
 
         auto getAsset =
@@ -64,6 +64,47 @@ bool isWebP(const std::span<const std::byte>& data) {
   return magic1 == 0x46464952 && magic2 == 0x50424557;
 }
 
+ktx_transcode_fmt_e
+getKtxTranscodeFormat(GpuCompressedPixelFormat compressedPixelFormat) {
+  switch (compressedPixelFormat) {
+  case GpuCompressedPixelFormat::ETC1_RGB:
+    return KTX_TTF_ETC1_RGB;
+  case GpuCompressedPixelFormat::ETC2_RGBA:
+    return KTX_TTF_ETC2_RGBA;
+  case GpuCompressedPixelFormat::BC1_RGB:
+    return KTX_TTF_BC1_RGB;
+  case GpuCompressedPixelFormat::BC3_RGBA:
+    return KTX_TTF_BC3_RGBA;
+  case GpuCompressedPixelFormat::BC4_R:
+    return KTX_TTF_BC4_R;
+  case GpuCompressedPixelFormat::BC5_RG:
+    return KTX_TTF_BC5_RG;
+  case GpuCompressedPixelFormat::BC7_RGBA:
+    return KTX_TTF_BC7_RGBA;
+  case GpuCompressedPixelFormat::PVRTC1_4_RGB:
+    return KTX_TTF_PVRTC1_4_RGB;
+  case GpuCompressedPixelFormat::PVRTC1_4_RGBA:
+    return KTX_TTF_PVRTC1_4_RGBA;
+  case GpuCompressedPixelFormat::ASTC_4x4_RGBA:
+    return KTX_TTF_ASTC_4x4_RGBA;
+  case GpuCompressedPixelFormat::PVRTC2_4_RGB:
+    return KTX_TTF_PVRTC2_4_RGB;
+  case GpuCompressedPixelFormat::PVRTC2_4_RGBA:
+    return KTX_TTF_PVRTC2_4_RGBA;
+  case GpuCompressedPixelFormat::ETC2_EAC_R11:
+    return KTX_TTF_ETC2_EAC_R11;
+  case GpuCompressedPixelFormat::ETC2_EAC_RG11:
+    return KTX_TTF_ETC2_EAC_RG11;
+  // case NONE:
+  default:
+    return KTX_TTF_RGBA32;
+  }
+}
+
+// VK_FORMAT_R8G8B8A8_UNORM, the Vulkan format of an uncompressed 8-bit RGBA
+// image.
+constexpr ktx_uint32_t vkFormatR8G8B8A8Unorm = 37;
+
 } // namespace
 
 /*static*/
@@ -128,55 +169,8 @@ ImageReaderResult ImageDecoder::readImage(
           }
         }
 
-        ktx_transcode_fmt_e transcodeTargetFormat_ = KTX_TTF_RGBA32;
-        switch (transcodeTargetFormat) {
-        case GpuCompressedPixelFormat::ETC1_RGB:
-          transcodeTargetFormat_ = KTX_TTF_ETC1_RGB;
-          break;
-        case GpuCompressedPixelFormat::ETC2_RGBA:
-          transcodeTargetFormat_ = KTX_TTF_ETC2_RGBA;
-          break;
-        case GpuCompressedPixelFormat::BC1_RGB:
-          transcodeTargetFormat_ = KTX_TTF_BC1_RGB;
-          break;
-        case GpuCompressedPixelFormat::BC3_RGBA:
-          transcodeTargetFormat_ = KTX_TTF_BC3_RGBA;
-          break;
-        case GpuCompressedPixelFormat::BC4_R:
-          transcodeTargetFormat_ = KTX_TTF_BC4_R;
-          break;
-        case GpuCompressedPixelFormat::BC5_RG:
-          transcodeTargetFormat_ = KTX_TTF_BC5_RG;
-          break;
-        case GpuCompressedPixelFormat::BC7_RGBA:
-          transcodeTargetFormat_ = KTX_TTF_BC7_RGBA;
-          break;
-        case GpuCompressedPixelFormat::PVRTC1_4_RGB:
-          transcodeTargetFormat_ = KTX_TTF_PVRTC1_4_RGB;
-          break;
-        case GpuCompressedPixelFormat::PVRTC1_4_RGBA:
-          transcodeTargetFormat_ = KTX_TTF_PVRTC1_4_RGBA;
-          break;
-        case GpuCompressedPixelFormat::ASTC_4x4_RGBA:
-          transcodeTargetFormat_ = KTX_TTF_ASTC_4x4_RGBA;
-          break;
-        case GpuCompressedPixelFormat::PVRTC2_4_RGB:
-          transcodeTargetFormat_ = KTX_TTF_PVRTC2_4_RGB;
-          break;
-        case GpuCompressedPixelFormat::PVRTC2_4_RGBA:
-          transcodeTargetFormat_ = KTX_TTF_PVRTC2_4_RGBA;
-          break;
-        case GpuCompressedPixelFormat::ETC2_EAC_R11:
-          transcodeTargetFormat_ = KTX_TTF_ETC2_EAC_R11;
-          break;
-        case GpuCompressedPixelFormat::ETC2_EAC_RG11:
-          transcodeTargetFormat_ = KTX_TTF_ETC2_EAC_RG11;
-          break;
-        // case NONE:
-        default:
-          transcodeTargetFormat_ = KTX_TTF_RGBA32;
-          break;
-        };
+        ktx_transcode_fmt_e transcodeTargetFormat_ =
+            getKtxTranscodeFormat(transcodeTargetFormat);
 
         errorCode =
             ktxTexture2_TranscodeBasis(pTexture, transcodeTargetFormat_, 0);
@@ -360,6 +354,132 @@ ImageReaderResult ImageDecoder::readImage(
   return result;
 }
 
+/*static*/
+std::optional<std::string> ImageDecoder::compressImage(
+    ImageAsset& image,
+    GpuCompressedPixelFormat targetFormat) {
+  if (targetFormat == GpuCompressedPixelFormat::NONE) {
+    return "Unable to compress image, no target format was provided.";
+  }
+
+  if (image.compressedPixelFormat != GpuCompressedPixelFormat::NONE) {
+    return "Unable to compress image, it is already compressed.";
+  }
+
+  if (image.width <= 0 || image.height <= 0 || image.channels != 4 ||
+      image.bytesPerChannel != 1) {
+    return "Unable to compress image, only 8-bit RGBA images are supported.";
+  }
+
+  CESIUM_TRACE(
+      "compress image " + std::to_string(image.width) + "x" +
+      std::to_string(image.height));
+
+  // Mipmaps can't be generated from the compressed pixels, so generate them
+  // now and compress them along with the base image. They're generated in a
+  // copy, so that the image is left unchanged if compression fails.
+  const ImageAsset* pSource = &image;
+  ImageAsset mipmapped;
+  if (image.mipPositions.empty()) {
+    mipmapped.width = image.width;
+    mipmapped.height = image.height;
+    mipmapped.channels = image.channels;
+    mipmapped.bytesPerChannel = image.bytesPerChannel;
+    mipmapped.pixelData = image.pixelData;
+
+    std::optional<std::string> mipError =
+        ImageDecoder::generateMipMaps(mipmapped);
+    if (mipError) {
+      return mipError;
+    }
+
+    pSource = &mipmapped;
+  }
+
+  ktxTextureCreateInfo createInfo{};
+  createInfo.vkFormat = vkFormatR8G8B8A8Unorm;
+  createInfo.baseWidth = static_cast<ktx_uint32_t>(image.width);
+  createInfo.baseHeight = static_cast<ktx_uint32_t>(image.height);
+  createInfo.baseDepth = 1;
+  createInfo.numDimensions = 2;
+  createInfo.numLevels =
+      static_cast<ktx_uint32_t>(pSource->mipPositions.size());
+  createInfo.numLayers = 1;
+  createInfo.numFaces = 1;
+  createInfo.isArray = KTX_FALSE;
+  createInfo.generateMipmaps = KTX_FALSE;
+
+  ktxTexture2* pTexture = nullptr;
+  KTX_error_code errorCode = ktxTexture2_Create(
+      &createInfo,
+      KTX_TEXTURE_CREATE_ALLOC_STORAGE,
+      &pTexture);
+  if (errorCode != KTX_SUCCESS) {
+    return std::string("Unable to create KTX texture: ") +
+           ktxErrorString(errorCode);
+  }
+
+  for (size_t level = 0;
+       errorCode == KTX_SUCCESS && level < pSource->mipPositions.size();
+       ++level) {
+    const ImageAssetMipPosition& mip = pSource->mipPositions[level];
+    errorCode = ktxTexture_SetImageFromMemory(
+        ktxTexture(pTexture),
+        static_cast<ktx_uint32_t>(level),
+        0,
+        0,
+        reinterpret_cast<const ktx_uint8_t*>(
+            &pSource->pixelData[mip.byteOffset]),
+        mip.byteSize);
+  }
+
+  if (errorCode == KTX_SUCCESS) {
+    // UASTC can be transcoded to every GPU format that KTX2 images can be, at
+    // a higher quality than ETC1S. The fastest packing level is used because
+    // this runs for every overlay tile.
+    ktxBasisParams params{};
+    params.structSize = sizeof(params);
+    params.uastc = KTX_TRUE;
+    params.threadCount = 1;
+    params.uastcFlags = KTX_PACK_UASTC_LEVEL_FASTEST;
+    errorCode = ktxTexture2_CompressBasisEx(pTexture, &params);
+  }
+
+  if (errorCode == KTX_SUCCESS) {
+    errorCode = ktxTexture2_TranscodeBasis(
+        pTexture,
+        getKtxTranscodeFormat(targetFormat),
+        0);
+  }
+
+  if (errorCode != KTX_SUCCESS) {
+    ktxTexture_Destroy(ktxTexture(pTexture));
+    return std::string("Unable to compress image: ") +
+           ktxErrorString(errorCode);
+  }
+
+  std::vector<ImageAssetMipPosition> mipPositions(pTexture->numLevels);
+  for (ktx_uint32_t level = 0; level < pTexture->numLevels; ++level) {
+    ktx_size_t imageOffset;
+    ktxTexture_GetImageOffset(ktxTexture(pTexture), level, 0, 0, &imageOffset);
+    mipPositions[level] = {
+        imageOffset,
+        ktxTexture_GetImageSize(ktxTexture(pTexture), level)};
+  }
+
+  const std::byte* pPixelData = reinterpret_cast<const std::byte*>(
+      ktxTexture_GetData(ktxTexture(pTexture)));
+  image.pixelData.assign(
+      pPixelData,
+      pPixelData + ktxTexture_GetDataSize(ktxTexture(pTexture)));
+  image.mipPositions = std::move(mipPositions);
+  image.compressedPixelFormat = targetFormat;
+
+  ktxTexture_Destroy(ktxTexture(pTexture));
+
+  return std::nullopt;
+}
+
 /*static*/
 std::optional<std::string> ImageDecoder::generateMipMaps(ImageAsset& image) {
   if (!image.mipPositions.empty() ||
@@ -18,11 +18,11 @@ void NamedObjectJsonHandler::reset(
 
 CesiumJsonReader::IJsonHandler*
 NamedObjectJsonHandler::readObjectKeyNamedObject(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumGltf::NamedObject& o) {
-  using namespace std::string_literals;
-  if ("name"s == str)
+  using namespace std::string_view_literals;
+  if ("name"sv == str)
     return property("name", this->_name, o.name);
   return this->readObjectKeyExtensibleObject(objectType, str, o);
 }
@@ -17,7 +17,7 @@ protected:
       const CesiumJsonReader::JsonReaderOptions& context) noexcept;
   void reset(IJsonHandler* pParentReader, CesiumGltf::NamedObject* pObject);
   IJsonHandler* readObjectKeyNamedObject(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumGltf::NamedObject& o);
 
@@ -7,6 +7,8 @@
 #include <CesiumUtility/Tracing.h>
 
 #include <cstddef>
+#include <optional>
+#include <span>
 #include <string>
 
 #ifdef _MSC_VER
@@ -24,43 +26,56 @@
 namespace CesiumGltfReader {
 
 namespace {
-std::unique_ptr<draco::Mesh> decodeBufferViewToDracoMesh(
+std::optional<std::span<const std::byte>> getDracoData(
     GltfReaderResult& readGltf,
-    CesiumGltf::MeshPrimitive& /* primitive */,
     const CesiumGltf::ExtensionKhrDracoMeshCompression& draco) {
-  CESIUM_TRACE("CesiumGltfReader::decodeBufferViewToDracoMesh");
-  CesiumGltf::Model& model = readGltf.model.value();
+  const CesiumGltf::Model& model = readGltf.model.value();
 
-  CesiumGltf::BufferView* pBufferView =
+  const CesiumGltf::BufferView* pBufferView =
       CesiumGltf::Model::getSafe(&model.bufferViews, draco.bufferView);
   if (!pBufferView) {
     readGltf.warnings.emplace_back("Draco bufferView index is invalid.");
-    return nullptr;
+    return std::nullopt;
   }
 
   const CesiumGltf::BufferView& bufferView = *pBufferView;
 
-  CesiumGltf::Buffer* pBuffer =
+  const CesiumGltf::Buffer* pBuffer =
       CesiumGltf::Model::getSafe(&model.buffers, bufferView.buffer);
   if (!pBuffer) {
     readGltf.warnings.emplace_back(
         "Draco bufferView has an invalid buffer index.");
-    return nullptr;
+    return std::nullopt;
   }
 
-  CesiumGltf::Buffer& buffer = *pBuffer;
+  const CesiumGltf::Buffer& buffer = *pBuffer;
 
   if (bufferView.byteOffset < 0 || bufferView.byteLength < 0 ||
       bufferView.byteOffset + bufferView.byteLength >
           static_cast<int64_t>(buffer.cesium.data.size())) {
     readGltf.warnings.emplace_back(
         "Draco bufferView extends beyond its buffer.");
-    return nullptr;
+    return std::nullopt;
   }
 
-  const std::span<const std::byte> data(
+  return std::span<const std::byte>(
       buffer.cesium.data.data() + bufferView.byteOffset,
       static_cast<uint64_t>(bufferView.byteLength));
+}
+
+std::unique_ptr<draco::Mesh> decodeBufferViewToDracoMesh(
+    GltfReaderResult& readGltf,
+    CesiumGltf::MeshPrimitive& /* primitive */,
+    const CesiumGltf::ExtensionKhrDracoMeshCompression& draco) {
+  CESIUM_TRACE("CesiumGltfReader::decodeBufferViewToDracoMesh");
+
+  const std::optional<std::span<const std::byte>> maybeData =
+      getDracoData(readGltf, draco);
+  if (!maybeData) {
+    return nullptr;
+  }
+
+  const std::span<const std::byte>& data = *maybeData;
 
   draco::DecoderBuffer decodeBuffer;
   decodeBuffer.Init(reinterpret_cast<const char*>(data.data()), data.size());
@@ -323,8 +338,80 @@ void decodePrimitive(
         pAttribute);
   }
 }
+void validatePrimitive(
+    GltfReaderResult& readGltf,
+    const CesiumGltf::MeshPrimitive& primitive,
+    const CesiumGltf::ExtensionKhrDracoMeshCompression& draco) {
+  const std::optional<std::span<const std::byte>> maybeData =
+      getDracoData(readGltf, draco);
+  if (!maybeData) {
+    return;
+  }
+
+  // Only the header is parsed here, the geometry itself is not decoded.
+  draco::DecoderBuffer decodeBuffer;
+  decodeBuffer.Init(
+      reinterpret_cast<const char*>(maybeData->data()),
+      maybeData->size());
+  draco::StatusOr<draco::EncodedGeometryType> geometryType =
+      draco::Decoder::GetEncodedGeometryType(&decodeBuffer);
+  if (!geometryType.ok()) {
+    readGltf.warnings.emplace_back(
+        std::string("Draco header is invalid: ") +
+        geometryType.status().error_msg_string());
+    return;
+  }
+
+  const CesiumGltf::Model& model = readGltf.model.value();
+
+  for (const std::pair<const std::string, int32_t>& attribute :
+       draco.attributes) {
+    auto primitiveAttrIt = primitive.attributes.find(attribute.first);
+    if (primitiveAttrIt == primitive.attributes.end()) {
+      readGltf.warnings.emplace_back(
+          "Draco extension has the " + attribute.first +
+          " attribute, but the primitive does not have that attribute.");
+      continue;
+    }
+
+    const CesiumGltf::Accessor* pAccessor =
+        CesiumGltf::Model::getSafe(&model.accessors, primitiveAttrIt->second);
+    if (!pAccessor) {
+      readGltf.warnings.emplace_back(
+          "Primitive attribute's accessor index is invalid.");
+      continue;
+    }
+
+    // Without decoding, the accessor's bounds are the only source of the
+    // primitive's extents.
+    if (attribute.first == "POSITION" &&
+        (pAccessor->min.size() != 3 || pAccessor->max.size() != 3)) {
+      readGltf.warnings.emplace_back(
+          "Draco-compressed POSITION accessor does not have valid min and max "
+          "values.");
+    }
+  }
+}
 } // namespace
 
+void validateDraco(GltfReaderResult& readGltf) {
+  CESIUM_TRACE("CesiumGltfReader::validateDraco");
+  if (!readGltf.model) {
+    return;
+  }
+
+  for (const CesiumGltf::Mesh& mesh : readGltf.model->meshes) {
+    for (const CesiumGltf::MeshPrimitive& primitive : mesh.primitives) {
+      const CesiumGltf::ExtensionKhrDracoMeshCompression* pDraco =
+          primitive
+              .getExtension<CesiumGltf::ExtensionKhrDracoMeshCompression>();
+      if (pDraco) {
+        validatePrimitive(readGltf, primitive, *pDraco);
+      }
+    }
+  }
+}
+
 void decodeDraco(CesiumGltfReader::GltfReaderResult& readGltf) {
   CESIUM_TRACE("CesiumGltfReader::decodeDraco");
   if (!readGltf.model) {
@@ -4,4 +4,14 @@ namespace CesiumGltfReader {
 struct GltfReaderResult;
 
 void decodeDraco(GltfReaderResult& readGltf);
+
+/**
+ * @brief Checks that the data of each primitive compressed with the
+ * KHR_draco_mesh_compression extension is usable without decoding it.
+ *
+ * The compressed buffer view must lie within its buffer, the Draco header
+ * must be valid, and the attributes must refer to valid accessors. Problems
+ * are reported as warnings in the result.
+ */
+void validateDraco(GltfReaderResult& readGltf);
 } // namespace CesiumGltfReader
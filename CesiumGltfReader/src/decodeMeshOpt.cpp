@@ -3,6 +3,11 @@
 #include <CesiumGltf/ExtensionBufferViewExtMeshoptCompression.h>
 #include <CesiumGltfReader/GltfReader.h>
 
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <vector>
+
 #ifdef __GNUC__
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wsign-conversion"
@@ -99,6 +104,38 @@ int decodeBufferView(
     }
   }
 }
+
+std::optional<std::span<const std::byte>> getMeshOptData(
+    const Model& model,
+    GltfReaderResult& readGltf,
+    const ExtensionBufferViewExtMeshoptCompression& meshOpt) {
+  const Buffer* pBuffer = model.getSafe(&model.buffers, meshOpt.buffer);
+  if (!pBuffer) {
+    readGltf.warnings.emplace_back(
+        "The EXT_meshopt_compression extension has an invalid buffer "
+        "index.");
+    return std::nullopt;
+  }
+
+  if (meshOpt.byteOffset < 0 || meshOpt.byteLength < 0 ||
+      static_cast<size_t>(meshOpt.byteOffset + meshOpt.byteLength) >
+          pBuffer->cesium.data.size()) {
+    readGltf.warnings.emplace_back(
+        "The EXT_meshopt_compression extension has a bufferView that "
+        "extends beyond its buffer.");
+    return std::nullopt;
+  }
+
+  if (meshOpt.byteStride * meshOpt.count < 0) {
+    readGltf.warnings.emplace_back("The EXT_meshopt_compression extension "
+                                   "has a negative byte length.");
+    return std::nullopt;
+  }
+
+  return std::span<const std::byte>(
+      pBuffer->cesium.data.data() + meshOpt.byteOffset,
+      static_cast<size_t>(meshOpt.byteLength));
+}
 } // namespace
 
 void decodeMeshOpt(Model& model, CesiumGltfReader::GltfReaderResult& readGltf) {
@@ -106,37 +143,16 @@ void decodeMeshOpt(Model& model, CesiumGltfReader::GltfReaderResult& readGltf) {
     const ExtensionBufferViewExtMeshoptCompression* pMeshOpt =
         bufferView.getExtension<ExtensionBufferViewExtMeshoptCompression>();
     if (pMeshOpt) {
-      const Buffer* pBuffer = model.getSafe(&model.buffers, pMeshOpt->buffer);
-      if (!pBuffer) {
-        readGltf.warnings.emplace_back(
-            "The EXT_meshopt_compression extension has an invalid buffer "
-            "index.");
+      const std::optional<std::span<const std::byte>> maybeCompressed =
+          getMeshOptData(model, readGltf, *pMeshOpt);
+      if (!maybeCompressed) {
         continue;
       }
 
-      if (pMeshOpt->byteOffset < 0 || pMeshOpt->byteLength < 0 ||
-          static_cast<size_t>(pMeshOpt->byteOffset + pMeshOpt->byteLength) >
-              pBuffer->cesium.data.size()) {
-        readGltf.warnings.emplace_back(
-            "The EXT_meshopt_compression extension has a bufferView that "
-            "extends beyond its buffer.");
-        continue;
-      }
       int64_t byteLength = pMeshOpt->byteStride * pMeshOpt->count;
-      if (byteLength < 0) {
-        readGltf.warnings.emplace_back("The EXT_meshopt_compression extension "
-                                       "has a negative byte length.");
-        continue;
-      }
-
       std::vector<std::byte> data;
       data.resize(static_cast<size_t>(byteLength));
-      if (decodeBufferView(
-              data.data(),
-              std::span<const std::byte>(
-                  pBuffer->cesium.data.data() + pMeshOpt->byteOffset,
-                  static_cast<size_t>(pMeshOpt->byteLength)),
-              *pMeshOpt) != 0) {
+      if (decodeBufferView(data.data(), *maybeCompressed, *pMeshOpt) != 0) {
         readGltf.warnings.emplace_back(
             "The EXT_meshopt_compression extension has a corrupted or "
             "incompatible meshopt compression buffer.");
@@ -158,4 +174,16 @@ void decodeMeshOpt(Model& model, CesiumGltfReader::GltfReaderResult& readGltf) {
   model.removeExtensionRequired(
       CesiumGltf::ExtensionBufferViewExtMeshoptCompression::ExtensionName);
 }
+
+void validateMeshOpt(
+    const Model& model,
+    CesiumGltfReader::GltfReaderResult& readGltf) {
+  for (const BufferView& bufferView : model.bufferViews) {
+    const ExtensionBufferViewExtMeshoptCompression* pMeshOpt =
+        bufferView.getExtension<ExtensionBufferViewExtMeshoptCompression>();
+    if (pMeshOpt) {
+      getMeshOptData(model, readGltf, *pMeshOpt);
+    }
+  }
+}
 } // namespace CesiumGltfReader
@@ -21,4 +21,13 @@ namespace CesiumGltfReader {
 void decodeMeshOpt(
     CesiumGltf::Model& model,
     CesiumGltfReader::GltfReaderResult& readGltf);
+
+/**
+ * @brief Checks that the compressed data of each buffer view using the
+ * EXT_meshopt_compression extension lies within its buffer, without decoding
+ * it. Problems are reported as warnings in the result.
+ */
+void validateMeshOpt(
+    const CesiumGltf::Model& model,
+    CesiumGltfReader::GltfReaderResult& readGltf);
 } // namespace CesiumGltfReader
@@ -1,6 +1,19 @@
 #include "dequantizeMeshData.h"
 
-#include <CesiumGltfReader/GltfReader.h>
+#include <CesiumGltf/Accessor.h>
+#include <CesiumGltf/Buffer.h>
+#include <CesiumGltf/BufferView.h>
+#include <CesiumGltf/Mesh.h>
+#include <CesiumGltf/MeshPrimitive.h>
+#include <CesiumGltf/Model.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 using namespace CesiumGltf;
 
@@ -8,173 +21,304 @@ namespace CesiumGltfReader {
 
 namespace {
 
-template <typename T> float intToFloat(T t) = delete;
-
-template <> float intToFloat(std::int8_t c) {
-  return std::max(c / 127.0f, -1.0f);
+/**
+ * @brief The factor that maps the range of a normalized integer type onto
+ * [0, 1] or [-1, 1], as specified in the glTF specification.
+ */
+template <typename T> constexpr float normalizationFactor() = delete;
+template <> constexpr float normalizationFactor<std::int8_t>() {
+  return 1.0f / 127.0f;
 }
-
-template <> float intToFloat(std::uint8_t c) { return c / 127.0f; }
-
-template <> float intToFloat(std::int16_t c) {
-  return std::max(c / 65535.0f, -1.0f);
+template <> constexpr float normalizationFactor<std::uint8_t>() {
+  return 1.0f / 255.0f;
 }
-
-template <> float intToFloat(std::uint16_t c) { return c / 65535.0f; }
-
-template <typename T, size_t N>
-void normalizeQuantized(
-    float* fPtr,
-    int64_t count,
-    const std::byte* bPtr,
-    int64_t stride) {
-  for (int i = 0; i < count; i++, bPtr += stride) {
-    for (unsigned int j = 0; j < N; j++) {
-      *fPtr++ = intToFloat<T>(reinterpret_cast<const T*>(bPtr)[j]);
-    }
-  }
+template <> constexpr float normalizationFactor<std::int16_t>() {
+  return 1.0f / 32767.0f;
 }
-
-template <typename T, size_t N>
-void castQuantizedToFloat(
-    float* fPtr,
-    int64_t count,
-    const std::byte* bPtr,
-    int64_t stride) {
-  for (int i = 0; i < count; i++, bPtr += stride) {
-    for (unsigned int j = 0; j < N; j++) {
-      *fPtr++ = static_cast<float>(reinterpret_cast<const T*>(bPtr)[j]);
-    }
-  }
+template <> constexpr float normalizationFactor<std::uint16_t>() {
+  return 1.0f / 65535.0f;
 }
 
-template <typename T, size_t N>
-void dequantizeAccessor(Model& model, Accessor& accessor) {
-
-  BufferView* pBufferView =
-      Model::getSafe(&model.bufferViews, accessor.bufferView);
-
-  if (!pBufferView) {
-    return;
-  }
-
-  Buffer* pBuffer = Model::getSafe(&model.buffers, pBufferView->buffer);
-  if (!pBuffer) {
-    return;
-  }
-
-  int64_t byteStride;
-  if (pBufferView->byteStride) {
-    byteStride = *pBufferView->byteStride;
+template <typename T, bool Normalized> float convertComponent(T value) {
+  if constexpr (!Normalized) {
+    return static_cast<float>(value);
+  } else if constexpr (std::is_signed_v<T>) {
+    return std::max(
+        static_cast<float>(value) * normalizationFactor<T>(),
+        -1.0f);
   } else {
-    byteStride = accessor.computeByteStride(model);
+    return static_cast<float>(value) * normalizationFactor<T>();
   }
+}
 
-  if (static_cast<size_t>(
-          pBufferView->byteOffset + accessor.byteOffset +
-          accessor.count * byteStride) > pBuffer->cesium.data.size() ||
-      static_cast<int64_t>(sizeof(T) * N) > byteStride) {
+/**
+ * @brief Converts `count` elements of `N` components of type `T` to floats.
+ *
+ * Tightly-packed source data is converted in a single flat, branch-free loop
+ * over all components, which compilers reliably turn into SIMD instructions.
+ * Interleaved data falls back to a loop over elements with a fixed-size inner
+ * loop.
+ */
+template <typename T, size_t N, bool Normalized>
+void convertElements(
+    float* pDestination,
+    const std::byte* pSource,
+    int64_t count,
+    int64_t byteStride) {
+  if (byteStride == static_cast<int64_t>(sizeof(T) * N)) {
+    const T* pTypedSource = reinterpret_cast<const T*>(pSource);
+    const size_t componentCount = static_cast<size_t>(count) * N;
+    for (size_t i = 0; i < componentCount; ++i) {
+      pDestination[i] = convertComponent<T, Normalized>(pTypedSource[i]);
+    }
     return;
   }
 
-  int64_t byteLength = accessor.count * static_cast<int64_t>(N * sizeof(float));
-  if (byteLength < 0) {
-    return;
+  for (int64_t i = 0; i < count; ++i, pSource += byteStride) {
+    const T* pTypedSource = reinterpret_cast<const T*>(pSource);
+    for (size_t j = 0; j < N; ++j) {
+      *pDestination++ = convertComponent<T, Normalized>(pTypedSource[j]);
+    }
   }
+}
 
-  std::vector<std::byte> data;
-  data.resize(static_cast<size_t>(byteLength));
-
-  const std::byte* bPtr = pBuffer->cesium.data.data() +
-                          pBufferView->byteOffset + accessor.byteOffset;
-
+template <typename T, size_t N>
+void dequantizeElements(
+    Accessor& accessor,
+    float* pDestination,
+    const std::byte* pSource,
+    int64_t byteStride) {
   if (accessor.normalized) {
-    normalizeQuantized<T, N>(
-        reinterpret_cast<float*>(data.data()),
+    convertElements<T, N, true>(
+        pDestination,
+        pSource,
         accessor.count,
-        bPtr,
         byteStride);
     for (double& d : accessor.min) {
-      d = intToFloat<T>(static_cast<T>(d));
+      d = convertComponent<T, true>(static_cast<T>(d));
     }
     for (double& d : accessor.max) {
-      d = intToFloat<T>(static_cast<T>(d));
+      d = convertComponent<T, true>(static_cast<T>(d));
     }
   } else {
-    castQuantizedToFloat<T, N>(
-        reinterpret_cast<float*>(data.data()),
+    convertElements<T, N, false>(
+        pDestination,
+        pSource,
         accessor.count,
-        bPtr,
         byteStride);
   }
-  accessor.componentType = AccessorSpec::ComponentType::FLOAT;
-  accessor.byteOffset = 0;
-  accessor.bufferView = static_cast<int32_t>(model.bufferViews.size());
-  accessor.normalized = false;
-
-  BufferView& bufferView = model.bufferViews.emplace_back(*pBufferView);
-  bufferView.byteOffset = 0;
-  bufferView.byteStride = N * sizeof(float);
-  bufferView.byteLength = byteLength;
-  bufferView.buffer = static_cast<int32_t>(model.buffers.size());
-
-  Buffer& buffer = model.buffers.emplace_back();
-  buffer.cesium.data = std::move(data);
-  buffer.byteLength = byteLength;
 }
 
-template <size_t N> void dequantizeAccessor(Model& model, Accessor& accessor) {
+template <size_t N>
+void dequantizeElements(
+    Accessor& accessor,
+    float* pDestination,
+    const std::byte* pSource,
+    int64_t byteStride) {
   switch (accessor.componentType) {
   case Accessor::ComponentType::BYTE:
-    dequantizeAccessor<std::int8_t, N>(model, accessor);
+    dequantizeElements<std::int8_t, N>(
+        accessor,
+        pDestination,
+        pSource,
+        byteStride);
     break;
   case Accessor::ComponentType::UNSIGNED_BYTE:
-    dequantizeAccessor<std::uint8_t, N>(model, accessor);
+    dequantizeElements<std::uint8_t, N>(
+        accessor,
+        pDestination,
+        pSource,
+        byteStride);
     break;
   case Accessor::ComponentType::SHORT:
-    dequantizeAccessor<std::int16_t, N>(model, accessor);
+    dequantizeElements<std::int16_t, N>(
+        accessor,
+        pDestination,
+        pSource,
+        byteStride);
     break;
   case Accessor::ComponentType::UNSIGNED_SHORT:
-    dequantizeAccessor<std::uint16_t, N>(model, accessor);
+    dequantizeElements<std::uint16_t, N>(
+        accessor,
+        pDestination,
+        pSource,
+        byteStride);
     break;
   }
 }
 
-void dequantizeAccessor(Model& model, Accessor& accessor) {
-  int8_t numberOfComponents = accessor.computeNumberOfComponents();
-  switch (numberOfComponents) {
+void dequantizeElements(
+    Accessor& accessor,
+    float* pDestination,
+    const std::byte* pSource,
+    int64_t byteStride) {
+  switch (accessor.computeNumberOfComponents()) {
   case 2:
-    dequantizeAccessor<2>(model, accessor);
+    dequantizeElements<2>(accessor, pDestination, pSource, byteStride);
     break;
   case 3:
-    dequantizeAccessor<3>(model, accessor);
+    dequantizeElements<3>(accessor, pDestination, pSource, byteStride);
     break;
   case 4:
-    dequantizeAccessor<4>(model, accessor);
+    dequantizeElements<4>(accessor, pDestination, pSource, byteStride);
     break;
   }
 }
+
+bool isQuantizedComponentType(int32_t componentType) {
+  return componentType == Accessor::ComponentType::BYTE ||
+         componentType == Accessor::ComponentType::UNSIGNED_BYTE ||
+         componentType == Accessor::ComponentType::SHORT ||
+         componentType == Accessor::ComponentType::UNSIGNED_SHORT;
+}
+
+bool isDequantizedAttribute(const std::string& attributeName) {
+  return attributeName == "POSITION" || attributeName == "NORMAL" ||
+         attributeName == "TANGENT" || attributeName.starts_with("TEXCOORD");
+}
+
+/**
+ * @brief An accessor that will be dequantized, and the location of its
+ * floating-point data in the primitive's shared output buffer.
+ */
+struct DequantizationTarget {
+  int32_t accessorIndex;
+  int32_t sourceBufferViewIndex;
+  const std::byte* pSource;
+  int64_t sourceByteStride;
+  int64_t destinationByteOffset;
+  int64_t destinationByteLength;
+};
+
+std::optional<DequantizationTarget>
+planDequantization(const Model& model, int32_t accessorIndex) {
+  const Accessor* pAccessor = Model::getSafe(&model.accessors, accessorIndex);
+  if (!pAccessor || !isQuantizedComponentType(pAccessor->componentType)) {
+    return std::nullopt;
+  }
+
+  const int8_t numberOfComponents = pAccessor->computeNumberOfComponents();
+  if (numberOfComponents < 2 || numberOfComponents > 4) {
+    return std::nullopt;
+  }
+
+  const BufferView* pBufferView =
+      Model::getSafe(&model.bufferViews, pAccessor->bufferView);
+  if (!pBufferView) {
+    return std::nullopt;
+  }
+
+  const Buffer* pBuffer = Model::getSafe(&model.buffers, pBufferView->buffer);
+  if (!pBuffer) {
+    return std::nullopt;
+  }
+
+  const int64_t byteStride = pBufferView->byteStride
+                                 ? *pBufferView->byteStride
+                                 : pAccessor->computeByteStride(model);
+
+  if (pAccessor->count < 0 ||
+      static_cast<size_t>(
+          pBufferView->byteOffset + pAccessor->byteOffset +
+          pAccessor->count * byteStride) > pBuffer->cesium.data.size() ||
+      pAccessor->computeBytesPerVertex() > byteStride) {
+    return std::nullopt;
+  }
+
+  return DequantizationTarget{
+      accessorIndex,
+      pAccessor->bufferView,
+      pBuffer->cesium.data.data() + pBufferView->byteOffset +
+          pAccessor->byteOffset,
+      byteStride,
+      0,
+      pAccessor->count * numberOfComponents *
+          static_cast<int64_t>(sizeof(float))};
+}
+
+/**
+ * @brief Dequantizes the given accessors into a single new buffer, with one
+ * new buffer view per accessor.
+ */
+void dequantizeIntoSharedBuffer(
+    Model& model,
+    std::vector<DequantizationTarget>& targets) {
+  int64_t totalByteLength = 0;
+  for (DequantizationTarget& target : targets) {
+    // Every destination is a float array, so offsets stay 4-byte aligned.
+    target.destinationByteOffset = totalByteLength;
+    totalByteLength += target.destinationByteLength;
+  }
+
+  std::vector<std::byte> data(static_cast<size_t>(totalByteLength));
+
+  const int32_t bufferIndex = static_cast<int32_t>(model.buffers.size());
+  model.bufferViews.reserve(model.bufferViews.size() + targets.size());
+
+  for (const DequantizationTarget& target : targets) {
+    Accessor& accessor =
+        model.accessors[static_cast<size_t>(target.accessorIndex)];
+
+    dequantizeElements(
+        accessor,
+        reinterpret_cast<float*>(data.data() + target.destinationByteOffset),
+        target.pSource,
+        target.sourceByteStride);
+
+    accessor.componentType = AccessorSpec::ComponentType::FLOAT;
+    accessor.byteOffset = 0;
+    accessor.bufferView = static_cast<int32_t>(model.bufferViews.size());
+    accessor.normalized = false;
+
+    BufferView bufferView =
+        model.bufferViews[static_cast<size_t>(target.sourceBufferViewIndex)];
+    bufferView.buffer = bufferIndex;
+    bufferView.byteOffset = target.destinationByteOffset;
+    bufferView.byteLength = target.destinationByteLength;
+    bufferView.byteStride = accessor.computeNumberOfComponents() *
+                            static_cast<int64_t>(sizeof(float));
+    model.bufferViews.emplace_back(std::move(bufferView));
+  }
+
+  Buffer& buffer = model.buffers.emplace_back();
+  buffer.byteLength = totalByteLength;
+  buffer.cesium.data = std::move(data);
+}
 } // namespace
 
 void dequantizeMeshData(Model& model) {
+  std::vector<DequantizationTarget> targets;
+
   for (Mesh& mesh : model.meshes) {
     for (MeshPrimitive& primitive : mesh.primitives) {
-      for (std::pair<const std::string, int32_t> attribute :
-           primitive.attributes) {
-        Accessor* pAccessor =
-            Model::getSafe(&model.accessors, attribute.second);
-        if (!pAccessor) {
+      targets.clear();
+
+      for (const auto& [attributeName, accessorIndex] : primitive.attributes) {
+        if (!isDequantizedAttribute(attributeName)) {
           continue;
         }
-        if (pAccessor->componentType == Accessor::ComponentType::FLOAT) {
+
+        // The same accessor may be used by more than one attribute.
+        const bool alreadyPlanned = std::any_of(
+            targets.begin(),
+            targets.end(),
+            [accessorIndex = accessorIndex](const DequantizationTarget& t) {
+              return t.accessorIndex == accessorIndex;
+            });
+        if (alreadyPlanned) {
           continue;
         }
-        const std::string& attributeName = attribute.first;
-        if (attributeName == "POSITION" || attributeName == "NORMAL" ||
-            attributeName == "TANGENT" || attributeName.find("TEXCOORD") == 0) {
-          dequantizeAccessor(model, *pAccessor);
+
+        std::optional<DequantizationTarget> maybeTarget =
+            planDequantization(model, accessorIndex);
+        if (maybeTarget) {
+          targets.emplace_back(*maybeTarget);
         }
       }
+
+      if (!targets.empty()) {
+        dequantizeIntoSharedBuffer(model, targets);
+      }
     }
   }
 
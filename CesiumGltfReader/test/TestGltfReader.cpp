@@ -14,9 +14,12 @@
 
 #include <catch2/catch.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
 #include <rapidjson/reader.h>
 
+#include <algorithm>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <limits>
@@ -222,6 +225,123 @@ TEST_CASE("Can decompress meshes using EXT_meshopt_compression") {
   }
 }
 
+TEST_CASE("Can keep EXT_meshopt_compression data compressed") {
+  GltfReaderOptions options;
+  options.decodeMeshOptData = false;
+  options.dequantizeMeshData = false;
+
+  GltfReader reader;
+  GltfReaderResult result = reader.readGltf(
+      readFile(
+          CesiumGltfReader_TEST_DATA_DIR +
+          std::string("/DucksMeshopt/Duck.glb")),
+      options);
+  REQUIRE(result.model);
+  CHECK(result.errors.empty());
+  CHECK(result.warnings.empty());
+
+  const Model& model = result.model.value();
+  CHECK(model.isExtensionUsed(
+      ExtensionBufferViewExtMeshoptCompression::ExtensionName));
+
+  const bool anyCompressed = std::any_of(
+      model.bufferViews.begin(),
+      model.bufferViews.end(),
+      [](const BufferView& bufferView) {
+        return bufferView
+            .hasExtension<ExtensionBufferViewExtMeshoptCompression>();
+      });
+  CHECK(anyCompressed);
+}
+
+TEST_CASE("Validates KHR_draco_mesh_compression data that is not decoded") {
+  // A primitive whose Draco data is eight zero bytes in the given buffer view.
+  auto createGltf = [](const std::string& bufferView) {
+    return R"({
+      "asset": {"version": "2.0"},
+      "buffers": [{
+        "uri": "data:application/octet-stream;base64,AAAAAAAAAAA=",
+        "byteLength": 8
+      }],
+      "bufferViews": [)" +
+           bufferView + R"(],
+      "accessors": [{
+        "componentType": 5126,
+        "count": 3,
+        "type": "VEC3",
+        "min": [0, 0, 0],
+        "max": [1, 1, 1]
+      }],
+      "meshes": [{
+        "primitives": [{
+          "attributes": {"POSITION": 0},
+          "extensions": {
+            "KHR_draco_mesh_compression": {
+              "bufferView": 0,
+              "attributes": {"POSITION": 0}
+            }
+          }
+        }]
+      }]
+    })";
+  };
+
+  auto readWithoutDecoding = [](const std::string& json) {
+    GltfReaderOptions options;
+    options.decodeDraco = false;
+
+    GltfReader reader;
+    return reader.readGltf(
+        std::span(reinterpret_cast<const std::byte*>(json.data()), json.size()),
+        options);
+  };
+
+  auto hasWarning = [](const GltfReaderResult& result,
+                       const std::string& warning) {
+    return std::find(
+               result.warnings.begin(),
+               result.warnings.end(),
+               warning) != result.warnings.end();
+  };
+
+  SECTION("the compressed data is left in place") {
+    GltfReaderResult result =
+        readWithoutDecoding(createGltf(R"({"buffer": 0, "byteLength": 8})"));
+    REQUIRE(result.model);
+    CHECK(result.errors.empty());
+
+    const MeshPrimitive& primitive = result.model->meshes[0].primitives[0];
+    CHECK(primitive.hasExtension<ExtensionKhrDracoMeshCompression>());
+    CHECK(result.model->accessors[0].bufferView == -1);
+  }
+
+  SECTION("reports an invalid Draco header") {
+    GltfReaderResult result =
+        readWithoutDecoding(createGltf(R"({"buffer": 0, "byteLength": 8})"));
+    REQUIRE(result.model);
+    CHECK(result.errors.empty());
+    CHECK(std::any_of(
+        result.warnings.begin(),
+        result.warnings.end(),
+        [](const std::string& warning) {
+          return warning.starts_with("Draco header is invalid");
+        }));
+  }
+
+  SECTION("reports a buffer view that extends beyond its buffer") {
+    GltfReaderResult result = readWithoutDecoding(
+        createGltf(R"({"buffer": 0, "byteOffset": 4, "byteLength": 8})"));
+    REQUIRE(result.model);
+    CHECK(hasWarning(result, "Draco bufferView extends beyond its buffer."));
+  }
+
+  SECTION("reports an invalid buffer view") {
+    GltfReaderResult result = readWithoutDecoding(createGltf(""));
+    REQUIRE(result.model);
+    CHECK(hasWarning(result, "Draco bufferView index is invalid."));
+  }
+}
+
 TEST_CASE("Read TriangleWithoutIndices") {
   std::filesystem::path gltfFile = CesiumGltfReader_TEST_DATA_DIR;
   gltfFile /=
@@ -755,6 +875,104 @@ TEST_CASE("GltfReader::loadGltf") {
     CHECK(image.uri.has_value());
     CHECK(!image.pAsset);
   }
+
+  SECTION("validates Draco data that is not decoded") {
+    GltfReaderOptions options;
+    options.decodeDraco = false;
+    GltfReader reader{};
+    Future<GltfReaderResult> future =
+        reader.loadGltf(asyncSystem, uri, {}, pMockAssetAccessor, options);
+    GltfReaderResult result = waitForFuture(asyncSystem, std::move(future));
+    REQUIRE(result.model);
+    CHECK(result.errors.empty());
+
+    // The data is valid, so there are no Draco warnings.
+    CHECK(std::none_of(
+        result.warnings.begin(),
+        result.warnings.end(),
+        [](const std::string& warning) {
+          return warning.find("Draco") != std::string::npos;
+        }));
+
+    bool anyCompressed = false;
+    for (const Mesh& mesh : result.model->meshes) {
+      for (const MeshPrimitive& primitive : mesh.primitives) {
+        anyCompressed = anyCompressed ||
+                        primitive
+                            .hasExtension<ExtensionKhrDracoMeshCompression>();
+      }
+    }
+    CHECK(anyCompressed);
+  }
+
+  SECTION("decodes embedded images while resolving external buffers") {
+    std::vector<std::byte> png =
+        readFile(dataDir / "DracoCompressed" / "CesiumMilkTruck.png");
+    const size_t externalBufferSize =
+        readFile(dataDir / "DracoCompressed" / "0.bin").size();
+
+    std::string json =
+        R"({"asset":{"version":"2.0"},"buffers":[{"byteLength":)" +
+        std::to_string(png.size()) +
+        R"(},{"uri":"0.bin","byteLength":)" +
+        std::to_string(externalBufferSize) +
+        R"(}],"bufferViews":[{"buffer":0,"byteLength":)" +
+        std::to_string(png.size()) +
+        R"(}],"images":[{"bufferView":0,"mimeType":"image/png"}]})";
+    json.resize((json.size() + 3) / 4 * 4, ' ');
+
+    std::vector<std::byte> bin = png;
+    bin.resize((bin.size() + 3) / 4 * 4, std::byte(0));
+
+    std::vector<std::byte> glb;
+    const auto append = [&glb](uint32_t value) {
+      const std::byte* pValue = reinterpret_cast<const std::byte*>(&value);
+      glb.insert(glb.end(), pValue, pValue + sizeof(value));
+    };
+    append(0x46546C67);
+    append(2);
+    append(uint32_t(12 + 8 + json.size() + 8 + bin.size()));
+    append(uint32_t(json.size()));
+    append(0x4E4F534A);
+    const std::byte* pJson = reinterpret_cast<const std::byte*>(json.data());
+    glb.insert(glb.end(), pJson, pJson + json.size());
+    append(uint32_t(bin.size()));
+    append(0x004E4942);
+    glb.insert(glb.end(), bin.begin(), bin.end());
+
+    std::string glbUrl =
+        "file:///" + StringHelpers::toStringUtf8(
+                         (dataDir / "DracoCompressed" / "Embedded.glb")
+                             .generic_u8string());
+    pMockAssetAccessor->mockCompletedRequests[glbUrl] =
+        std::make_shared<SimpleAssetRequest>(
+            "GET",
+            glbUrl,
+            CesiumAsync::HttpHeaders{},
+            std::make_unique<SimpleAssetResponse>(
+                uint16_t(200),
+                "application/binary",
+                CesiumAsync::HttpHeaders{},
+                std::move(glb)));
+
+    GltfReader reader{};
+    Future<GltfReaderResult> future =
+        reader.loadGltf(asyncSystem, glbUrl, {}, pMockAssetAccessor);
+    GltfReaderResult result = waitForFuture(asyncSystem, std::move(future));
+    REQUIRE(result.model);
+    CHECK(result.errors.empty());
+    CHECK(result.warnings.empty());
+
+    REQUIRE(result.model->buffers.size() == 2);
+    CHECK(!result.model->buffers[1].uri);
+    CHECK(result.model->buffers[1].cesium.data.size() == externalBufferSize);
+
+    REQUIRE(result.model->images.size() == 1);
+    const CesiumGltf::Image& image = result.model->images[0];
+    REQUIRE(image.pAsset);
+    CHECK(image.pAsset->width == 2048);
+    CHECK(image.pAsset->height == 2048);
+  }
 }
 
 TEST_CASE("GltfReader::postprocessGltf") {
@@ -793,3 +1011,93 @@ TEST_CASE("GltfReader::postprocessGltf") {
     CHECK(s == "test");
   }
 }
+
+TEST_CASE("Dequantizes KHR_mesh_quantization attributes") {
+  GltfReaderResult readerResult;
+  Model& model = readerResult.model.emplace();
+  model.addExtensionUsed("KHR_mesh_quantization");
+  model.addExtensionRequired("KHR_mesh_quantization");
+
+  // Two normalized SHORT positions, tightly packed, followed by two
+  // normalized UNSIGNED_BYTE texture coordinates with a padded stride.
+  const std::vector<int16_t> positions{32767, -32767, 0, 0, 16384, -32768};
+  const std::vector<uint8_t> texCoords{255, 0, 0, 0, 51, 102, 0, 0};
+
+  Buffer& buffer = model.buffers.emplace_back();
+  buffer.cesium.data.resize(
+      positions.size() * sizeof(int16_t) + texCoords.size());
+  std::memcpy(
+      buffer.cesium.data.data(),
+      positions.data(),
+      positions.size() * sizeof(int16_t));
+  std::memcpy(
+      buffer.cesium.data.data() + positions.size() * sizeof(int16_t),
+      texCoords.data(),
+      texCoords.size());
+  buffer.byteLength = static_cast<int64_t>(buffer.cesium.data.size());
+
+  BufferView& positionBufferView = model.bufferViews.emplace_back();
+  positionBufferView.buffer = 0;
+  positionBufferView.byteOffset = 0;
+  positionBufferView.byteLength =
+      static_cast<int64_t>(positions.size() * sizeof(int16_t));
+
+  BufferView& texCoordBufferView = model.bufferViews.emplace_back();
+  texCoordBufferView.buffer = 0;
+  texCoordBufferView.byteOffset =
+      static_cast<int64_t>(positions.size() * sizeof(int16_t));
+  texCoordBufferView.byteLength = static_cast<int64_t>(texCoords.size());
+  texCoordBufferView.byteStride = 4;
+
+  Accessor& positionAccessor = model.accessors.emplace_back();
+  positionAccessor.bufferView = 0;
+  positionAccessor.count = 2;
+  positionAccessor.type = Accessor::Type::VEC3;
+  positionAccessor.componentType = Accessor::ComponentType::SHORT;
+  positionAccessor.normalized = true;
+
+  Accessor& texCoordAccessor = model.accessors.emplace_back();
+  texCoordAccessor.bufferView = 1;
+  texCoordAccessor.count = 2;
+  texCoordAccessor.type = Accessor::Type::VEC2;
+  texCoordAccessor.componentType = Accessor::ComponentType::UNSIGNED_BYTE;
+  texCoordAccessor.normalized = true;
+
+  MeshPrimitive& primitive =
+      model.meshes.emplace_back().primitives.emplace_back();
+  primitive.attributes["POSITION"] = 0;
+  primitive.attributes["TEXCOORD_0"] = 1;
+
+  GltfReader reader;
+  reader.postprocessGltf(readerResult, GltfReaderOptions());
+
+  CHECK(!model.isExtensionRequired("KHR_mesh_quantization"));
+
+  // Both attributes are written to a single new buffer.
+  REQUIRE(model.buffers.size() == 2);
+  REQUIRE(model.bufferViews.size() == 4);
+  CHECK(model.bufferViews[2].buffer == 1);
+  CHECK(model.bufferViews[3].buffer == 1);
+  CHECK(
+      model.buffers[1].byteLength ==
+      static_cast<int64_t>((2 * 3 + 2 * 2) * sizeof(float)));
+
+  for (const Accessor& accessor : model.accessors) {
+    CHECK(accessor.componentType == Accessor::ComponentType::FLOAT);
+    CHECK(!accessor.normalized);
+  }
+
+  AccessorView<glm::vec3> positionView(model, 0);
+  REQUIRE(positionView.status() == AccessorViewStatus::Valid);
+  REQUIRE(positionView.size() == 2);
+  CHECK(positionView[0] == glm::vec3(1.0f, -1.0f, 0.0f));
+  CHECK(Math::equalsEpsilon(positionView[1].y, 16384.0 / 32767.0, 1e-6));
+  CHECK(positionView[1].z == -1.0f);
+
+  AccessorView<glm::vec2> texCoordView(model, 1);
+  REQUIRE(texCoordView.status() == AccessorViewStatus::Valid);
+  REQUIRE(texCoordView.size() == 2);
+  CHECK(texCoordView[0] == glm::vec2(1.0f, 0.0f));
+  CHECK(Math::equalsEpsilon(texCoordView[1].x, 0.2, 1e-6));
+  CHECK(Math::equalsEpsilon(texCoordView[1].y, 0.4, 1e-6));
+}
@@ -70,4 +70,57 @@ TEST_CASE("CesiumGltfReader::ImageDecoder") {
       }
     }
   }
+
+  SECTION("Compresses images into a GPU pixel format") {
+    ImageAsset image;
+    image.width = 64;
+    image.height = 32;
+    image.channels = 4;
+    image.bytesPerChannel = 1;
+    image.pixelData.resize(64 * 32 * 4);
+    for (size_t i = 0; i < image.pixelData.size(); ++i) {
+      image.pixelData[i] = std::byte(i % 251);
+    }
+    const size_t uncompressedSize = image.pixelData.size();
+
+    SECTION("BC7") {
+      std::optional<std::string> error = ImageDecoder::compressImage(
+          image,
+          GpuCompressedPixelFormat::BC7_RGBA);
+      REQUIRE(!error);
+      CHECK(image.compressedPixelFormat == GpuCompressedPixelFormat::BC7_RGBA);
+
+      // A complete mip chain is generated before compression.
+      REQUIRE(image.mipPositions.size() == 7);
+
+      // BC7 uses 16 bytes per 4x4 block, a quarter of the uncompressed size.
+      CHECK(image.mipPositions[0].byteOffset == 0);
+      CHECK(image.mipPositions[0].byteSize == uncompressedSize / 4);
+      for (const ImageAssetMipPosition& mip : image.mipPositions) {
+        CHECK(mip.byteSize > 0);
+        CHECK(mip.byteOffset + mip.byteSize <= image.pixelData.size());
+      }
+    }
+
+    SECTION("ETC2") {
+      std::optional<std::string> error = ImageDecoder::compressImage(
+          image,
+          GpuCompressedPixelFormat::ETC2_RGBA);
+      REQUIRE(!error);
+      CHECK(image.compressedPixelFormat == GpuCompressedPixelFormat::ETC2_RGBA);
+      REQUIRE(!image.mipPositions.empty());
+      CHECK(image.mipPositions[0].byteSize == uncompressedSize / 4);
+    }
+
+    SECTION("rejects images it cannot compress") {
+      CHECK(ImageDecoder::compressImage(image, GpuCompressedPixelFormat::NONE));
+
+      image.channels = 3;
+      CHECK(ImageDecoder::compressImage(
+          image,
+          GpuCompressedPixelFormat::BC7_RGBA));
+      CHECK(image.compressedPixelFormat == GpuCompressedPixelFormat::NONE);
+      CHECK(image.pixelData.size() == uncompressedSize);
+    }
+  }
 }
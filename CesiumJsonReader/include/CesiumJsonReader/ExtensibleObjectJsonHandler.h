@@ -42,7 +42,7 @@ protected:
    * currently reading into.
    */
   IJsonHandler* readObjectKeyExtensibleObject(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumUtility::ExtensibleObject& o);
 
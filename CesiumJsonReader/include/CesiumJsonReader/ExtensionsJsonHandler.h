@@ -34,7 +34,7 @@ public:
   void reset(
       IJsonHandler* pParent,
       CesiumUtility::ExtensibleObject* pObject,
-      const std::string& objectType);
+      const std::string_view& objectType);
 
   /** @copydoc IJsonHandler::readObjectKey */
   virtual IJsonHandler* readObjectKey(const std::string_view& str) override;
@@ -33,7 +33,7 @@ protected:
   void reset(IJsonHandler* pParent, CesiumUtility::ExtensibleObject* pObject);
   /** @copydoc ExtensibleObjectJsonHandler::readObjectKeyExtensibleObject */
   IJsonHandler* readObjectKeySharedAsset(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumUtility::ExtensibleObject& o);
 
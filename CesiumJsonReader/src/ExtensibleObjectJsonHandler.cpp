@@ -20,15 +20,15 @@ void ExtensibleObjectJsonHandler::reset(
 }
 
 IJsonHandler* ExtensibleObjectJsonHandler::readObjectKeyExtensibleObject(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumUtility::ExtensibleObject& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("extras"s == str)
+  if ("extras"sv == str)
     return property("extras", this->_extras, o.extras);
 
-  if ("extensions"s == str) {
+  if ("extensions"sv == str) {
     this->_extensions.reset(this, &o, objectType);
     return &this->_extensions;
   }
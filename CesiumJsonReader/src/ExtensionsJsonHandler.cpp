@@ -6,7 +6,7 @@ namespace CesiumJsonReader {
 void ExtensionsJsonHandler::reset(
     IJsonHandler* pParent,
     CesiumUtility::ExtensibleObject* pObject,
-    const std::string& objectType) {
+    const std::string_view& objectType) {
   ObjectJsonHandler::reset(pParent);
   this->_pObject = pObject;
 
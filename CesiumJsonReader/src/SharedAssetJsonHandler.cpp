@@ -18,7 +18,7 @@ void SharedAssetJsonHandler::reset(
 
 CesiumJsonReader::IJsonHandler*
 SharedAssetJsonHandler::readObjectKeySharedAsset(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumUtility::ExtensibleObject& o) {
   return this->readObjectKeyExtensibleObject(objectType, str, o);
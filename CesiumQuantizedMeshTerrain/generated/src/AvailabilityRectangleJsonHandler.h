@@ -26,7 +26,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyAvailabilityRectangle(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumQuantizedMeshTerrain::AvailabilityRectangle& o);
 
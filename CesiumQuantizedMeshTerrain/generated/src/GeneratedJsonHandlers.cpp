@@ -59,60 +59,60 @@ LayerJsonHandler::readObjectKey(const std::string_view& str) {
 }
 
 CesiumJsonReader::IJsonHandler* LayerJsonHandler::readObjectKeyLayer(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumQuantizedMeshTerrain::Layer& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("attribution"s == str) {
+  if ("attribution"sv == str) {
     return property("attribution", this->_attribution, o.attribution);
   }
-  if ("available"s == str) {
+  if ("available"sv == str) {
     return property("available", this->_available, o.available);
   }
-  if ("bounds"s == str) {
+  if ("bounds"sv == str) {
     return property("bounds", this->_bounds, o.bounds);
   }
-  if ("description"s == str) {
+  if ("description"sv == str) {
     return property("description", this->_description, o.description);
   }
-  if ("extensions"s == str) {
+  if ("extensions"sv == str) {
     return property(
         "extensions",
         this->_extensionsProperty,
         o.extensionsProperty);
   }
-  if ("format"s == str) {
+  if ("format"sv == str) {
     return property("format", this->_format, o.format);
   }
-  if ("maxzoom"s == str) {
+  if ("maxzoom"sv == str) {
     return property("maxzoom", this->_maxzoom, o.maxzoom);
   }
-  if ("minzoom"s == str) {
+  if ("minzoom"sv == str) {
     return property("minzoom", this->_minzoom, o.minzoom);
   }
-  if ("metadataAvailability"s == str) {
+  if ("metadataAvailability"sv == str) {
     return property(
         "metadataAvailability",
         this->_metadataAvailability,
         o.metadataAvailability);
   }
-  if ("name"s == str) {
+  if ("name"sv == str) {
     return property("name", this->_name, o.name);
   }
-  if ("parentUrl"s == str) {
+  if ("parentUrl"sv == str) {
     return property("parentUrl", this->_parentUrl, o.parentUrl);
   }
-  if ("projection"s == str) {
+  if ("projection"sv == str) {
     return property("projection", this->_projection, o.projection);
   }
-  if ("scheme"s == str) {
+  if ("scheme"sv == str) {
     return property("scheme", this->_scheme, o.scheme);
   }
-  if ("tiles"s == str) {
+  if ("tiles"sv == str) {
     return property("tiles", this->_tiles, o.tiles);
   }
-  if ("version"s == str) {
+  if ("version"sv == str) {
     return property("version", this->_version, o.version);
   }
 
@@ -201,21 +201,21 @@ AvailabilityRectangleJsonHandler::readObjectKey(const std::string_view& str) {
 
 CesiumJsonReader::IJsonHandler*
 AvailabilityRectangleJsonHandler::readObjectKeyAvailabilityRectangle(
-    const std::string& objectType,
+    const std::string_view& objectType,
     const std::string_view& str,
     CesiumQuantizedMeshTerrain::AvailabilityRectangle& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("startX"s == str) {
+  if ("startX"sv == str) {
     return property("startX", this->_startX, o.startX);
   }
-  if ("startY"s == str) {
+  if ("startY"sv == str) {
     return property("startY", this->_startY, o.startY);
   }
-  if ("endX"s == str) {
+  if ("endX"sv == str) {
     return property("endX", this->_endX, o.endX);
   }
-  if ("endY"s == str) {
+  if ("endY"sv == str) {
     return property("endY", this->_endY, o.endY);
   }
 
@@ -30,7 +30,7 @@ public:
 
 protected:
   IJsonHandler* readObjectKeyLayer(
-      const std::string& objectType,
+      const std::string_view& objectType,
       const std::string_view& str,
       CesiumQuantizedMeshTerrain::Layer& o);
 
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Library.h"
+#include "QuantizedMeshLoader.h"
+
+#include <CesiumGeometry/QuadtreeTileID.h>
+#include <CesiumGeospatial/BoundingRegion.h>
+#include <CesiumGeospatial/Ellipsoid.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+namespace CesiumQuantizedMeshTerrain {
+
+/**
+ * @brief Loads `heightmap-1.0` terrain data, creating a mesh from the regular
+ * grid of heights in each tile.
+ *
+ * A `heightmap-1.0` tile is a grid of 65x65 little-endian 16-bit heights,
+ * row by row from the northwest corner of the tile, followed by one byte
+ * saying which of the tile's four children exist. Each height is the stored
+ * value divided by 5, minus 1000 meters. A water mask that follows is ignored.
+ *
+ * Rather than turning every height into a vertex, the grid is triangulated as
+ * a right-triangulated irregular network: a triangle is only split in two
+ * where the heights it leaves out are further than a given error from it. So
+ * flat areas take a few large triangles and rough areas take many small ones.
+ */
+class CESIUMQUANTIZEDMESHTERRAIN_API HeightmapLoader final {
+public:
+  /**
+   * @brief The number of heights along each side of a tile.
+   */
+  static constexpr uint32_t Width = 65;
+
+  /**
+   * @brief Create a {@link QuantizedMeshLoadResult} from the given data.
+   *
+   * The mesh has skirts and normals, in the same layout as the meshes created
+   * by {@link QuantizedMeshLoader::load}. The children that the tile says
+   * exist are returned as
+   * {@link QuantizedMeshLoadResult::availableTileRectangles}.
+   *
+   * @param tileID The tile ID.
+   * @param tileBoundingVolume The tile bounding volume.
+   * @param url The URL from which the data was loaded.
+   * @param data The actual tile data.
+   * @param maximumError The largest distance, in meters, between any height
+   * and the simplified mesh. With zero, every height is a vertex.
+   * @param ellipsoid The ellipsoid to use for this heightmap.
+   * @return The {@link QuantizedMeshLoadResult}
+   */
+  static QuantizedMeshLoadResult load(
+      const CesiumGeometry::QuadtreeTileID& tileID,
+      const CesiumGeospatial::BoundingRegion& tileBoundingVolume,
+      const std::string& url,
+      const std::span<const std::byte>& data,
+      double maximumError,
+      const CesiumGeospatial::Ellipsoid& ellipsoid CESIUM_DEFAULT_ELLIPSOID);
+};
+
+} // namespace CesiumQuantizedMeshTerrain
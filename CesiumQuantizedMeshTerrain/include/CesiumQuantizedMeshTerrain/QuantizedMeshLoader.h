@@ -5,7 +5,9 @@
 #include <CesiumGeometry/QuadtreeTileID.h>
 #include <CesiumGeometry/QuadtreeTileRectangularRange.h>
 #include <CesiumGeospatial/BoundingRegion.h>
+#include <CesiumGeospatial/Cartographic.h>
 #include <CesiumGeospatial/Ellipsoid.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
 #include <CesiumGltf/Model.h>
 #include <CesiumUtility/ErrorList.h>
 
@@ -15,6 +17,7 @@
 #include <memory>
 #include <optional>
 #include <span>
+#include <string_view>
 #include <vector>
 
 namespace CesiumAsync {
@@ -83,11 +86,46 @@ struct QuantizedMeshMetadataResult {
   CesiumUtility::ErrorList errors;
 };
 
+/**
+ * @brief The heights sampled from a Quantized Mesh tile, returned by \ref
+ * QuantizedMeshLoader::sampleHeights.
+ */
+struct QuantizedMeshSampleHeightsResult {
+  /**
+   * @brief The sampled height of each position, in meters above the
+   * ellipsoid.
+   *
+   * The height at an index is only meaningful if the entry in
+   * {@link QuantizedMeshSampleHeightsResult::sampleSuccess} at the same index
+   * is true.
+   */
+  std::vector<double> heights;
+
+  /**
+   * @brief Whether the height of each position was sampled successfully. A
+   * sample fails if its position is outside the tile or not on any of the
+   * tile's triangles.
+   */
+  std::vector<bool> sampleSuccess;
+
+  /**
+   * @brief The errors and warnings reported while sampling heights, if any.
+   */
+  CesiumUtility::ErrorList errors;
+};
+
 /**
  * @brief Loads `quantized-mesh-1.0` terrain data.
  */
 class CESIUMQUANTIZEDMESHTERRAIN_API QuantizedMeshLoader final {
 public:
+  /**
+   * @brief The name of the vertex attribute that {@link load} adds when
+   * `generateParentHeightOffsets` is true.
+   */
+  static constexpr std::string_view PARENT_HEIGHT_OFFSET_ATTRIBUTE_NAME =
+      "_PARENT_HEIGHT_OFFSET";
+
   /**
    * @brief Create a {@link QuantizedMeshLoadResult} from the given data.
    *
@@ -98,6 +136,14 @@ public:
    * @param enableWaterMask If true, will attempt to load a water mask from the
    * quantized mesh data.
    * @param ellipsoid The ellipsoid to use for this quantized mesh.
+   * @param generateParentHeightOffsets If true, adds a `_PARENT_HEIGHT_OFFSET`
+   * attribute to the mesh, so that renderers can morph between this tile and
+   * its parent rather than popping. For each vertex, it is the distance in
+   * meters, along the ellipsoid normal, from the vertex to an approximation of
+   * the parent tile's surface. The parent's mesh is not available, so it is
+   * approximated by sampling this tile's mesh on a grid with half as many
+   * vertices in each direction, as the parent would have over this tile, and
+   * interpolating bilinearly between the samples.
    * @return The {@link QuantizedMeshLoadResult}
    */
   static QuantizedMeshLoadResult load(
@@ -106,7 +152,21 @@ public:
       const std::string& url,
       const std::span<const std::byte>& data,
       bool enableWaterMask,
-      const CesiumGeospatial::Ellipsoid& ellipsoid CESIUM_DEFAULT_ELLIPSOID);
+      const CesiumGeospatial::Ellipsoid& ellipsoid CESIUM_DEFAULT_ELLIPSOID,
+      bool generateParentHeightOffsets = false);
+
+  /**
+   * @brief Sets the parent height offsets of a terrain model that was upsampled
+   * from its parent tile to zero.
+   *
+   * Upsampling interpolates the parent's offsets, which point at the
+   * grandparent's surface. An upsampled tile has exactly its parent's surface,
+   * so it has no offset from it.
+   *
+   * @param model The upsampled model. Primitives without the
+   * {@link PARENT_HEIGHT_OFFSET_ATTRIBUTE_NAME} attribute are left unchanged.
+   */
+  static void clearParentHeightOffsets(CesiumGltf::Model& model);
 
   /**
    * @brief Parses the metadata (tile availability) from the given
@@ -120,6 +180,26 @@ public:
       const std::span<const std::byte>& data,
       const CesiumGeometry::QuadtreeTileID& tileID);
 
+  /**
+   * @brief Samples heights directly from the given quantized-mesh terrain tile
+   * data.
+   *
+   * Each height is interpolated linearly within the triangle of the tile's
+   * mesh that contains the position. This is much faster than creating a glTF
+   * with {@link load} and intersecting rays with it, because neither the
+   * vertex positions nor the skirts and normals are computed.
+   *
+   * @param tileRectangle The rectangle covered by the tile.
+   * @param data The actual tile data.
+   * @param positions The positions at which to sample heights. Their heights
+   * are ignored.
+   * @return The sampled heights.
+   */
+  static QuantizedMeshSampleHeightsResult sampleHeights(
+      const CesiumGeospatial::GlobeRectangle& tileRectangle,
+      const std::span<const std::byte>& data,
+      const std::span<const CesiumGeospatial::Cartographic>& positions);
+
   /**
    * @brief Extracts tile availability information from a parsed layer.json
    * or tile metadata extension.
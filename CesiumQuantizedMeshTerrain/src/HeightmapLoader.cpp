@@ -0,0 +1,534 @@
+#include <CesiumGeometry/QuadtreeTileRectangularRange.h>
+#include <CesiumGeospatial/Cartographic.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumGeospatial/calcQuadtreeMaxGeometricError.h>
+#include <CesiumGltf/Accessor.h>
+#include <CesiumGltf/Buffer.h>
+#include <CesiumGltf/BufferView.h>
+#include <CesiumGltf/Material.h>
+#include <CesiumGltf/MeshPrimitive.h>
+#include <CesiumGltf/Model.h>
+#include <CesiumGltf/Node.h>
+#include <CesiumGltf/Scene.h>
+#include <CesiumGltfContent/SkirtMeshMetadata.h>
+#include <CesiumQuantizedMeshTerrain/HeightmapLoader.h>
+#include <CesiumUtility/Math.h>
+#include <CesiumUtility/Tracing.h>
+
+#include <glm/common.hpp>
+#include <glm/geometric.hpp>
+#include <glm/vec3.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+using namespace CesiumGeometry;
+using namespace CesiumGeospatial;
+using namespace CesiumGltfContent;
+using namespace CesiumQuantizedMeshTerrain;
+using namespace CesiumUtility;
+
+namespace {
+
+constexpr uint32_t gridSize = HeightmapLoader::Width;
+constexpr uint32_t gridMax = gridSize - 1;
+constexpr size_t heightsByteLength =
+    size_t(gridSize) * gridSize * sizeof(uint16_t);
+constexpr uint16_t NoVertex = std::numeric_limits<uint16_t>::max();
+
+// The first two corners of a triangle in the grid. The right angle is at the
+// third corner, which is derived from these two.
+struct GridTriangle {
+  uint8_t ax;
+  uint8_t ay;
+  uint8_t bx;
+  uint8_t by;
+};
+
+// Every triangle that can be created by splitting the two triangles of the
+// grid, and then their halves, down to triangles between neighboring heights.
+// A triangle's halves always come after it.
+const std::vector<GridTriangle>& getGridTriangles() {
+  static const std::vector<GridTriangle> triangles = []() {
+    const uint32_t count = gridMax * gridMax * 2 - 2;
+    std::vector<GridTriangle> result(count);
+    for (uint32_t i = 0; i < count; ++i) {
+      // The bits of the ID, after the leading one, choose the first triangle
+      // of the grid and then the half to take at each split.
+      uint32_t id = i + 2;
+      uint32_t ax = 0, ay = 0, bx = 0, by = 0, cx = 0, cy = 0;
+      if (id & 1) {
+        bx = by = cx = gridMax;
+      } else {
+        ax = ay = cy = gridMax;
+      }
+
+      while ((id >>= 1) > 1) {
+        const uint32_t mx = (ax + bx) >> 1;
+        const uint32_t my = (ay + by) >> 1;
+        if (id & 1) {
+          bx = ax;
+          by = ay;
+          ax = cx;
+          ay = cy;
+        } else {
+          ax = bx;
+          ay = by;
+          bx = cx;
+          by = cy;
+        }
+        cx = mx;
+        cy = my;
+      }
+
+      result[i] = GridTriangle{
+          uint8_t(ax),
+          uint8_t(ay),
+          uint8_t(bx),
+          uint8_t(by)};
+    }
+    return result;
+  }();
+  return triangles;
+}
+
+// The largest distance between a height inside a triangle, or on its edges,
+// and the plane through the heights at its corners.
+float computeTriangleError(
+    const std::vector<float>& heights,
+    int64_t ax,
+    int64_t ay,
+    int64_t bx,
+    int64_t by,
+    int64_t cx,
+    int64_t cy) {
+  const int64_t area = (bx - ax) * (cy - ay) - (cx - ax) * (by - ay);
+  const float ha = heights[size_t(ay * gridSize + ax)];
+  const float hb = heights[size_t(by * gridSize + bx)];
+  const float hc = heights[size_t(cy * gridSize + cx)];
+
+  float error = 0.0f;
+  for (int64_t y = std::min({ay, by, cy}); y <= std::max({ay, by, cy}); ++y) {
+    for (int64_t x = std::min({ax, bx, cx}); x <= std::max({ax, bx, cx});
+         ++x) {
+      // The barycentric weights of the corners, scaled by the area.
+      const int64_t wa = (bx - x) * (cy - y) - (cx - x) * (by - y);
+      const int64_t wb = (cx - x) * (ay - y) - (ax - x) * (cy - y);
+      const int64_t wc = area - wa - wb;
+      if (wa * area < 0 || wb * area < 0 || wc * area < 0) {
+        continue;
+      }
+
+      // Relative to the first corner, so that a flat triangle has no error
+      // at all.
+      const float interpolated =
+          (float(wb) * (hb - ha) + float(wc) * (hc - ha)) / float(area);
+      error = std::max(
+          error,
+          std::abs(interpolated - (heights[size_t(y * gridSize + x)] - ha)));
+    }
+  }
+
+  return error;
+}
+
+// Computes, for the height at the middle of each triangle's longest edge, the
+// largest error of not splitting the triangle there, or of not splitting any
+// of its halves. The two triangles that share a longest edge share the error,
+// so they are always split together and the mesh has no cracks.
+std::vector<float> computeErrors(const std::vector<float>& heights) {
+  const std::vector<GridTriangle>& triangles = getGridTriangles();
+  const size_t parentCount = triangles.size() - size_t(gridMax) * gridMax;
+
+  std::vector<float> errors(heights.size(), 0.0f);
+  for (size_t i = triangles.size(); i-- > 0;) {
+    const GridTriangle& triangle = triangles[i];
+    const uint32_t ax = triangle.ax;
+    const uint32_t ay = triangle.ay;
+    const uint32_t bx = triangle.bx;
+    const uint32_t by = triangle.by;
+    const uint32_t mx = (ax + bx) >> 1;
+    const uint32_t my = (ay + by) >> 1;
+    const uint32_t cx = mx + my - ay;
+    const uint32_t cy = my + ax - mx;
+
+    const size_t middle = size_t(my) * gridSize + mx;
+    float error = std::max(
+        errors[middle],
+        computeTriangleError(heights, ax, ay, bx, by, cx, cy));
+
+    if (i < parentCount) {
+      const size_t left =
+          size_t((ay + cy) >> 1) * gridSize + ((ax + cx) >> 1);
+      const size_t right =
+          size_t((by + cy) >> 1) * gridSize + ((bx + cx) >> 1);
+      error = std::max({error, errors[left], errors[right]});
+    }
+
+    errors[middle] = error;
+  }
+
+  return errors;
+}
+
+class MeshBuilder {
+public:
+  MeshBuilder(const std::vector<float>& errors, float maximumError)
+      : _errors(errors),
+        _maximumError(maximumError),
+        _vertexIndices(errors.size(), NoVertex) {}
+
+  void build() {
+    this->addTriangle(0, 0, gridMax, gridMax, gridMax, 0);
+    this->addTriangle(gridMax, gridMax, 0, 0, 0, gridMax);
+  }
+
+  // The grid index of each vertex.
+  std::vector<uint32_t> vertices;
+  std::vector<uint16_t> indices;
+
+  uint16_t getVertex(uint32_t x, uint32_t y) const {
+    return this->_vertexIndices[size_t(y) * gridSize + x];
+  }
+
+private:
+  void addTriangle(
+      uint32_t ax,
+      uint32_t ay,
+      uint32_t bx,
+      uint32_t by,
+      uint32_t cx,
+      uint32_t cy) {
+    const uint32_t mx = (ax + bx) >> 1;
+    const uint32_t my = (ay + by) >> 1;
+    const uint32_t legLength = ax > cx ? ax - cx : cx - ax;
+    const uint32_t legHeight = ay > cy ? ay - cy : cy - ay;
+    if (legLength + legHeight > 1 &&
+        this->_errors[size_t(my) * gridSize + mx] > this->_maximumError) {
+      this->addTriangle(cx, cy, ax, ay, mx, my);
+      this->addTriangle(bx, by, cx, cy, mx, my);
+      return;
+    }
+
+    const uint16_t a = this->addVertex(ax, ay);
+    const uint16_t b = this->addVertex(bx, by);
+    const uint16_t c = this->addVertex(cx, cy);
+
+    // Rows go from north to south, so a triangle is counter-clockwise seen
+    // from above when it is clockwise in the grid.
+    const int64_t cross = (int64_t(bx) - int64_t(ax)) * (int64_t(cy) - ay) -
+                          (int64_t(by) - int64_t(ay)) * (int64_t(cx) - ax);
+    if (cross < 0) {
+      this->indices.insert(this->indices.end(), {a, b, c});
+    } else {
+      this->indices.insert(this->indices.end(), {a, c, b});
+    }
+  }
+
+  uint16_t addVertex(uint32_t x, uint32_t y) {
+    const size_t gridIndex = size_t(y) * gridSize + x;
+    uint16_t& vertex = this->_vertexIndices[gridIndex];
+    if (vertex == NoVertex) {
+      vertex = uint16_t(this->vertices.size());
+      this->vertices.emplace_back(uint32_t(gridIndex));
+    }
+    return vertex;
+  }
+
+  const std::vector<float>& _errors;
+  float _maximumError;
+  std::vector<uint16_t> _vertexIndices;
+};
+
+template <class T>
+int32_t addBufferView(
+    CesiumGltf::Model& model,
+    std::vector<std::byte>& buffer,
+    const std::vector<T>& values,
+    int32_t target) {
+  const size_t byteOffset = buffer.size();
+  const size_t byteLength = values.size() * sizeof(T);
+  buffer.resize(byteOffset + byteLength);
+  std::memcpy(buffer.data() + byteOffset, values.data(), byteLength);
+
+  CesiumGltf::BufferView& bufferView = model.bufferViews.emplace_back();
+  bufferView.buffer = 0;
+  bufferView.byteOffset = int64_t(byteOffset);
+  bufferView.byteLength = int64_t(byteLength);
+  bufferView.target = target;
+  return int32_t(model.bufferViews.size() - 1);
+}
+
+} // namespace
+
+/*static*/ QuantizedMeshLoadResult HeightmapLoader::load(
+    const QuadtreeTileID& tileID,
+    const BoundingRegion& tileBoundingVolume,
+    const std::string& url,
+    const std::span<const std::byte>& data,
+    double maximumError,
+    const Ellipsoid& ellipsoid) {
+  CESIUM_TRACE("CesiumQuantizedMeshTerrain::HeightmapLoader::load");
+
+  QuantizedMeshLoadResult result;
+
+  if (data.size() < heightsByteLength + 1) {
+    result.errors.emplaceError("Unable to parse heightmap-1.0 tile.");
+    return result;
+  }
+
+  std::vector<float> heights(size_t(gridSize) * gridSize);
+  double minimumHeight = std::numeric_limits<double>::max();
+  double maximumHeight = std::numeric_limits<double>::lowest();
+  for (size_t i = 0; i < heights.size(); ++i) {
+    const uint16_t value = uint16_t(
+        uint16_t(data[i * 2]) | (uint16_t(data[i * 2 + 1]) << 8));
+    const double height = double(value) / 5.0 - 1000.0;
+    heights[i] = float(height);
+    minimumHeight = std::min(minimumHeight, height);
+    maximumHeight = std::max(maximumHeight, height);
+  }
+
+  // The tiles that the heightmap says exist are its own children.
+  const uint8_t childMask = uint8_t(data[heightsByteLength]);
+  for (uint32_t child = 0; child < 4; ++child) {
+    if ((childMask >> child) & 1) {
+      const uint32_t x = tileID.x * 2 + (child & 1);
+      const uint32_t y = tileID.y * 2 + (child >> 1);
+      result.availableTileRectangles.emplace_back(
+          QuadtreeTileRectangularRange{tileID.level + 1, x, y, x, y});
+    }
+  }
+
+  // Convert the whole grid at once. The heights that the simplified mesh
+  // leaves out are still used for its normals.
+  const GlobeRectangle& rectangle = tileBoundingVolume.getRectangle();
+  std::vector<Cartographic> cartographics;
+  cartographics.reserve(heights.size());
+  for (uint32_t y = 0; y < gridSize; ++y) {
+    const double latitude = Math::lerp(
+        rectangle.getNorth(),
+        rectangle.getSouth(),
+        double(y) / gridMax);
+    for (uint32_t x = 0; x < gridSize; ++x) {
+      const double longitude = Math::lerp(
+          rectangle.getWest(),
+          rectangle.getEast(),
+          double(x) / gridMax);
+      cartographics.emplace_back(
+          longitude,
+          latitude,
+          heights[size_t(y) * gridSize + x]);
+    }
+  }
+
+  std::vector<glm::dvec3> grid(cartographics.size());
+  ellipsoid.cartographicToCartesian(cartographics, grid);
+
+  const std::vector<float> errors = computeErrors(heights);
+  MeshBuilder mesh(errors, float(std::max(maximumError, 0.0)));
+  mesh.build();
+
+  // The edge vertices, in the same order as the skirts of quantized-mesh
+  // tiles: west going north, north going east, east going south, and south
+  // going west.
+  std::vector<uint16_t> edges[4];
+  for (uint32_t i = 0; i < gridSize; ++i) {
+    const uint32_t reverse = gridMax - i;
+    const uint16_t candidates[4] = {
+        mesh.getVertex(0, reverse),
+        mesh.getVertex(i, 0),
+        mesh.getVertex(gridMax, i),
+        mesh.getVertex(reverse, gridMax)};
+    for (size_t edge = 0; edge < 4; ++edge) {
+      if (candidates[edge] != NoVertex) {
+        edges[edge].emplace_back(candidates[edge]);
+      }
+    }
+  }
+
+  const uint32_t vertexCount = uint32_t(mesh.vertices.size());
+  const uint32_t indicesCount = uint32_t(mesh.indices.size());
+
+  const double skirtHeight =
+      calcQuadtreeMaxGeometricError(ellipsoid) * rectangle.computeWidth() * 5.0;
+  std::vector<Cartographic> skirtCartographics;
+  std::vector<uint16_t>& indices = mesh.indices;
+  uint16_t skirtVertex = uint16_t(vertexCount);
+  for (const std::vector<uint16_t>& edge : edges) {
+    for (size_t i = 0; i < edge.size(); ++i) {
+      Cartographic cartographic = cartographics[mesh.vertices[edge[i]]];
+      cartographic.height -= skirtHeight;
+      skirtCartographics.emplace_back(cartographic);
+
+      if (i + 1 < edge.size()) {
+        indices.insert(
+            indices.end(),
+            {edge[i],
+             edge[i + 1],
+             skirtVertex,
+             skirtVertex,
+             edge[i + 1],
+             uint16_t(skirtVertex + 1)});
+      }
+      ++skirtVertex;
+    }
+  }
+
+  std::vector<glm::dvec3> skirtCartesians(skirtCartographics.size());
+  ellipsoid.cartographicToCartesian(skirtCartographics, skirtCartesians);
+
+  const glm::dvec3 center =
+      BoundingRegion(rectangle, minimumHeight, maximumHeight, ellipsoid)
+          .getBoundingBox()
+          .getCenter();
+
+  std::vector<glm::vec3> positions;
+  std::vector<glm::vec3> normals;
+  positions.reserve(vertexCount + skirtCartesians.size());
+  normals.reserve(positions.capacity());
+  glm::dvec3 positionMinimums{std::numeric_limits<double>::max()};
+  glm::dvec3 positionMaximums{std::numeric_limits<double>::lowest()};
+
+  for (uint32_t gridIndex : mesh.vertices) {
+    const glm::dvec3 position = grid[gridIndex] - center;
+    positions.emplace_back(position);
+    positionMinimums = glm::min(positionMinimums, position);
+    positionMaximums = glm::max(positionMaximums, position);
+
+    // The normal is across the neighboring heights in the full grid.
+    const uint32_t x = gridIndex % gridSize;
+    const uint32_t y = gridIndex / gridSize;
+    const glm::dvec3 east =
+        grid[size_t(y) * gridSize + std::min(x + 1, gridMax)] -
+        grid[size_t(y) * gridSize + (x > 0 ? x - 1 : 0)];
+    const glm::dvec3 north =
+        grid[size_t(y > 0 ? y - 1 : 0) * gridSize + x] -
+        grid[size_t(std::min(y + 1, gridMax)) * gridSize + x];
+    normals.emplace_back(glm::normalize(glm::cross(east, north)));
+  }
+
+  for (const std::vector<uint16_t>& edge : edges) {
+    for (uint16_t vertex : edge) {
+      normals.emplace_back(normals[vertex]);
+    }
+  }
+
+  for (const glm::dvec3& cartesian : skirtCartesians) {
+    const glm::dvec3 position = cartesian - center;
+    positions.emplace_back(position);
+    positionMinimums = glm::min(positionMinimums, position);
+    positionMaximums = glm::max(positionMaximums, position);
+  }
+
+  // create gltf
+  CesiumGltf::Model& model = result.model.emplace();
+  model.asset.version = "2.0";
+
+  CesiumGltf::Material& material = model.materials.emplace_back();
+  CesiumGltf::MaterialPBRMetallicRoughness& pbr =
+      material.pbrMetallicRoughness.emplace();
+  pbr.metallicFactor = 0.0;
+  pbr.roughnessFactor = 1.0;
+
+  CesiumGltf::Buffer& buffer = model.buffers.emplace_back();
+  const int32_t positionBufferView = addBufferView(
+      model,
+      buffer.cesium.data,
+      positions,
+      CesiumGltf::BufferView::Target::ARRAY_BUFFER);
+  const int32_t normalBufferView = addBufferView(
+      model,
+      buffer.cesium.data,
+      normals,
+      CesiumGltf::BufferView::Target::ARRAY_BUFFER);
+  const int32_t indicesBufferView = addBufferView(
+      model,
+      buffer.cesium.data,
+      indices,
+      CesiumGltf::BufferView::Target::ELEMENT_ARRAY_BUFFER);
+  buffer.byteLength = int64_t(buffer.cesium.data.size());
+
+  CesiumGltf::Accessor& positionAccessor = model.accessors.emplace_back();
+  positionAccessor.bufferView = positionBufferView;
+  positionAccessor.componentType = CesiumGltf::Accessor::ComponentType::FLOAT;
+  positionAccessor.count = int64_t(positions.size());
+  positionAccessor.type = CesiumGltf::Accessor::Type::VEC3;
+  positionAccessor.min = {
+      positionMinimums.x,
+      positionMinimums.y,
+      positionMinimums.z};
+  positionAccessor.max = {
+      positionMaximums.x,
+      positionMaximums.y,
+      positionMaximums.z};
+
+  CesiumGltf::Accessor& normalAccessor = model.accessors.emplace_back();
+  normalAccessor.bufferView = normalBufferView;
+  normalAccessor.componentType = CesiumGltf::Accessor::ComponentType::FLOAT;
+  normalAccessor.count = int64_t(normals.size());
+  normalAccessor.type = CesiumGltf::Accessor::Type::VEC3;
+
+  CesiumGltf::Accessor& indicesAccessor = model.accessors.emplace_back();
+  indicesAccessor.bufferView = indicesBufferView;
+  indicesAccessor.componentType =
+      CesiumGltf::Accessor::ComponentType::UNSIGNED_SHORT;
+  indicesAccessor.count = int64_t(indices.size());
+  indicesAccessor.type = CesiumGltf::Accessor::Type::SCALAR;
+
+  CesiumGltf::MeshPrimitive& primitive =
+      model.meshes.emplace_back().primitives.emplace_back();
+  primitive.mode = CesiumGltf::MeshPrimitive::Mode::TRIANGLES;
+  primitive.material = 0;
+  primitive.attributes.emplace("POSITION", 0);
+  primitive.attributes.emplace("NORMAL", 1);
+  primitive.indices = 2;
+
+  // add skirts info to primitive extra in case we need to upsample from it
+  SkirtMeshMetadata skirtMeshMetadata;
+  skirtMeshMetadata.noSkirtIndicesBegin = 0;
+  skirtMeshMetadata.noSkirtIndicesCount = indicesCount;
+  skirtMeshMetadata.noSkirtVerticesBegin = 0;
+  skirtMeshMetadata.noSkirtVerticesCount = vertexCount;
+  skirtMeshMetadata.meshCenter = center;
+  skirtMeshMetadata.skirtWestHeight = skirtHeight;
+  skirtMeshMetadata.skirtSouthHeight = skirtHeight;
+  skirtMeshMetadata.skirtEastHeight = skirtHeight;
+  skirtMeshMetadata.skirtNorthHeight = skirtHeight;
+  primitive.extras = SkirtMeshMetadata::createGltfExtras(skirtMeshMetadata);
+
+  // create node and update bounding volume
+  CesiumGltf::Node& node = model.nodes.emplace_back();
+  node.mesh = 0;
+  node.matrix = {
+      1.0,
+      0.0,
+      0.0,
+      0.0,
+      0.0,
+      0.0,
+      -1.0,
+      0.0,
+      0.0,
+      1.0,
+      0.0,
+      0.0,
+      center.x,
+      center.z,
+      -center.y,
+      1.0};
+
+  CesiumGltf::Scene& scene = model.scenes.emplace_back();
+  scene.nodes.emplace_back(0);
+  model.scene = 0;
+
+  model.extras["Cesium3DTiles_TileUrl"] = url;
+
+  result.updatedBoundingVolume =
+      BoundingRegion(rectangle, minimumHeight, maximumHeight, ellipsoid);
+
+  return result;
+}
@@ -2,8 +2,11 @@
 #include <CesiumGeometry/QuadtreeTileRectangularRange.h>
 #include <CesiumGeospatial/GlobeRectangle.h>
 #include <CesiumGeospatial/calcQuadtreeMaxGeometricError.h>
+#include <CesiumGltf/AccessorView.h>
+#include <CesiumGltf/AccessorWriter.h>
 #include <CesiumGltfContent/SkirtMeshMetadata.h>
 #include <CesiumQuantizedMeshTerrain/QuantizedMeshLoader.h>
+#include <CesiumUtility/Assert.h>
 #include <CesiumUtility/AttributeCompression.h>
 #include <CesiumUtility/JsonHelpers.h>
 #include <CesiumUtility/Log.h>
@@ -16,8 +19,11 @@
 #include <glm/vec3.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
+#include <numeric>
 #include <stdexcept>
+#include <string>
 
 using namespace CesiumGeometry;
 using namespace CesiumGeospatial;
@@ -115,6 +121,23 @@ int32_t zigZagDecode(int32_t value) noexcept {
   return (value >> 1) ^ (-(value & 1));
 }
 
+// Decodes one zig-zag, delta-encoded vertex attribute. The zig-zag decoding of
+// each value is independent of the others and is done in its own pass, which
+// the compiler can vectorize, so that only the running sum carries a
+// dependency from one vertex to the next.
+void decodeZigZagDeltas(
+    const std::span<const uint16_t>& encoded,
+    const std::span<int32_t>& decoded) noexcept {
+  CESIUM_ASSERT(decoded.size() >= encoded.size());
+  for (size_t i = 0; i < encoded.size(); ++i) {
+    decoded[i] = zigZagDecode(encoded[i]);
+  }
+  std::partial_sum(
+      decoded.begin(),
+      decoded.begin() + static_cast<std::ptrdiff_t>(encoded.size()),
+      decoded.begin());
+}
+
 template <class E, class D>
 void decodeIndices(
     const std::span<const E>& encoded,
@@ -375,6 +398,7 @@ static void addSkirt(
     const std::span<const E>& edgeIndices,
     const std::span<float>& positions,
     const std::span<float>& normals,
+    const std::span<float>& parentHeightOffsets,
     const std::span<I>& indices,
     glm::dvec3& positionMinimums,
     glm::dvec3& positionMaximums) {
@@ -383,12 +407,9 @@ static void addSkirt(
   const double east = rectangle.getEast();
   const double north = rectangle.getNorth();
 
-  size_t newEdgeIndex = currentVertexCount;
-  size_t positionIdx = currentVertexCount * 3;
-  size_t indexIdx = currentIndicesCount;
-  for (size_t i = 0; i < edgeIndices.size(); ++i) {
-    E edgeIdx = edgeIndices[i];
-
+  std::vector<Cartographic> cartographics;
+  cartographics.reserve(edgeIndices.size());
+  for (E edgeIdx : edgeIndices) {
     const double uRatio = uvsAndHeights[edgeIdx].x;
     const double vRatio = uvsAndHeights[edgeIdx].y;
     const double heightRatio = uvsAndHeights[edgeIdx].z;
@@ -396,9 +417,18 @@ static void addSkirt(
     const double latitude = Math::lerp(south, north, vRatio) + latitudeOffset;
     const double heightMeters =
         Math::lerp(minimumHeight, maximumHeight, heightRatio) - skirtHeight;
-    glm::dvec3 position = ellipsoid.cartographicToCartesian(
-        Cartographic(longitude, latitude, heightMeters));
-    position -= center;
+    cartographics.emplace_back(longitude, latitude, heightMeters);
+  }
+
+  std::vector<glm::dvec3> cartesians(cartographics.size());
+  ellipsoid.cartographicToCartesian(cartographics, cartesians);
+
+  size_t newEdgeIndex = currentVertexCount;
+  size_t positionIdx = currentVertexCount * 3;
+  size_t indexIdx = currentIndicesCount;
+  for (size_t i = 0; i < edgeIndices.size(); ++i) {
+    E edgeIdx = edgeIndices[i];
+    const glm::dvec3 position = cartesians[i] - center;
 
     positions[positionIdx] = static_cast<float>(position.x);
     positions[positionIdx + 1] = static_cast<float>(position.y);
@@ -414,6 +444,10 @@ static void addSkirt(
       normals[positionIdx + 2] = normals[componentIndex + 2];
     }
 
+    if (!parentHeightOffsets.empty()) {
+      parentHeightOffsets[newEdgeIndex] = parentHeightOffsets[edgeIdx];
+    }
+
     if (i < edgeIndices.size() - 1) {
       E nextEdgeIdx = edgeIndices[i + 1];
       indices[indexIdx++] = static_cast<I>(edgeIdx);
@@ -430,6 +464,37 @@ static void addSkirt(
   }
 }
 
+// Orders an edge's vertex indices along the edge, by the given component of
+// their u/v ratios, so that consecutive vertices can be joined by skirt
+// triangles. Tilers write the edge lists in order along the edge, so the list
+// is normally used as-is or walked in reverse, and is only sorted when it is
+// not ordered at all.
+template <class E>
+static std::span<const E> orderEdgeIndices(
+    const std::span<const E>& edgeIndices,
+    const std::vector<glm::dvec3>& uvsAndHeights,
+    glm::length_t component,
+    bool descending,
+    std::vector<E>& scratch) {
+  const auto precedes =
+      [&uvsAndHeights, component, descending](E lhs, E rhs) noexcept {
+        const double lhsRatio = uvsAndHeights[lhs][component];
+        const double rhsRatio = uvsAndHeights[rhs][component];
+        return descending ? lhsRatio > rhsRatio : lhsRatio < rhsRatio;
+      };
+
+  if (std::is_sorted(edgeIndices.begin(), edgeIndices.end(), precedes)) {
+    return edgeIndices;
+  }
+
+  scratch.assign(edgeIndices.rbegin(), edgeIndices.rend());
+  if (!std::is_sorted(scratch.begin(), scratch.end(), precedes)) {
+    std::sort(scratch.begin(), scratch.end(), precedes);
+  }
+
+  return std::span<const E>(scratch);
+}
+
 template <class E, class I>
 static void addSkirts(
     const CesiumGeospatial::Ellipsoid& ellipsoid,
@@ -449,6 +514,7 @@ static void addSkirts(
     const std::span<const std::byte>& northEdgeIndicesBuffer,
     const std::span<float>& outputPositions,
     const std::span<float>& outputNormals,
+    const std::span<float>& outputParentHeightOffsets,
     const std::span<I>& outputIndices,
     glm::dvec3& positionMinimums,
     glm::dvec3& positionMaximums) {
@@ -461,26 +527,19 @@ static void addSkirts(
   const uint32_t northVertexCount =
       static_cast<uint32_t>(northEdgeIndicesBuffer.size() / sizeof(E));
 
-  // allocate edge indices to be sort later
-  uint32_t maxEdgeVertexCount = westVertexCount;
-  maxEdgeVertexCount = glm::max(maxEdgeVertexCount, southVertexCount);
-  maxEdgeVertexCount = glm::max(maxEdgeVertexCount, eastVertexCount);
-  maxEdgeVertexCount = glm::max(maxEdgeVertexCount, northVertexCount);
-  std::vector<E> sortEdgeIndices(maxEdgeVertexCount);
+  // holds edge indices that are not already in order along the edge
+  std::vector<E> orderedEdgeIndices;
 
   // add skirt indices, vertices, and normals
   std::span<const E> westEdgeIndices(
       reinterpret_cast<const E*>(westEdgeIndicesBuffer.data()),
       westVertexCount);
-  std::partial_sort_copy(
-      westEdgeIndices.begin(),
-      westEdgeIndices.end(),
-      sortEdgeIndices.begin(),
-      sortEdgeIndices.begin() + westVertexCount,
-      [&uvsAndHeights](auto lhs, auto rhs) noexcept {
-        return uvsAndHeights[lhs].y < uvsAndHeights[rhs].y;
-      });
-  westEdgeIndices = std::span(sortEdgeIndices.data(), westVertexCount);
+  westEdgeIndices = orderEdgeIndices(
+      westEdgeIndices,
+      uvsAndHeights,
+      1,
+      false,
+      orderedEdgeIndices);
   addSkirt(
       ellipsoid,
       center,
@@ -496,6 +555,7 @@ static void addSkirts(
       westEdgeIndices,
       outputPositions,
       outputNormals,
+      outputParentHeightOffsets,
       outputIndices,
       positionMinimums,
       positionMaximums);
@@ -505,15 +565,12 @@ static void addSkirts(
   std::span<const E> southEdgeIndices(
       reinterpret_cast<const E*>(southEdgeIndicesBuffer.data()),
       southVertexCount);
-  std::partial_sort_copy(
-      southEdgeIndices.begin(),
-      southEdgeIndices.end(),
-      sortEdgeIndices.begin(),
-      sortEdgeIndices.begin() + southVertexCount,
-      [&uvsAndHeights](auto lhs, auto rhs) noexcept {
-        return uvsAndHeights[lhs].x > uvsAndHeights[rhs].x;
-      });
-  southEdgeIndices = std::span(sortEdgeIndices.data(), southVertexCount);
+  southEdgeIndices = orderEdgeIndices(
+      southEdgeIndices,
+      uvsAndHeights,
+      0,
+      true,
+      orderedEdgeIndices);
   addSkirt(
       ellipsoid,
       center,
@@ -529,6 +586,7 @@ static void addSkirts(
       southEdgeIndices,
       outputPositions,
       outputNormals,
+      outputParentHeightOffsets,
       outputIndices,
       positionMinimums,
       positionMaximums);
@@ -538,15 +596,12 @@ static void addSkirts(
   std::span<const E> eastEdgeIndices(
       reinterpret_cast<const E*>(eastEdgeIndicesBuffer.data()),
       eastVertexCount);
-  std::partial_sort_copy(
-      eastEdgeIndices.begin(),
-      eastEdgeIndices.end(),
-      sortEdgeIndices.begin(),
-      sortEdgeIndices.begin() + eastVertexCount,
-      [&uvsAndHeights](auto lhs, auto rhs) noexcept {
-        return uvsAndHeights[lhs].y > uvsAndHeights[rhs].y;
-      });
-  eastEdgeIndices = std::span(sortEdgeIndices.data(), eastVertexCount);
+  eastEdgeIndices = orderEdgeIndices(
+      eastEdgeIndices,
+      uvsAndHeights,
+      1,
+      true,
+      orderedEdgeIndices);
   addSkirt(
       ellipsoid,
       center,
@@ -562,6 +617,7 @@ static void addSkirts(
       eastEdgeIndices,
       outputPositions,
       outputNormals,
+      outputParentHeightOffsets,
       outputIndices,
       positionMinimums,
       positionMaximums);
@@ -571,15 +627,12 @@ static void addSkirts(
   std::span<const E> northEdgeIndices(
       reinterpret_cast<const E*>(northEdgeIndicesBuffer.data()),
       northVertexCount);
-  std::partial_sort_copy(
-      northEdgeIndices.begin(),
-      northEdgeIndices.end(),
-      sortEdgeIndices.begin(),
-      sortEdgeIndices.begin() + northVertexCount,
-      [&uvsAndHeights](auto lhs, auto rhs) noexcept {
-        return uvsAndHeights[lhs].x < uvsAndHeights[rhs].x;
-      });
-  northEdgeIndices = std::span(sortEdgeIndices.data(), northVertexCount);
+  northEdgeIndices = orderEdgeIndices(
+      northEdgeIndices,
+      uvsAndHeights,
+      0,
+      false,
+      orderedEdgeIndices);
   addSkirt(
       ellipsoid,
       center,
@@ -595,6 +648,7 @@ static void addSkirts(
       northEdgeIndices,
       outputPositions,
       outputNormals,
+      outputParentHeightOffsets,
       outputIndices,
       positionMinimums,
       positionMaximums);
@@ -669,13 +723,252 @@ static std::vector<std::byte> generateNormals(
   return normalsBuffer;
 }
 
+namespace {
+
+// Bins the triangles of a quantized mesh in a uniform grid over the tile's
+// u/v square, so that the triangle containing a position can be found without
+// testing every triangle.
+class TriangleGrid {
+public:
+  TriangleGrid(
+      const std::vector<int32_t>& us,
+      const std::vector<int32_t>& vs,
+      const std::vector<uint32_t>& indices)
+      : _cellsPerSide(1), _cellOffsets(), _triangles() {
+    const size_t triangleCount = indices.size() / 3;
+    this->_cellsPerSide = std::clamp(
+        static_cast<int32_t>(std::sqrt(static_cast<double>(triangleCount))),
+        1,
+        maximumCellsPerSide);
+
+    // Count the triangles overlapping each cell, then place them.
+    this->_cellOffsets.assign(this->cellCount() + 1, 0);
+    this->forEachTriangleCell(us, vs, indices, [this](size_t cell, uint32_t) {
+      ++this->_cellOffsets[cell + 1];
+    });
+    for (size_t i = 1; i < this->_cellOffsets.size(); ++i) {
+      this->_cellOffsets[i] += this->_cellOffsets[i - 1];
+    }
+
+    this->_triangles.resize(this->_cellOffsets.back());
+    std::vector<uint32_t> cellFill(
+        this->_cellOffsets.begin(),
+        this->_cellOffsets.end() - 1);
+    this->forEachTriangleCell(
+        us,
+        vs,
+        indices,
+        [this, &cellFill](size_t cell, uint32_t triangle) {
+          this->_triangles[cellFill[cell]++] = triangle;
+        });
+  }
+
+  std::span<const uint32_t> getTriangles(double u, double v) const noexcept {
+    const size_t cell = this->cellIndex(this->toCell(u), this->toCell(v));
+    return std::span<const uint32_t>(this->_triangles)
+        .subspan(
+            this->_cellOffsets[cell],
+            this->_cellOffsets[cell + 1] - this->_cellOffsets[cell]);
+  }
+
+private:
+  static constexpr int32_t maximumCellsPerSide = 64;
+
+  size_t cellCount() const noexcept {
+    return size_t(this->_cellsPerSide) * size_t(this->_cellsPerSide);
+  }
+
+  size_t cellIndex(int32_t x, int32_t y) const noexcept {
+    return size_t(y) * size_t(this->_cellsPerSide) + size_t(x);
+  }
+
+  int32_t toCell(double coordinate) const noexcept {
+    const int32_t cell =
+        static_cast<int32_t>(coordinate * this->_cellsPerSide / 32768.0);
+    return std::clamp(cell, 0, this->_cellsPerSide - 1);
+  }
+
+  template <typename Callback>
+  void forEachTriangleCell(
+      const std::vector<int32_t>& us,
+      const std::vector<int32_t>& vs,
+      const std::vector<uint32_t>& indices,
+      Callback&& callback) const {
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+      const uint32_t i0 = indices[i];
+      const uint32_t i1 = indices[i + 1];
+      const uint32_t i2 = indices[i + 2];
+      const int32_t minX =
+          this->toCell(double(std::min({us[i0], us[i1], us[i2]})));
+      const int32_t maxX =
+          this->toCell(double(std::max({us[i0], us[i1], us[i2]})));
+      const int32_t minY =
+          this->toCell(double(std::min({vs[i0], vs[i1], vs[i2]})));
+      const int32_t maxY =
+          this->toCell(double(std::max({vs[i0], vs[i1], vs[i2]})));
+      for (int32_t y = minY; y <= maxY; ++y) {
+        for (int32_t x = minX; x <= maxX; ++x) {
+          callback(this->cellIndex(x, y), static_cast<uint32_t>(i / 3));
+        }
+      }
+    }
+  }
+
+  int32_t _cellsPerSide;
+  std::vector<uint32_t> _cellOffsets;
+  std::vector<uint32_t> _triangles;
+};
+
+// Decodes the indices of a quantized mesh to 32 bits, or returns nothing if
+// any of them is out of range.
+std::optional<std::vector<uint32_t>>
+decodeIndicesToUint32(const QuantizedMeshView& meshView) {
+  const uint32_t vertexCount = meshView.header->vertexCount;
+  std::vector<uint32_t> indices(size_t(meshView.triangleCount) * 3);
+  if (meshView.indexType == QuantizedMeshIndexType::UnsignedInt) {
+    decodeIndices(
+        std::span<const uint32_t>(
+            reinterpret_cast<const uint32_t*>(meshView.indicesBuffer.data()),
+            indices.size()),
+        std::span<uint32_t>(indices));
+  } else {
+    decodeIndices(
+        std::span<const uint16_t>(
+            reinterpret_cast<const uint16_t*>(meshView.indicesBuffer.data()),
+            indices.size()),
+        std::span<uint32_t>(indices));
+  }
+
+  if (std::any_of(indices.begin(), indices.end(), [vertexCount](uint32_t i) {
+        return i >= vertexCount;
+      })) {
+    return std::nullopt;
+  }
+
+  return indices;
+}
+
+// Interpolates the quantized height of the mesh at the given u and v, within
+// the triangle that contains them.
+std::optional<double> interpolateHeight(
+    const TriangleGrid& grid,
+    const std::vector<int32_t>& us,
+    const std::vector<int32_t>& vs,
+    const std::vector<int32_t>& heights,
+    const std::vector<uint32_t>& indices,
+    double pu,
+    double pv) {
+  // Positions exactly on an edge between triangles may fall slightly outside
+  // both due to rounding.
+  const double barycentricEpsilon = 1e-9;
+
+  for (uint32_t triangle : grid.getTriangles(pu, pv)) {
+    const uint32_t i0 = indices[size_t(triangle) * 3];
+    const uint32_t i1 = indices[size_t(triangle) * 3 + 1];
+    const uint32_t i2 = indices[size_t(triangle) * 3 + 2];
+
+    const double x0 = us[i0], y0 = vs[i0];
+    const double x1 = us[i1], y1 = vs[i1];
+    const double x2 = us[i2], y2 = vs[i2];
+
+    const double determinant = (y1 - y2) * (x0 - x2) + (x2 - x1) * (y0 - y2);
+    if (determinant == 0.0) {
+      continue;
+    }
+
+    const double l0 =
+        ((y1 - y2) * (pu - x2) + (x2 - x1) * (pv - y2)) / determinant;
+    const double l1 =
+        ((y2 - y0) * (pu - x2) + (x0 - x2) * (pv - y2)) / determinant;
+    const double l2 = 1.0 - l0 - l1;
+    if (l0 < -barycentricEpsilon || l1 < -barycentricEpsilon ||
+        l2 < -barycentricEpsilon) {
+      continue;
+    }
+
+    return l0 * heights[i0] + l1 * heights[i1] + l2 * heights[i2];
+  }
+
+  return std::nullopt;
+}
+
+// Computes, for each vertex, the distance in meters from the vertex to an
+// approximation of the parent tile's surface. The parent tile covers four
+// times the area with about as many vertices, so over this tile it has about
+// half as many vertices in each direction. Its surface is approximated by
+// sampling this tile's mesh on a grid with that many samples, and
+// interpolating bilinearly between them, so detail that the parent would
+// have simplified away is offset to its smoother surface. Where a sample could
+// not be taken, the offset is left unchanged.
+void computeParentHeightOffsets(
+    const std::vector<int32_t>& us,
+    const std::vector<int32_t>& vs,
+    const std::vector<int32_t>& heights,
+    const std::vector<uint32_t>& indices,
+    double minimumHeight,
+    double maximumHeight,
+    const std::span<float>& offsets) {
+  // A tile with n by n vertices has n - 1 cells in each direction, and the
+  // parent has about half as many over this tile.
+  const size_t verticesPerSide = size_t(std::sqrt(double(us.size())));
+  const size_t parentGridSize = std::max(verticesPerSide / 2 + 1, size_t(2));
+  const double parentGridMax = double(parentGridSize - 1);
+  const double parentCellSize = 32767.0 / parentGridMax;
+
+  const TriangleGrid grid(us, vs, indices);
+  std::vector<std::optional<double>> parentHeights;
+  parentHeights.reserve(parentGridSize * parentGridSize);
+  for (size_t y = 0; y < parentGridSize; ++y) {
+    for (size_t x = 0; x < parentGridSize; ++x) {
+      parentHeights.emplace_back(interpolateHeight(
+          grid,
+          us,
+          vs,
+          heights,
+          indices,
+          double(x) * parentCellSize,
+          double(y) * parentCellSize));
+    }
+  }
+
+  const double metersPerHeight = (maximumHeight - minimumHeight) / 32767.0;
+  for (size_t i = 0; i < us.size(); ++i) {
+    const double gridX =
+        std::clamp(double(us[i]) / parentCellSize, 0.0, parentGridMax);
+    const double gridY =
+        std::clamp(double(vs[i]) / parentCellSize, 0.0, parentGridMax);
+    const size_t x0 = std::min(size_t(gridX), parentGridSize - 2);
+    const size_t y0 = std::min(size_t(gridY), parentGridSize - 2);
+    const std::optional<double>& h00 = parentHeights[y0 * parentGridSize + x0];
+    const std::optional<double>& h10 =
+        parentHeights[y0 * parentGridSize + x0 + 1];
+    const std::optional<double>& h01 =
+        parentHeights[(y0 + 1) * parentGridSize + x0];
+    const std::optional<double>& h11 =
+        parentHeights[(y0 + 1) * parentGridSize + x0 + 1];
+    if (!h00 || !h10 || !h01 || !h11) {
+      continue;
+    }
+
+    const double fx = gridX - double(x0);
+    const double fy = gridY - double(y0);
+    const double parentHeight =
+        Math::lerp(Math::lerp(*h00, *h10, fx), Math::lerp(*h01, *h11, fx), fy);
+    offsets[i] =
+        static_cast<float>((parentHeight - heights[i]) * metersPerHeight);
+  }
+}
+
+} // namespace
+
 /*static*/ QuantizedMeshLoadResult QuantizedMeshLoader::load(
     const QuadtreeTileID& tileID,
     const BoundingRegion& tileBoundingVolume,
     const std::string& url,
     const std::span<const std::byte>& data,
     bool enableWaterMask,
-    const CesiumGeospatial::Ellipsoid& ellipsoid) {
+    const CesiumGeospatial::Ellipsoid& ellipsoid,
+    bool generateParentHeightOffsets) {
 
   CESIUM_TRACE("Cesium3DTilesSelection::QuantizedMeshLoader::load");
 
@@ -727,36 +1020,44 @@ static std::vector<std::byte> generateNormals(
   const double east = rectangle.getEast();
   const double north = rectangle.getNorth();
 
-  int32_t u = 0;
-  int32_t v = 0;
-  int32_t height = 0;
+  // Decode the u, v, and height of each vertex, and then convert all of them
+  // to cartesian positions at once.
+  std::vector<int32_t> us(vertexCount);
+  std::vector<int32_t> vs(vertexCount);
+  std::vector<int32_t> heights(vertexCount);
+  decodeZigZagDeltas(meshView->uBuffer, us);
+  decodeZigZagDeltas(meshView->vBuffer, vs);
+  decodeZigZagDeltas(meshView->heightBuffer, heights);
+
   std::vector<glm::dvec3> uvsAndHeights;
   uvsAndHeights.reserve(vertexCount);
+  std::vector<Cartographic> cartographics;
+  cartographics.reserve(vertexCount);
   for (size_t i = 0; i < vertexCount; ++i) {
-    u += zigZagDecode(meshView->uBuffer[i]);
-    v += zigZagDecode(meshView->vBuffer[i]);
-    height += zigZagDecode(meshView->heightBuffer[i]);
-
-    double uRatio = static_cast<double>(u) / 32767.0;
-    double vRatio = static_cast<double>(v) / 32767.0;
-    double heightRatio = static_cast<double>(height) / 32767.0;
+    double uRatio = static_cast<double>(us[i]) / 32767.0;
+    double vRatio = static_cast<double>(vs[i]) / 32767.0;
+    double heightRatio = static_cast<double>(heights[i]) / 32767.0;
 
     const double longitude = Math::lerp(west, east, uRatio);
     const double latitude = Math::lerp(south, north, vRatio);
     const double heightMeters =
         Math::lerp(minimumHeight, maximumHeight, heightRatio);
 
-    glm::dvec3 position = ellipsoid.cartographicToCartesian(
-        Cartographic(longitude, latitude, heightMeters));
-    position -= center;
+    cartographics.emplace_back(longitude, latitude, heightMeters);
+    uvsAndHeights.emplace_back(uRatio, vRatio, heightRatio);
+  }
+
+  std::vector<glm::dvec3> cartesians(vertexCount);
+  ellipsoid.cartographicToCartesian(cartographics, cartesians);
+
+  for (const glm::dvec3& cartesian : cartesians) {
+    const glm::dvec3 position = cartesian - center;
     outputPositions[positionOutputIndex++] = static_cast<float>(position.x);
     outputPositions[positionOutputIndex++] = static_cast<float>(position.y);
     outputPositions[positionOutputIndex++] = static_cast<float>(position.z);
 
     positionMinimums = glm::min(positionMinimums, position);
     positionMaximums = glm::max(positionMaximums, position);
-
-    uvsAndHeights.emplace_back(uRatio, vRatio, heightRatio);
   }
 
   // decode normal vertices of the tile as well as its metadata without skirt
@@ -783,6 +1084,30 @@ static std::vector<std::byte> generateNormals(
     result.errors.merge(std::move(metadata.errors));
   }
 
+  // compute the parent height offsets before the skirts, which copy them from
+  // the edge vertices
+  std::vector<std::byte> outputParentHeightOffsetsBuffer;
+  std::span<float> outputParentHeightOffsets;
+  if (generateParentHeightOffsets) {
+    std::optional<std::vector<uint32_t>> maybeIndices =
+        decodeIndicesToUint32(*meshView);
+    if (maybeIndices) {
+      const uint32_t totalVertices = vertexCount + skirtVertexCount;
+      outputParentHeightOffsetsBuffer.resize(totalVertices * sizeof(float));
+      outputParentHeightOffsets = std::span<float>(
+          reinterpret_cast<float*>(outputParentHeightOffsetsBuffer.data()),
+          totalVertices);
+      computeParentHeightOffsets(
+          us,
+          vs,
+          heights,
+          *maybeIndices,
+          minimumHeight,
+          maximumHeight,
+          outputParentHeightOffsets);
+    }
+  }
+
   // indices buffer for gltf to include tile and skirt indices. Caution of
   // indices type since adding skirt means the number of vertices is potentially
   // over maximum of uint16_t
@@ -834,6 +1159,7 @@ static std::vector<std::byte> generateNormals(
         meshView->northEdgeIndicesBuffer,
         outputPositions,
         outputNormals,
+        outputParentHeightOffsets,
         outputIndices,
         positionMinimums,
         positionMaximums);
@@ -879,6 +1205,7 @@ static std::vector<std::byte> generateNormals(
           meshView->northEdgeIndicesBuffer,
           outputPositions,
           outputNormals,
+          outputParentHeightOffsets,
           outputIndices,
           positionMinimums,
           positionMaximums);
@@ -918,6 +1245,7 @@ static std::vector<std::byte> generateNormals(
           meshView->northEdgeIndicesBuffer,
           outputPositions,
           outputNormals,
+          outputParentHeightOffsets,
           outputIndices,
           positionMinimums,
           positionMaximums);
@@ -1012,6 +1340,37 @@ static std::vector<std::byte> generateNormals(
     primitive.attributes.emplace("NORMAL", static_cast<int>(normalAccessorId));
   }
 
+  // add parent height offsets to gltf if they were generated
+  if (!outputParentHeightOffsetsBuffer.empty()) {
+    const size_t offsetBufferId = model.buffers.size();
+    model.buffers.emplace_back();
+    CesiumGltf::Buffer& offsetBuffer = model.buffers[offsetBufferId];
+    offsetBuffer.byteLength = int64_t(outputParentHeightOffsetsBuffer.size());
+    offsetBuffer.cesium.data = std::move(outputParentHeightOffsetsBuffer);
+
+    const size_t offsetBufferViewId = model.bufferViews.size();
+    model.bufferViews.emplace_back();
+    CesiumGltf::BufferView& offsetBufferView =
+        model.bufferViews[offsetBufferViewId];
+    offsetBufferView.buffer = int32_t(offsetBufferId);
+    offsetBufferView.byteOffset = 0;
+    offsetBufferView.byteLength = int64_t(offsetBuffer.cesium.data.size());
+    offsetBufferView.target = CesiumGltf::BufferView::Target::ARRAY_BUFFER;
+
+    const size_t offsetAccessorId = model.accessors.size();
+    model.accessors.emplace_back();
+    CesiumGltf::Accessor& offsetAccessor = model.accessors[offsetAccessorId];
+    offsetAccessor.bufferView = int32_t(offsetBufferViewId);
+    offsetAccessor.byteOffset = 0;
+    offsetAccessor.componentType = CesiumGltf::Accessor::ComponentType::FLOAT;
+    offsetAccessor.count = vertexCount + skirtVertexCount;
+    offsetAccessor.type = CesiumGltf::Accessor::Type::SCALAR;
+
+    primitive.attributes.emplace(
+        std::string(PARENT_HEIGHT_OFFSET_ATTRIBUTE_NAME),
+        int32_t(offsetAccessorId));
+  }
+
   // add indices buffer to gltf
   const size_t indicesBufferId = model.buffers.size();
   model.buffers.emplace_back();
@@ -1213,6 +1572,28 @@ static QuantizedMeshMetadataResult processMetadata(
       tileID.level + 1);
 }
 
+/*static*/ void
+QuantizedMeshLoader::clearParentHeightOffsets(CesiumGltf::Model& model) {
+  const std::string attributeName(PARENT_HEIGHT_OFFSET_ATTRIBUTE_NAME);
+  for (CesiumGltf::Mesh& mesh : model.meshes) {
+    for (CesiumGltf::MeshPrimitive& primitive : mesh.primitives) {
+      auto it = primitive.attributes.find(attributeName);
+      if (it == primitive.attributes.end()) {
+        continue;
+      }
+
+      CesiumGltf::AccessorWriter<float> offsets(model, it->second);
+      if (offsets.status() != CesiumGltf::AccessorViewStatus::Valid) {
+        continue;
+      }
+
+      for (int64_t i = 0; i < offsets.size(); ++i) {
+        offsets[i] = 0.0f;
+      }
+    }
+  }
+}
+
 /*static*/ QuantizedMeshMetadataResult QuantizedMeshLoader::loadMetadata(
     const std::span<const std::byte>& data,
     const QuadtreeTileID& tileID) {
@@ -1222,3 +1603,68 @@ static QuantizedMeshMetadataResult processMetadata(
   }
   return processMetadata(tileID, meshView->metadataJsonBuffer);
 }
+
+/*static*/ QuantizedMeshSampleHeightsResult QuantizedMeshLoader::sampleHeights(
+    const GlobeRectangle& tileRectangle,
+    const std::span<const std::byte>& data,
+    const std::span<const Cartographic>& positions) {
+  CESIUM_TRACE("Cesium3DTilesSelection::QuantizedMeshLoader::sampleHeights");
+
+  QuantizedMeshSampleHeightsResult result;
+  result.heights.resize(positions.size(), 0.0);
+  result.sampleSuccess.resize(positions.size(), false);
+
+  std::optional<QuantizedMeshView> meshView = parseQuantizedMesh(data, false);
+  if (!meshView) {
+    result.errors.emplaceError("Unable to parse quantized-mesh-1.0 tile.");
+    return result;
+  }
+
+  // Decode the u, v, and height of each vertex, without computing positions.
+  const uint32_t vertexCount = meshView->header->vertexCount;
+  std::vector<int32_t> us(vertexCount);
+  std::vector<int32_t> vs(vertexCount);
+  std::vector<int32_t> heights(vertexCount);
+  decodeZigZagDeltas(meshView->uBuffer, us);
+  decodeZigZagDeltas(meshView->vBuffer, vs);
+  decodeZigZagDeltas(meshView->heightBuffer, heights);
+
+  std::optional<std::vector<uint32_t>> maybeIndices =
+      decodeIndicesToUint32(*meshView);
+  if (!maybeIndices) {
+    result.errors.emplaceError(
+        "Quantized-mesh-1.0 tile has indices that are out of range.");
+    return result;
+  }
+
+  const std::vector<uint32_t>& indices = *maybeIndices;
+  const TriangleGrid grid(us, vs, indices);
+
+  const double minimumHeight = meshView->header->MinimumHeight;
+  const double maximumHeight = meshView->header->MaximumHeight;
+  const double west = tileRectangle.getWest();
+  const double south = tileRectangle.getSouth();
+  const double rectangleWidth = tileRectangle.computeWidth();
+  const double rectangleHeight = tileRectangle.computeHeight();
+
+  for (size_t i = 0; i < positions.size(); ++i) {
+    const double pu =
+        (positions[i].longitude - west) / rectangleWidth * 32767.0;
+    const double pv =
+        (positions[i].latitude - south) / rectangleHeight * 32767.0;
+    if (!(pu >= -Math::Epsilon6 && pu <= 32767.0 + Math::Epsilon6 &&
+          pv >= -Math::Epsilon6 && pv <= 32767.0 + Math::Epsilon6)) {
+      continue;
+    }
+
+    const std::optional<double> height =
+        interpolateHeight(grid, us, vs, heights, indices, pu, pv);
+    if (height) {
+      result.heights[i] =
+          Math::lerp(minimumHeight, maximumHeight, *height / 32767.0);
+      result.sampleSuccess[i] = true;
+    }
+  }
+
+  return result;
+}
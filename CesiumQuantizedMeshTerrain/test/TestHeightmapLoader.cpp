@@ -0,0 +1,299 @@
+#include <CesiumGeometry/QuadtreeTileID.h>
+#include <CesiumGeometry/QuadtreeTileRectangularRange.h>
+#include <CesiumGeometry/QuadtreeTilingScheme.h>
+#include <CesiumGeometry/Rectangle.h>
+#include <CesiumGeospatial/BoundingRegion.h>
+#include <CesiumGeospatial/Cartographic.h>
+#include <CesiumGeospatial/Ellipsoid.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumGltf/AccessorView.h>
+#include <CesiumGltfContent/SkirtMeshMetadata.h>
+#include <CesiumQuantizedMeshTerrain/HeightmapLoader.h>
+#include <CesiumUtility/Math.h>
+
+#include <catch2/catch.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+using namespace CesiumGeometry;
+using namespace CesiumGeospatial;
+using namespace CesiumGltf;
+using namespace CesiumGltfContent;
+using namespace CesiumQuantizedMeshTerrain;
+using namespace CesiumUtility;
+
+namespace {
+constexpr uint32_t width = HeightmapLoader::Width;
+
+// Creates a heightmap-1.0 tile with rolling hills, so that every part of it
+// needs a different number of triangles.
+std::vector<std::byte> createHeightmap(uint8_t childMask) {
+  std::vector<std::byte> data;
+  data.reserve(width * width * 2 + 2);
+  for (uint32_t y = 0; y < width; ++y) {
+    for (uint32_t x = 0; x < width; ++x) {
+      const double height = 500.0 +
+                            300.0 * std::sin(double(x) * 0.2) *
+                                std::cos(double(y) * 0.15) +
+                            40.0 * std::sin(double(x * y) * 0.05);
+      const uint16_t value = uint16_t(std::lround((height + 1000.0) * 5.0));
+      data.emplace_back(std::byte(value & 0xFF));
+      data.emplace_back(std::byte(value >> 8));
+    }
+  }
+  data.emplace_back(std::byte(childMask));
+  // A water mask, which is ignored.
+  data.emplace_back(std::byte(0));
+  return data;
+}
+
+double getGridHeight(const std::vector<std::byte>& data, size_t x, size_t y) {
+  const size_t i = (y * width + x) * 2;
+  const uint16_t value =
+      uint16_t(uint16_t(data[i]) | (uint16_t(data[i + 1]) << 8));
+  return double(value) / 5.0 - 1000.0;
+}
+
+struct GridVertex {
+  int64_t x;
+  int64_t y;
+  double height;
+};
+
+// Finds the grid position and height of each vertex of the mesh, leaving out
+// the skirts.
+std::vector<GridVertex> getGridVertices(
+    const Model& model,
+    const GlobeRectangle& rectangle,
+    const Ellipsoid& ellipsoid) {
+  const MeshPrimitive& primitive = model.meshes[0].primitives[0];
+  std::optional<SkirtMeshMetadata> skirtMeshMetadata =
+      SkirtMeshMetadata::parseFromGltfExtras(primitive.extras);
+  REQUIRE(skirtMeshMetadata);
+
+  AccessorView<glm::vec3> positions(
+      model,
+      primitive.attributes.at("POSITION"));
+  REQUIRE(positions.status() == AccessorViewStatus::Valid);
+
+  std::vector<GridVertex> vertices;
+  for (uint32_t i = 0; i < skirtMeshMetadata->noSkirtVerticesCount; ++i) {
+    std::optional<Cartographic> cartographic =
+        ellipsoid.cartesianToCartographic(
+            glm::dvec3(positions[i]) + skirtMeshMetadata->meshCenter);
+    REQUIRE(cartographic);
+    vertices.push_back(GridVertex{
+        std::lround(
+            (cartographic->longitude - rectangle.getWest()) /
+            rectangle.computeWidth() * (width - 1)),
+        std::lround(
+            (rectangle.getNorth() - cartographic->latitude) /
+            rectangle.computeHeight() * (width - 1)),
+        cartographic->height});
+  }
+
+  return vertices;
+}
+
+// Finds the largest distance between a height of the grid and the mesh
+// triangle above or below it.
+double computeMeshError(
+    const std::vector<std::byte>& data,
+    const Model& model,
+    const std::vector<GridVertex>& vertices) {
+  const MeshPrimitive& primitive = model.meshes[0].primitives[0];
+  std::optional<SkirtMeshMetadata> skirtMeshMetadata =
+      SkirtMeshMetadata::parseFromGltfExtras(primitive.extras);
+  AccessorView<uint16_t> indices(model, primitive.indices);
+  REQUIRE(indices.status() == AccessorViewStatus::Valid);
+
+  double maximumError = 0.0;
+  for (uint32_t i = 0; i < skirtMeshMetadata->noSkirtIndicesCount; i += 3) {
+    const GridVertex& a = vertices[size_t(indices[i])];
+    const GridVertex& b = vertices[size_t(indices[i + 1])];
+    const GridVertex& c = vertices[size_t(indices[i + 2])];
+    const int64_t area = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+    REQUIRE(area != 0);
+
+    const int64_t minimumX = std::min({a.x, b.x, c.x});
+    const int64_t maximumX = std::max({a.x, b.x, c.x});
+    const int64_t minimumY = std::min({a.y, b.y, c.y});
+    const int64_t maximumY = std::max({a.y, b.y, c.y});
+    for (int64_t y = minimumY; y <= maximumY; ++y) {
+      for (int64_t x = minimumX; x <= maximumX; ++x) {
+        const double wa =
+            double((b.x - x) * (c.y - y) - (b.y - y) * (c.x - x)) /
+            double(area);
+        const double wb =
+            double((c.x - x) * (a.y - y) - (c.y - y) * (a.x - x)) /
+            double(area);
+        const double wc = 1.0 - wa - wb;
+        if (wa < 0.0 || wb < 0.0 || wc < 0.0) {
+          continue;
+        }
+
+        const double height = wa * a.height + wb * b.height + wc * c.height;
+        maximumError = std::max(
+            maximumError,
+            std::abs(height - getGridHeight(data, size_t(x), size_t(y))));
+      }
+    }
+  }
+
+  return maximumError;
+}
+} // namespace
+
+TEST_CASE("HeightmapLoader") {
+  const Ellipsoid& ellipsoid = Ellipsoid::WGS84;
+  const QuadtreeTilingScheme tilingScheme(
+      Rectangle(-Math::OnePi, -Math::PiOverTwo, Math::OnePi, Math::PiOverTwo),
+      2,
+      1);
+  const QuadtreeTileID tileID(8, 300, 150);
+  const Rectangle tileRectangle = tilingScheme.tileToRectangle(tileID);
+  const GlobeRectangle globeRectangle(
+      tileRectangle.minimumX,
+      tileRectangle.minimumY,
+      tileRectangle.maximumX,
+      tileRectangle.maximumY);
+  const BoundingRegion boundingRegion(
+      globeRectangle,
+      -1000.0,
+      9000.0,
+      ellipsoid);
+
+  SECTION("the mesh is within the maximum error of every height") {
+    const std::vector<std::byte> data = createHeightmap(0);
+
+    size_t previousVertexCount = 0;
+    for (double maximumError : {40.0, 10.0, 2.0, 0.0}) {
+      QuantizedMeshLoadResult result = HeightmapLoader::load(
+          tileID,
+          boundingRegion,
+          "url",
+          data,
+          maximumError,
+          ellipsoid);
+      REQUIRE(!result.errors.hasErrors());
+      REQUIRE(result.model);
+
+      const std::vector<GridVertex> vertices =
+          getGridVertices(*result.model, globeRectangle, ellipsoid);
+      for (const GridVertex& vertex : vertices) {
+        CHECK(
+            std::abs(
+                vertex.height -
+                getGridHeight(data, size_t(vertex.x), size_t(vertex.y))) <
+            0.05);
+      }
+
+      // Allow for the precision of the float positions.
+      CHECK(
+          computeMeshError(data, *result.model, vertices) <=
+          maximumError + 0.05);
+
+      // A smaller error needs more vertices, up to every height of the grid.
+      CHECK(vertices.size() > previousVertexCount);
+      CHECK(vertices.size() <= size_t(width) * width);
+      previousVertexCount = vertices.size();
+    }
+  }
+
+  SECTION("a flat tile needs only its corners") {
+    std::vector<std::byte> data(width * width * 2 + 1, std::byte(0x20));
+
+    QuantizedMeshLoadResult result = HeightmapLoader::load(
+        tileID,
+        boundingRegion,
+        "url",
+        data,
+        0.0,
+        ellipsoid);
+    REQUIRE(result.model);
+
+    const std::vector<GridVertex> vertices =
+        getGridVertices(*result.model, globeRectangle, ellipsoid);
+    CHECK(vertices.size() == 4);
+  }
+
+  SECTION("the bounding volume is fitted to the heights") {
+    const std::vector<std::byte> data = createHeightmap(0);
+    double minimumHeight = getGridHeight(data, 0, 0);
+    double maximumHeight = minimumHeight;
+    for (size_t y = 0; y < width; ++y) {
+      for (size_t x = 0; x < width; ++x) {
+        minimumHeight = std::min(minimumHeight, getGridHeight(data, x, y));
+        maximumHeight = std::max(maximumHeight, getGridHeight(data, x, y));
+      }
+    }
+
+    QuantizedMeshLoadResult result = HeightmapLoader::load(
+        tileID,
+        boundingRegion,
+        "url",
+        data,
+        10.0,
+        ellipsoid);
+    REQUIRE(result.updatedBoundingVolume);
+    CHECK(
+        result.updatedBoundingVolume->getMinimumHeight() ==
+        Approx(minimumHeight));
+    CHECK(
+        result.updatedBoundingVolume->getMaximumHeight() ==
+        Approx(maximumHeight));
+  }
+
+  SECTION("the child mask gives the available children") {
+    // The southwest and northwest children.
+    const std::vector<std::byte> data = createHeightmap(0b0101);
+
+    QuantizedMeshLoadResult result = HeightmapLoader::load(
+        tileID,
+        boundingRegion,
+        "url",
+        data,
+        10.0,
+        ellipsoid);
+    REQUIRE(result.availableTileRectangles.size() == 2);
+
+    const QuadtreeTileRectangularRange& southwest =
+        result.availableTileRectangles[0];
+    CHECK(southwest.level == 9);
+    CHECK(southwest.minimumX == 600);
+    CHECK(southwest.minimumY == 300);
+    CHECK(southwest.maximumX == 600);
+    CHECK(southwest.maximumY == 300);
+
+    const QuadtreeTileRectangularRange& northwest =
+        result.availableTileRectangles[1];
+    CHECK(northwest.level == 9);
+    CHECK(northwest.minimumX == 600);
+    CHECK(northwest.minimumY == 301);
+    CHECK(northwest.maximumX == 600);
+    CHECK(northwest.maximumY == 301);
+  }
+
+  SECTION("ill-formed data reports an error") {
+    std::vector<std::byte> data = createHeightmap(0);
+    data.resize(width * width * 2);
+
+    QuantizedMeshLoadResult result = HeightmapLoader::load(
+        tileID,
+        boundingRegion,
+        "url",
+        data,
+        10.0,
+        ellipsoid);
+    CHECK(result.errors.hasErrors());
+    CHECK(!result.model);
+  }
+}
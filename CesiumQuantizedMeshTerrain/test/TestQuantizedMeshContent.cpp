@@ -7,10 +7,12 @@
 #include <CesiumQuantizedMeshTerrain/QuantizedMeshLoader.h>
 #include <CesiumUtility/Math.h>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <glm/glm.hpp>
 
+#include <algorithm>
 #include <vector>
 
 using namespace Cesium3DTilesContent;
@@ -1628,3 +1630,369 @@ TEST_CASE("Test converting ill-formed quantized mesh") {
     REQUIRE(loadResult.model == std::nullopt);
   }
 }
+
+TEST_CASE("Test sampling heights from quantized mesh") {
+  CesiumGeometry::Rectangle rectangle(
+      glm::radians(-180.0),
+      glm::radians(-90.0),
+      glm::radians(180.0),
+      glm::radians(90.0));
+  QuadtreeTilingScheme tilingScheme(rectangle, 2, 1);
+
+  QuadtreeTileID tileID(10, 0, 0);
+  CesiumGeometry::Rectangle tileRectangle =
+      tilingScheme.tileToRectangle(tileID);
+  GlobeRectangle globeRectangle(
+      tileRectangle.minimumX,
+      tileRectangle.minimumY,
+      tileRectangle.maximumX,
+      tileRectangle.maximumY);
+  BoundingRegion boundingVolume(globeRectangle, 0.0, 100.0, Ellipsoid::WGS84);
+
+  // Make the grid slope up from west to east, so that the height at each
+  // vertex is proportional to its u coordinate. Interpolating within any
+  // triangle then reproduces the slope exactly.
+  QuantizedMesh<uint16_t> quantizedMesh =
+      createGridQuantizedMesh<uint16_t>(boundingVolume, 17, 9);
+  int32_t u = 0;
+  int32_t lastHeight = 0;
+  for (size_t i = 0; i < quantizedMesh.vertexData.u.size(); ++i) {
+    u += zigZagDecode(quantizedMesh.vertexData.u[i]);
+    quantizedMesh.vertexData.height[i] =
+        zigzagEncode(static_cast<int16_t>(u - lastHeight));
+    lastHeight = u;
+  }
+
+  std::vector<std::byte> quantizedMeshBin =
+      convertQuantizedMeshToBinary(quantizedMesh);
+
+  const double west = globeRectangle.getWest();
+  const double south = globeRectangle.getSouth();
+  const double width = globeRectangle.computeWidth();
+  const double height = globeRectangle.computeHeight();
+
+  std::vector<Cartographic> positions{
+      Cartographic(west + 0.3 * width, south + 0.6 * height),
+      Cartographic(west + 0.75 * width, south + 0.1 * height),
+      Cartographic(west, south),
+      Cartographic(west + width, south + height),
+      Cartographic(west - 0.1 * width, south + 0.5 * height)};
+
+  QuantizedMeshSampleHeightsResult result =
+      QuantizedMeshLoader::sampleHeights(
+          globeRectangle,
+          quantizedMeshBin,
+          positions);
+  REQUIRE(!result.errors.hasErrors());
+  REQUIRE(result.heights.size() == positions.size());
+  REQUIRE(result.sampleSuccess.size() == positions.size());
+
+  CHECK(result.sampleSuccess[0]);
+  CHECK(Math::equalsEpsilon(result.heights[0], 30.0, 0.0, Math::Epsilon4));
+  CHECK(result.sampleSuccess[1]);
+  CHECK(Math::equalsEpsilon(result.heights[1], 75.0, 0.0, Math::Epsilon4));
+
+  // Corners are on the mesh, too.
+  CHECK(result.sampleSuccess[2]);
+  CHECK(Math::equalsEpsilon(result.heights[2], 0.0, 0.0, Math::Epsilon4));
+  CHECK(result.sampleSuccess[3]);
+  CHECK(Math::equalsEpsilon(result.heights[3], 100.0, 0.0, Math::Epsilon4));
+
+  // Positions outside the tile can't be sampled.
+  CHECK(!result.sampleSuccess[4]);
+
+  SECTION("Ill-formed data reports an error") {
+    std::vector<std::byte> truncated(
+        quantizedMeshBin.begin(),
+        quantizedMeshBin.begin() + 10);
+    QuantizedMeshSampleHeightsResult badResult =
+        QuantizedMeshLoader::sampleHeights(
+            globeRectangle,
+            truncated,
+            positions);
+    CHECK(badResult.errors.hasErrors());
+    CHECK(badResult.sampleSuccess == std::vector<bool>(positions.size()));
+  }
+}
+
+TEST_CASE("Test quantized mesh skirts with edge indices in any order") {
+  CesiumGeometry::Rectangle rectangle(
+      glm::radians(-180.0),
+      glm::radians(-90.0),
+      glm::radians(180.0),
+      glm::radians(90.0));
+  QuadtreeTilingScheme tilingScheme(rectangle, 2, 1);
+
+  QuadtreeTileID tileID(10, 0, 0);
+  CesiumGeometry::Rectangle tileRectangle =
+      tilingScheme.tileToRectangle(tileID);
+  BoundingRegion boundingVolume(
+      GlobeRectangle(
+          tileRectangle.minimumX,
+          tileRectangle.minimumY,
+          tileRectangle.maximumX,
+          tileRectangle.maximumY),
+      0.0,
+      0.0,
+      Ellipsoid::WGS84);
+
+  QuantizedMesh<uint16_t> quantizedMesh =
+      createGridQuantizedMesh<uint16_t>(boundingVolume, 5, 5);
+  std::vector<std::byte> orderedBin =
+      convertQuantizedMeshToBinary(quantizedMesh);
+
+  // The grid's edges are written in order along each edge. Reverse one and
+  // scramble another, which must produce the same skirts.
+  std::reverse(
+      quantizedMesh.vertexData.westIndices.begin(),
+      quantizedMesh.vertexData.westIndices.end());
+  std::rotate(
+      quantizedMesh.vertexData.northIndices.begin(),
+      quantizedMesh.vertexData.northIndices.begin() + 2,
+      quantizedMesh.vertexData.northIndices.end());
+  std::vector<std::byte> reorderedBin =
+      convertQuantizedMeshToBinary(quantizedMesh);
+
+  QuantizedMeshLoadResult ordered = QuantizedMeshLoader::load(
+      tileID,
+      boundingVolume,
+      "url",
+      orderedBin,
+      false);
+  QuantizedMeshLoadResult reordered = QuantizedMeshLoader::load(
+      tileID,
+      boundingVolume,
+      "url",
+      reorderedBin,
+      false);
+  REQUIRE(ordered.model);
+  REQUIRE(reordered.model);
+
+  const MeshPrimitive& orderedPrimitive =
+      ordered.model->meshes.front().primitives.front();
+  const MeshPrimitive& reorderedPrimitive =
+      reordered.model->meshes.front().primitives.front();
+
+  AccessorView<glm::vec3> orderedPositions(
+      *ordered.model,
+      orderedPrimitive.attributes.at("POSITION"));
+  AccessorView<glm::vec3> reorderedPositions(
+      *reordered.model,
+      reorderedPrimitive.attributes.at("POSITION"));
+  REQUIRE(orderedPositions.size() == reorderedPositions.size());
+  for (int64_t i = 0; i < orderedPositions.size(); ++i) {
+    CHECK(orderedPositions[i] == reorderedPositions[i]);
+  }
+
+  AccessorView<uint16_t> orderedIndices(
+      *ordered.model,
+      orderedPrimitive.indices);
+  AccessorView<uint16_t> reorderedIndices(
+      *reordered.model,
+      reorderedPrimitive.indices);
+  REQUIRE(orderedIndices.size() == reorderedIndices.size());
+  for (int64_t i = 0; i < orderedIndices.size(); ++i) {
+    CHECK(orderedIndices[i] == reorderedIndices[i]);
+  }
+}
+
+TEST_CASE("Test quantized mesh parent height offsets") {
+  CesiumGeometry::Rectangle rectangle(
+      glm::radians(-180.0),
+      glm::radians(-90.0),
+      glm::radians(180.0),
+      glm::radians(90.0));
+  QuadtreeTilingScheme tilingScheme(rectangle, 2, 1);
+
+  QuadtreeTileID tileID(10, 0, 0);
+  CesiumGeometry::Rectangle tileRectangle =
+      tilingScheme.tileToRectangle(tileID);
+  BoundingRegion boundingVolume(
+      GlobeRectangle(
+          tileRectangle.minimumX,
+          tileRectangle.minimumY,
+          tileRectangle.maximumX,
+          tileRectangle.maximumY),
+      0.0,
+      100.0,
+      Ellipsoid::WGS84);
+
+  // Encodes the given height for every vertex of the mesh.
+  const auto setHeights = [](QuantizedMesh<uint16_t>& quantizedMesh,
+                             const std::vector<int32_t>& heights) {
+    int32_t lastHeight = 0;
+    for (size_t i = 0; i < heights.size(); ++i) {
+      quantizedMesh.vertexData.height[i] =
+          zigzagEncode(static_cast<int16_t>(heights[i] - lastHeight));
+      lastHeight = heights[i];
+    }
+  };
+
+  SECTION("Offsets are only added when requested") {
+    std::vector<std::byte> quantizedMeshBin = convertQuantizedMeshToBinary(
+        createGridQuantizedMesh<uint16_t>(boundingVolume, 5, 5));
+    QuantizedMeshLoadResult result = QuantizedMeshLoader::load(
+        tileID,
+        boundingVolume,
+        "url",
+        quantizedMeshBin,
+        false);
+    REQUIRE(result.model);
+    CHECK(
+        !result.model->meshes[0].primitives[0].attributes.contains(
+            "_PARENT_HEIGHT_OFFSET"));
+  }
+
+  SECTION("A plane is the same at the parent's level") {
+    QuantizedMesh<uint16_t> quantizedMesh =
+        createGridQuantizedMesh<uint16_t>(boundingVolume, 17, 9);
+    std::vector<int32_t> heights;
+    int32_t u = 0;
+    for (uint16_t encodedU : quantizedMesh.vertexData.u) {
+      u += zigZagDecode(encodedU);
+      heights.emplace_back(u);
+    }
+    setHeights(quantizedMesh, heights);
+
+    QuantizedMeshLoadResult result = QuantizedMeshLoader::load(
+        tileID,
+        boundingVolume,
+        "url",
+        convertQuantizedMeshToBinary(quantizedMesh),
+        false,
+        Ellipsoid::WGS84,
+        true);
+    REQUIRE(result.model);
+
+    const MeshPrimitive& primitive = result.model->meshes[0].primitives[0];
+    AccessorView<float> offsets(
+        *result.model,
+        primitive.attributes.at("_PARENT_HEIGHT_OFFSET"));
+    AccessorView<glm::vec3> positions(
+        *result.model,
+        primitive.attributes.at("POSITION"));
+    REQUIRE(offsets.status() == AccessorViewStatus::Valid);
+    REQUIRE(offsets.size() == positions.size());
+    for (int64_t i = 0; i < offsets.size(); ++i) {
+      CHECK(std::abs(offsets[i]) < 0.01f);
+    }
+  }
+
+  SECTION("Detail finer than the parent is offset to its surface") {
+    QuantizedMesh<uint16_t> quantizedMesh =
+        createGridQuantizedMesh<uint16_t>(boundingVolume, 65, 65);
+
+    // A spike halfway between two of the parent's samples in each direction,
+    // on flat ground.
+    const size_t spike = 31 * 65 + 31;
+    std::vector<int32_t> heights(65 * 65, 0);
+    heights[spike] = 32767;
+    setHeights(quantizedMesh, heights);
+
+    QuantizedMeshLoadResult result = QuantizedMeshLoader::load(
+        tileID,
+        boundingVolume,
+        "url",
+        convertQuantizedMeshToBinary(quantizedMesh),
+        false,
+        Ellipsoid::WGS84,
+        true);
+    REQUIRE(result.model);
+
+    AccessorView<float> offsets(
+        *result.model,
+        result.model->meshes[0].primitives[0].attributes.at(
+            "_PARENT_HEIGHT_OFFSET"));
+    REQUIRE(offsets.status() == AccessorViewStatus::Valid);
+    // The parent's samples next to the spike touch its slopes slightly.
+    CHECK(std::abs(offsets[int64_t(spike)] + 100.0f) < 0.5f);
+    CHECK(std::abs(offsets[0]) < 0.01f);
+    CHECK(std::abs(offsets[int64_t(65 * 65 - 1)]) < 0.01f);
+  }
+
+  SECTION("The parent's surface follows the tile's vertex density") {
+    // The parent of a 17x17 tile has about 9x9 vertices over it, so a spike
+    // at an odd vertex falls between the parent's vertices.
+    QuantizedMesh<uint16_t> quantizedMesh =
+        createGridQuantizedMesh<uint16_t>(boundingVolume, 17, 17);
+
+    const size_t spike = 7 * 17 + 7;
+    std::vector<int32_t> heights(17 * 17, 0);
+    heights[spike] = 32767;
+    setHeights(quantizedMesh, heights);
+
+    QuantizedMeshLoadResult result = QuantizedMeshLoader::load(
+        tileID,
+        boundingVolume,
+        "url",
+        convertQuantizedMeshToBinary(quantizedMesh),
+        false,
+        Ellipsoid::WGS84,
+        true);
+    REQUIRE(result.model);
+
+    AccessorView<float> offsets(
+        *result.model,
+        result.model->meshes[0].primitives[0].attributes.at(
+            "_PARENT_HEIGHT_OFFSET"));
+    REQUIRE(offsets.status() == AccessorViewStatus::Valid);
+    CHECK(std::abs(offsets[int64_t(spike)] + 100.0f) < 0.5f);
+    CHECK(std::abs(offsets[0]) < 0.01f);
+  }
+}
+
+TEST_CASE("QuantizedMeshLoader::load throughput", "[.][benchmark]") {
+  CesiumGeometry::Rectangle rectangle(
+      glm::radians(-180.0),
+      glm::radians(-90.0),
+      glm::radians(180.0),
+      glm::radians(90.0));
+  QuadtreeTilingScheme tilingScheme(rectangle, 2, 1);
+
+  QuadtreeTileID tileID(10, 0, 0);
+  CesiumGeometry::Rectangle tileRectangle =
+      tilingScheme.tileToRectangle(tileID);
+  BoundingRegion boundingVolume(
+      GlobeRectangle(
+          tileRectangle.minimumX,
+          tileRectangle.minimumY,
+          tileRectangle.maximumX,
+          tileRectangle.maximumY),
+      0.0,
+      100.0,
+      Ellipsoid::WGS84);
+
+  const std::vector<std::byte> grid65 = convertQuantizedMeshToBinary(
+      createGridQuantizedMesh<uint16_t>(boundingVolume, 65, 65));
+  const std::vector<std::byte> grid129 = convertQuantizedMeshToBinary(
+      createGridQuantizedMesh<uint16_t>(boundingVolume, 129, 129));
+  const std::vector<std::byte> grid257 = convertQuantizedMeshToBinary(
+      createGridQuantizedMesh<uint32_t>(boundingVolume, 257, 257));
+
+  BENCHMARK("65x65 vertices") {
+    return QuantizedMeshLoader::load(
+        tileID,
+        boundingVolume,
+        "url",
+        grid65,
+        false);
+  };
+
+  BENCHMARK("129x129 vertices") {
+    return QuantizedMeshLoader::load(
+        tileID,
+        boundingVolume,
+        "url",
+        grid129,
+        false);
+  };
+
+  BENCHMARK("257x257 vertices") {
+    return QuantizedMeshLoader::load(
+        tileID,
+        boundingVolume,
+        "url",
+        grid257,
+        false);
+  };
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "Library.h"
+#include "RasterOverlay.h"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace CesiumRasterOverlays {
+
+/**
+ * @brief Options for {@link MBTilesRasterOverlay}.
+ */
+struct MBTilesRasterOverlayOptions {
+  /**
+   * @brief A credit for the data source, which is displayed on the canvas.
+   *
+   * If this is `std::nullopt`, the `attribution` in the package's metadata is
+   * used, if there is one.
+   */
+  std::optional<std::string> credit;
+
+  /**
+   * @brief The minimum level-of-detail supported by the package.
+   *
+   * If this is `std::nullopt`, the `minzoom` in the package's metadata is
+   * used, or the smallest level of any tile if there is no `minzoom`.
+   */
+  std::optional<uint32_t> minimumLevel;
+
+  /**
+   * @brief The maximum level-of-detail supported by the package.
+   *
+   * If this is `std::nullopt`, the `maxzoom` in the package's metadata is
+   * used, or the largest level of any tile if there is no `maxzoom`.
+   */
+  std::optional<uint32_t> maximumLevel;
+
+  /**
+   * @brief Pixel width of image tiles.
+   */
+  uint32_t tileWidth = 256;
+
+  /**
+   * @brief Pixel height of image tiles.
+   */
+  uint32_t tileHeight = 256;
+};
+
+/**
+ * @brief A {@link RasterOverlay} that reads imagery from a local
+ * [MBTiles](https://github.com/mapbox/mbtiles-spec) package.
+ *
+ * An MBTiles package is a SQLite database holding a Web Mercator tile pyramid
+ * in a single file, which makes it convenient for offline use and for
+ * shipping the imagery of frequently-viewed regions with an application.
+ * Each tile is read from the database with a single indexed lookup, without
+ * going through the {@link CesiumAsync::IAssetAccessor}.
+ *
+ * Tiles that are missing from the package are treated as unavailable, and
+ * the nearest ancestor tile that is present is shown instead. Only raster
+ * tile formats that can be decoded by the
+ * {@link CesiumGltfReader::ImageDecoder} are supported.
+ */
+class CESIUMRASTEROVERLAYS_API MBTilesRasterOverlay final
+    : public RasterOverlay {
+public:
+  /**
+   * @brief Creates a new instance.
+   *
+   * @param name The user-given name of this overlay layer.
+   * @param path The path of the MBTiles file on the local file system.
+   * @param mbtilesOptions The {@link MBTilesRasterOverlayOptions}.
+   * @param overlayOptions The {@link RasterOverlayOptions} for this instance.
+   */
+  MBTilesRasterOverlay(
+      const std::string& name,
+      const std::string& path,
+      const MBTilesRasterOverlayOptions& mbtilesOptions = {},
+      const RasterOverlayOptions& overlayOptions = {});
+  virtual ~MBTilesRasterOverlay() override;
+
+  virtual CesiumAsync::Future<CreateTileProviderResult> createTileProvider(
+      const CesiumAsync::AsyncSystem& asyncSystem,
+      const std::shared_ptr<CesiumAsync::IAssetAccessor>& pAssetAccessor,
+      const std::shared_ptr<CesiumUtility::CreditSystem>& pCreditSystem,
+      const std::shared_ptr<IPrepareRasterOverlayRendererResources>&
+          pPrepareRendererResources,
+      const std::shared_ptr<spdlog::logger>& pLogger,
+      CesiumUtility::IntrusivePointer<const RasterOverlay> pOwner)
+      const override;
+
+private:
+  std::string _path;
+  MBTilesRasterOverlayOptions _options;
+};
+
+} // namespace CesiumRasterOverlays
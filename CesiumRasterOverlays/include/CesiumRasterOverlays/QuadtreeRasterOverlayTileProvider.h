@@ -101,6 +101,10 @@ public:
    * @brief Computes the best quadtree level to use for an image intended to
    * cover a given projected rectangle when it is a given size on the screen.
    *
+   * When the ideal level is close to the midpoint between two levels, the
+   * level whose tiles are already loaded is preferred. See
+   * {@link RasterOverlayOptions::levelHysteresis}.
+   *
    * @param rectangle The range of projected coordinates to cover.
    * @param screenPixels The number of screen pixels to be covered by the
    * rectangle.
@@ -110,6 +114,25 @@ public:
       const CesiumGeometry::Rectangle& rectangle,
       const glm::dvec2& screenPixels);
 
+  /**
+   * @brief Gets the number of quadtree tile images that this instance has
+   * requested with {@link loadQuadtreeTileImage}.
+   *
+   * Tiles that are reused from the sub-tile cache are not counted.
+   */
+  uint64_t getTileImageRequestCount() const noexcept {
+    return this->_tileImageRequestCount;
+  }
+
+  /**
+   * @brief Gets the number of times that
+   * {@link computeLevelFromTargetScreenPixels} chose a level other than the
+   * nearest one in order to reuse tiles that were already loaded.
+   */
+  uint64_t getReusedLevelCount() const noexcept {
+    return this->_reusedLevelCount;
+  }
+
 protected:
   /**
    * @brief Asynchronously loads a tile in the quadtree.
@@ -147,6 +170,12 @@ private:
   CesiumAsync::SharedFuture<CesiumUtility::ResultPointer<LoadedQuadtreeImage>>
   getQuadtreeTile(const CesiumGeometry::QuadtreeTileID& tileID);
 
+  // Determines if every tile at the given level that overlaps the rectangle is
+  // in the tile depot, so that using the level requires no new requests.
+  bool isLevelInDepot(
+      const CesiumGeometry::Rectangle& rectangle,
+      uint32_t level) const;
+
   /**
    * @brief Map raster tiles to geometry tile.
    *
@@ -176,7 +205,9 @@ private:
       const std::vector<CesiumUtility::ResultPointer<LoadedQuadtreeImage>>&
           images);
 
-  static LoadedRasterOverlayImage combineImages(
+  static CesiumAsync::Future<LoadedRasterOverlayImage> combineImages(
+      const CesiumAsync::AsyncSystem& asyncSystem,
+      RasterOverlayImagePool& imagePool,
       const CesiumGeometry::Rectangle& targetRectangle,
       const CesiumGeospatial::Projection& projection,
       std::vector<CesiumUtility::ResultPointer<LoadedQuadtreeImage>>&& images);
@@ -186,6 +217,8 @@ private:
   uint32_t _imageWidth;
   uint32_t _imageHeight;
   CesiumGeometry::QuadtreeTilingScheme _tilingScheme;
+  uint64_t _tileImageRequestCount;
+  uint64_t _reusedLevelCount;
 
   CesiumUtility::IntrusivePointer<CesiumAsync::SharedAssetDepot<
       LoadedQuadtreeImage,
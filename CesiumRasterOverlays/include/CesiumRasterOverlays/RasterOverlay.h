@@ -14,10 +14,12 @@
 #include <spdlog/fwd.h>
 
 #include <any>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 namespace CesiumUtility {
 struct Credit;
@@ -27,6 +29,7 @@ class CreditSystem;
 namespace CesiumRasterOverlays {
 
 class IPrepareRasterOverlayRendererResources;
+class RasterOverlayImagePool;
 class RasterOverlayTileProvider;
 
 /**
@@ -75,12 +78,44 @@ struct CESIUMRASTEROVERLAYS_API RasterOverlayOptions {
    */
   double maximumScreenSpaceError = 2.0;
 
+  /**
+   * @brief How far, in quadtree levels, the ideal level-of-detail may be from
+   * the midpoint between two levels for either level to be used.
+   *
+   * A {@link QuadtreeRasterOverlayTileProvider} normally rounds the ideal
+   * level to the nearest integer. When the ideal level is within this distance
+   * of the midpoint between two levels, and the tiles of only the other level
+   * are already loaded, that level is used instead. This keeps geometry tiles
+   * whose ideal level is close to a boundary from requesting a new set of
+   * overlay tiles when imagery that is nearly as good is already available.
+   * A value such as 0.25 enables this. The default of 0.0 always uses the
+   * nearest level.
+   */
+  double levelHysteresis = 0.0;
+
   /**
    * @brief For each possible input transmission format, this struct names
    * the ideal target gpu-compressed pixel format to transcode to.
    */
   CesiumGltf::Ktx2TranscodeTargets ktx2TranscodeTargets;
 
+  /**
+   * @brief Whether to compress overlay images into a GPU block-compressed
+   * pixel format before they are passed to the renderer.
+   *
+   * When this is true, uncompressed overlay images are compressed in a worker
+   * thread into the {@link CesiumGltf::Ktx2TranscodeTargets::UASTC_RGBA}
+   * format of {@link ktx2TranscodeTargets}. Mipmaps are generated before
+   * compression, so including them, memory usage is reduced by a factor of
+   * about three for 8-bit-per-pixel formats such as BC7, and about six for
+   * 4-bit-per-pixel formats such as ETC1.
+   * Images are left uncompressed if that format is
+   * {@link CesiumGltf::GpuCompressedPixelFormat::NONE} or if compression
+   * fails. Compression takes considerably longer than loading, so this is
+   * best used when memory is more constrained than load time.
+   */
+  bool compressImages = false;
+
   /**
    * @brief A callback function that is invoked when a raster overlay resource
    * fails to load.
@@ -113,6 +148,17 @@ struct CESIUMRASTEROVERLAYS_API RasterOverlayOptions {
    * @brief The ellipsoid used for this raster overlay.
    */
   CesiumGeospatial::Ellipsoid ellipsoid = CesiumGeospatial::Ellipsoid::WGS84;
+
+  /**
+   * @brief The pool from which this overlay's images obtain their pixel
+   * buffers, and to which the buffers are returned when the images are no
+   * longer needed.
+   *
+   * If this is nullptr, {@link RasterOverlayImagePool::getDefault} is used,
+   * so that buffers are shared among all overlays. The default pool does not
+   * keep any buffers unless its capacity is raised.
+   */
+  std::shared_ptr<RasterOverlayImagePool> pImagePool;
 };
 
 /**
@@ -240,6 +286,81 @@ public:
       const std::shared_ptr<spdlog::logger>& pLogger,
       CesiumUtility::IntrusivePointer<const RasterOverlay> pOwner) const = 0;
 
+  /**
+   * @brief Gets a tile provider for this overlay that is shared by all callers
+   * that pass the same async system, asset accessor, and credit system,
+   * creating it with {@link createTileProvider} if necessary.
+   *
+   * This allows an overlay that is added to several
+   * {@link Cesium3DTilesSelection::RasterOverlayCollection} instances, such as
+   * those of a terrain tileset and a buildings tileset draped with the same
+   * imagery, to fetch, decode, and cache its tiles only once.
+   *
+   * The renderer resources interface and logger are not part of what is
+   * shared; the shared tile provider uses those of the caller that created
+   * it. If creating the tile provider fails, the next caller creates it again
+   * rather than receiving the same failure.
+   *
+   * Each call must be balanced by a call to
+   * {@link releaseSharedTileProvider} with the same parameters. The shared
+   * tile provider keeps this overlay alive until it has been released by all
+   * of its users. This method must be called from the main thread.
+   *
+   * @param asyncSystem The async system used to do work in threads.
+   * @param pAssetAccessor The interface used to download assets like overlay
+   * metadata and tiles.
+   * @param pCreditSystem The {@link CesiumUtility::CreditSystem} to use when
+   * creating a per-TileProvider {@link CesiumUtility::Credit}.
+   * @param pPrepareRendererResources The interface used to prepare raster
+   * images for rendering.
+   * @param pLogger The logger to which to send messages about the tile provider
+   * and tiles.
+   * @return The future that resolves to the tile provider when it is ready, or
+   * to error details in the case of an error.
+   */
+  CesiumAsync::SharedFuture<CreateTileProviderResult> getSharedTileProvider(
+      const CesiumAsync::AsyncSystem& asyncSystem,
+      const std::shared_ptr<CesiumAsync::IAssetAccessor>& pAssetAccessor,
+      const std::shared_ptr<CesiumUtility::CreditSystem>& pCreditSystem,
+      const std::shared_ptr<IPrepareRasterOverlayRendererResources>&
+          pPrepareRendererResources,
+      const std::shared_ptr<spdlog::logger>& pLogger);
+
+  /**
+   * @brief Releases a tile provider obtained from
+   * {@link getSharedTileProvider}.
+   *
+   * When the last user of a shared tile provider releases it, this overlay no
+   * longer refers to it. This method must be called from the main thread.
+   *
+   * @param asyncSystem The async system passed to getSharedTileProvider.
+   * @param pAssetAccessor The asset accessor passed to getSharedTileProvider.
+   * @param pCreditSystem The credit system passed to getSharedTileProvider.
+   */
+  void releaseSharedTileProvider(
+      const CesiumAsync::AsyncSystem& asyncSystem,
+      const std::shared_ptr<CesiumAsync::IAssetAccessor>& pAssetAccessor,
+      const std::shared_ptr<CesiumUtility::CreditSystem>&
+          pCreditSystem) noexcept;
+
+  /**
+   * @brief Gets the number of users of the tile provider obtained from
+   * {@link getSharedTileProvider} with the given parameters.
+   *
+   * This allows each user to count only its share of the tile provider's
+   * memory usage, so that it is not counted once per user.
+   *
+   * @param asyncSystem The async system passed to getSharedTileProvider.
+   * @param pAssetAccessor The asset accessor passed to getSharedTileProvider.
+   * @param pCreditSystem The credit system passed to getSharedTileProvider.
+   * @return The number of users, or 0 if there is no such tile provider.
+   */
+  int32_t getSharedTileProviderUsers(
+      const CesiumAsync::AsyncSystem& asyncSystem,
+      const std::shared_ptr<CesiumAsync::IAssetAccessor>& pAssetAccessor,
+      const std::shared_ptr<CesiumUtility::CreditSystem>& pCreditSystem)
+      const noexcept;
+
 private:
   struct DestructionCompleteDetails {
     CesiumAsync::AsyncSystem asyncSystem;
@@ -247,10 +368,34 @@ private:
     CesiumAsync::SharedFuture<void> future;
   };
 
+  struct SharedTileProvider {
+    CesiumAsync::AsyncSystem asyncSystem;
+    std::shared_ptr<CesiumAsync::IAssetAccessor> pAssetAccessor;
+    std::shared_ptr<CesiumUtility::CreditSystem> pCreditSystem;
+    CesiumAsync::SharedFuture<CreateTileProviderResult> future;
+    // Identifies the attempt to create the tile provider that `future` is for.
+    uint64_t attempt;
+    // Whether that attempt failed, so that the next user tries again.
+    bool failed;
+    int32_t users;
+  };
+
+  std::vector<SharedTileProvider>::iterator findSharedTileProvider(
+      const CesiumAsync::AsyncSystem& asyncSystem,
+      const std::shared_ptr<CesiumAsync::IAssetAccessor>& pAssetAccessor,
+      const std::shared_ptr<CesiumUtility::CreditSystem>&
+          pCreditSystem) noexcept;
+
+  void watchSharedTileProvider(
+      CesiumAsync::SharedFuture<CreateTileProviderResult> future,
+      uint64_t attempt);
+
   std::string _name;
   RasterOverlayOptions _options;
   std::vector<CesiumUtility::Credit> _credits;
   std::optional<DestructionCompleteDetails> _destructionCompleteDetails;
+  std::vector<SharedTileProvider> _sharedTileProviders;
+  uint64_t _nextSharedTileProviderAttempt = 0;
 };
 
 } // namespace CesiumRasterOverlays
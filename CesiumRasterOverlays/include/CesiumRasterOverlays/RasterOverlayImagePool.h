@@ -0,0 +1,113 @@
+#pragma once
+
+#include "Library.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace CesiumRasterOverlays {
+
+/**
+ * @brief A pool of pixel buffers for raster overlay images.
+ *
+ * Raster overlay tiles are created and destroyed continuously as the camera
+ * moves, and most of their images have one of a few common sizes. Instead of
+ * freeing the pixel buffer of an image that is no longer needed, it can be
+ * returned to this pool and reused for a later image of similar size.
+ *
+ * Buffers are grouped into power-of-two size classes. A buffer acquired from
+ * the pool always has a capacity of at least the size class of the requested
+ * size, so that it can be reused for any other request in the same class.
+ *
+ * All methods are thread-safe.
+ */
+class CESIUMRASTEROVERLAYS_API RasterOverlayImagePool final {
+public:
+  /**
+   * @brief Buffers smaller than this many bytes are not pooled.
+   */
+  static constexpr size_t MinimumPooledBufferBytes = 16 * 1024;
+
+  /**
+   * @brief Gets the pool shared by all raster overlays that do not specify
+   * their own with {@link RasterOverlayOptions::pImagePool}.
+   *
+   * The memory held by a pool is not included in the memory usage reported
+   * by tilesets, so this pool holds no buffers until its capacity is raised
+   * with {@link setMaximumPooledBytes}.
+   */
+  static const std::shared_ptr<RasterOverlayImagePool>& getDefault();
+
+  /**
+   * @brief Constructs a new instance.
+   *
+   * @param maximumPooledBytes The maximum total capacity, in bytes, of the
+   * buffers held by the pool. Buffers released while the pool is full are
+   * freed.
+   */
+  explicit RasterOverlayImagePool(
+      int64_t maximumPooledBytes = 64 * 1024 * 1024) noexcept;
+
+  /**
+   * @brief Gets a buffer with the given size, reusing a pooled buffer if one
+   * is available.
+   *
+   * @param byteSize The size of the buffer.
+   * @return The buffer. Its size is `byteSize` and every byte is zero.
+   */
+  std::vector<std::byte> acquire(size_t byteSize);
+
+  /**
+   * @brief Returns a buffer to the pool so that it can be reused.
+   *
+   * The buffer need not have been acquired from this pool. For example, a
+   * renderer may return the pixel data of an image after copying it to the
+   * GPU. Buffers that are too small to pool, or that do not fit within
+   * {@link getMaximumPooledBytes}, are freed.
+   *
+   * @param buffer The buffer. It is empty after this method returns.
+   */
+  void release(std::vector<std::byte>&& buffer);
+
+  /**
+   * @brief Gets the total capacity, in bytes, of the buffers currently held by
+   * the pool.
+   */
+  int64_t getPooledBytes() const;
+
+  /**
+   * @brief Gets the maximum total capacity, in bytes, of the buffers held by
+   * the pool.
+   */
+  int64_t getMaximumPooledBytes() const;
+
+  /**
+   * @brief Sets the maximum total capacity, in bytes, of the buffers held by
+   * the pool. If the pool currently holds more than this, buffers are freed
+   * until it does not.
+   */
+  void setMaximumPooledBytes(int64_t maximumPooledBytes);
+
+  /**
+   * @brief Frees all the buffers held by the pool.
+   */
+  void clear();
+
+private:
+  // Moves buffers into `freed` until the pool holds no more than
+  // `maximumPooledBytes`. The caller must hold the mutex.
+  void trim(
+      int64_t maximumPooledBytes,
+      std::vector<std::vector<std::byte>>& freed);
+
+  mutable std::mutex _mutex;
+  std::array<std::vector<std::vector<std::byte>>, 64> _freeBuffers;
+  int64_t _pooledBytes;
+  int64_t _maximumPooledBytes;
+};
+
+} // namespace CesiumRasterOverlays
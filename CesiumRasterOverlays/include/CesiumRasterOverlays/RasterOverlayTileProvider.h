@@ -14,11 +14,13 @@
 
 #include <spdlog/fwd.h>
 
+#include <memory>
 #include <optional>
 
 namespace CesiumRasterOverlays {
 
 class RasterOverlay;
+class RasterOverlayImagePool;
 class RasterOverlayTile;
 class IPrepareRasterOverlayRendererResources;
 
@@ -256,6 +258,26 @@ public:
     return this->_pLogger;
   }
 
+  /**
+   * @brief Gets the pool of pixel buffers used for this provider's images.
+   *
+   * This is {@link RasterOverlayOptions::pImagePool} of the owner, or
+   * {@link RasterOverlayImagePool::getDefault} if that is nullptr. Renderers
+   * may return the pixel data of an image to this pool once it has been
+   * copied to the GPU.
+   */
+  std::shared_ptr<RasterOverlayImagePool> getImagePool() const;
+
+  /**
+   * @brief Gets the GPU pixel format into which this provider compresses its
+   * images before passing them to the renderer.
+   *
+   * This is {@link CesiumGltf::GpuCompressedPixelFormat::NONE} unless
+   * {@link RasterOverlayOptions::compressImages} is enabled for the owner.
+   * Individual images may still be uncompressed if compression fails.
+   */
+  CesiumGltf::GpuCompressedPixelFormat getCompressedPixelFormat() const;
+
   /**
    * @brief Returns the {@link CesiumGeospatial::Projection} of this instance.
    */
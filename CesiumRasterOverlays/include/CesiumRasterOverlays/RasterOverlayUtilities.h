@@ -10,6 +10,7 @@
 #include <glm/fwd.hpp>
 
 #include <optional>
+#include <span>
 #include <string_view>
 #include <vector>
 
@@ -130,6 +131,42 @@ struct CESIUMRASTEROVERLAYS_API RasterOverlayUtilities {
       const CesiumGeospatial::Ellipsoid& ellipsoid =
           CesiumGeospatial::Ellipsoid::WGS84);
 
+  /**
+   * @brief Creates new glTF models for several quadtree children of the given
+   * parent model at once.
+   *
+   * This produces the same models as calling
+   * {@link upsampleGltfForRasterOverlays} once for each child, but work that
+   * does not depend on the child, such as determining which quadrants each of
+   * the parent's triangles overlaps, is only done once. It is usually used to
+   * create all four children of a tile together.
+   *
+   * @param parentModel The parent model to upsample.
+   * @param childIDs The quadtree tile IDs of the child models to create.
+   * @param hasInvertedVCoordinate True if the V texture coordinate has 0.0 as
+   * the Northern-most coordinate; False if the V texture coordinate has 0.0 as
+   * the Southern-most coordiante.
+   * @param textureCoordinateAttributeBaseName The base name of the attribute
+   * that holds the projected texture coordinates. The `textureCoordinateIndex`
+   * is appended to this name. Defaults to
+   * {@link DEFAULT_TEXTURE_COORDINATE_BASE_NAME}.
+   * @param textureCoordinateIndex The index of the texture coordinate set to
+   * use.
+   * @param ellipsoid The {@link CesiumGeospatial::Ellipsoid}.
+   * @return The upsampled models, in the same order as `childIDs`. An element
+   * is `std::nullopt` if that child contains no geometry.
+   */
+  static std::vector<std::optional<CesiumGltf::Model>>
+  upsampleGltfForRasterOverlayChildren(
+      const CesiumGltf::Model& parentModel,
+      const std::span<const CesiumGeometry::UpsampledQuadtreeNode>& childIDs,
+      bool hasInvertedVCoordinate = false,
+      const std::string_view& textureCoordinateAttributeBaseName =
+          DEFAULT_TEXTURE_COORDINATE_BASE_NAME,
+      int32_t textureCoordinateIndex = 0,
+      const CesiumGeospatial::Ellipsoid& ellipsoid =
+          CesiumGeospatial::Ellipsoid::WGS84);
+
   /**
    * @brief Computes the desired screen pixels for a raster overlay texture.
    *
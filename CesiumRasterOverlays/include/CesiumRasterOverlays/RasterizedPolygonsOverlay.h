@@ -6,6 +6,7 @@
 
 #include <CesiumAsync/AsyncSystem.h>
 #include <CesiumGeospatial/CartographicPolygon.h>
+#include <CesiumGeospatial/CartographicPolygonIndex.h>
 #include <CesiumGeospatial/Ellipsoid.h>
 #include <CesiumGeospatial/Projection.h>
 
@@ -65,7 +66,16 @@ public:
    */
   const std::vector<CesiumGeospatial::CartographicPolygon>&
   getPolygons() const noexcept {
-    return this->_polygons;
+    return this->_polygonIndex.getPolygons();
+  }
+
+  /**
+   * @brief Gets a spatial index over the polygons that are being rasterized to
+   * create this overlay.
+   */
+  const CesiumGeospatial::CartographicPolygonIndex&
+  getPolygonIndex() const noexcept {
+    return this->_polygonIndex;
   }
 
   /**
@@ -82,7 +92,7 @@ public:
   }
 
 private:
-  std::vector<CesiumGeospatial::CartographicPolygon> _polygons;
+  CesiumGeospatial::CartographicPolygonIndex _polygonIndex;
   bool _invertSelection;
   CesiumGeospatial::Ellipsoid _ellipsoid;
   CesiumGeospatial::Projection _projection;
@@ -0,0 +1,431 @@
+#include <CesiumAsync/SqliteHelper.h>
+#include <CesiumAsync/cesium-sqlite3.h>
+#include <CesiumGeometry/QuadtreeTilingScheme.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumGeospatial/WebMercatorProjection.h>
+#include <CesiumGltfReader/ImageDecoder.h>
+#include <CesiumRasterOverlays/MBTilesRasterOverlay.h>
+#include <CesiumRasterOverlays/QuadtreeRasterOverlayTileProvider.h>
+#include <CesiumRasterOverlays/RasterOverlayLoadFailureDetails.h>
+#include <CesiumRasterOverlays/RasterOverlayTile.h>
+#include <CesiumUtility/CreditSystem.h>
+#include <CesiumUtility/Tracing.h>
+
+#include <fmt/format.h>
+#include <glm/common.hpp>
+#include <spdlog/fwd.h>
+#include <sqlite3.h>
+
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+using namespace CesiumAsync;
+using namespace CesiumGltfReader;
+using namespace CesiumUtility;
+
+namespace CesiumRasterOverlays {
+
+namespace {
+
+// A read-only connection to an MBTiles package, shared by a tile provider and
+// the tile loads it has in flight.
+class MBTilesDatabase {
+public:
+  // Opens the package at the given path. Throws std::runtime_error if it
+  // cannot be opened or does not have a tiles table.
+  explicit MBTilesDatabase(const std::string& path) {
+    CESIUM_SQLITE(sqlite3*) pConnection = nullptr;
+    const int status = CESIUM_SQLITE(sqlite3_open_v2)(
+        path.c_str(),
+        &pConnection,
+        SQLITE_OPEN_READONLY,
+        nullptr);
+    this->_pConnection = SqliteConnectionPtr(pConnection);
+    if (status != SQLITE_OK) {
+      throw std::runtime_error(CESIUM_SQLITE(sqlite3_errstr)(status));
+    }
+
+    // The tiles table is indexed on these three columns, so this is a single
+    // indexed lookup.
+    this->_pGetTile = SqliteHelper::prepareStatement(
+        this->_pConnection,
+        "SELECT tile_data FROM tiles WHERE zoom_level = ? AND tile_column = ? "
+        "AND tile_row = ?");
+  }
+
+  std::optional<std::string> getMetadata(const std::string& name) {
+    SqliteStatementPtr pStatement;
+    try {
+      pStatement = SqliteHelper::prepareStatement(
+          this->_pConnection,
+          "SELECT value FROM metadata WHERE name = ?");
+    } catch (const std::runtime_error&) {
+      // The metadata table is required, but be lenient if it is missing.
+      return std::nullopt;
+    }
+
+    int status = CESIUM_SQLITE(sqlite3_bind_text)(
+        pStatement.get(),
+        1,
+        name.c_str(),
+        int(name.size()),
+        SQLITE_STATIC);
+    if (status != SQLITE_OK) {
+      return std::nullopt;
+    }
+
+    status = CESIUM_SQLITE(sqlite3_step)(pStatement.get());
+    if (status != SQLITE_ROW) {
+      return std::nullopt;
+    }
+
+    const unsigned char* pText =
+        CESIUM_SQLITE(sqlite3_column_text)(pStatement.get(), 0);
+    if (!pText) {
+      return std::nullopt;
+    }
+
+    return std::string(reinterpret_cast<const char*>(pText));
+  }
+
+  // Gets the smallest and largest levels of the tiles in the package.
+  std::optional<std::pair<uint32_t, uint32_t>> getLevelRange() {
+    SqliteStatementPtr pStatement = SqliteHelper::prepareStatement(
+        this->_pConnection,
+        "SELECT MIN(zoom_level), MAX(zoom_level) FROM tiles");
+
+    if (CESIUM_SQLITE(sqlite3_step)(pStatement.get()) != SQLITE_ROW ||
+        CESIUM_SQLITE(sqlite3_column_type)(pStatement.get(), 0) ==
+            SQLITE_NULL) {
+      return std::nullopt;
+    }
+
+    return std::make_pair(
+        uint32_t(CESIUM_SQLITE(sqlite3_column_int)(pStatement.get(), 0)),
+        uint32_t(CESIUM_SQLITE(sqlite3_column_int)(pStatement.get(), 1)));
+  }
+
+  // Reads the data of a tile into `data`. Returns false if the package does
+  // not contain the tile.
+  bool readTile(
+      const CesiumGeometry::QuadtreeTileID& tileID,
+      std::vector<std::byte>& data) {
+    CESIUM_TRACE("MBTilesDatabase::readTile");
+    std::lock_guard<std::mutex> lock(this->_mutex);
+
+    CESIUM_SQLITE(sqlite3_stmt*) pStatement = this->_pGetTile.get();
+    CESIUM_SQLITE(sqlite3_reset)(pStatement);
+    CESIUM_SQLITE(sqlite3_bind_int64)(pStatement, 1, tileID.level);
+    CESIUM_SQLITE(sqlite3_bind_int64)(pStatement, 2, tileID.x);
+    // MBTiles uses the TMS tiling scheme, which numbers rows from the south
+    // just like QuadtreeTilingScheme.
+    CESIUM_SQLITE(sqlite3_bind_int64)(pStatement, 3, tileID.y);
+
+    if (CESIUM_SQLITE(sqlite3_step)(pStatement) != SQLITE_ROW) {
+      return false;
+    }
+
+    const void* pBlob = CESIUM_SQLITE(sqlite3_column_blob)(pStatement, 0);
+    const int size = CESIUM_SQLITE(sqlite3_column_bytes)(pStatement, 0);
+    data.resize(size_t(size));
+    if (pBlob && size > 0) {
+      std::memcpy(data.data(), pBlob, data.size());
+    }
+
+    return true;
+  }
+
+private:
+  std::mutex _mutex;
+  SqliteConnectionPtr _pConnection;
+  SqliteStatementPtr _pGetTile;
+};
+
+std::optional<uint32_t> parseLevel(const std::optional<std::string>& text) {
+  if (!text) {
+    return std::nullopt;
+  }
+
+  uint32_t result = 0;
+  const char* pEnd = text->data() + text->size();
+  auto [ptr, ec] = std::from_chars(text->data(), pEnd, result);
+  if (ec != std::errc() || ptr != pEnd) {
+    return std::nullopt;
+  }
+
+  return result;
+}
+
+// Parses the "bounds" metadata, which is "west,south,east,north" in degrees.
+std::optional<CesiumGeospatial::GlobeRectangle>
+parseBounds(const std::optional<std::string>& text) {
+  if (!text) {
+    return std::nullopt;
+  }
+
+  double values[4];
+  size_t start = 0;
+  for (size_t i = 0; i < 4; ++i) {
+    const size_t end = i < 3 ? text->find(',', start) : text->size();
+    if (end == std::string::npos) {
+      return std::nullopt;
+    }
+
+    try {
+      values[i] = std::stod(text->substr(start, end - start));
+    } catch (const std::exception&) {
+      return std::nullopt;
+    }
+
+    start = end + 1;
+  }
+
+  return CesiumGeospatial::GlobeRectangle::fromDegrees(
+      values[0],
+      values[1],
+      values[2],
+      values[3]);
+}
+
+struct MBTilesMetadata {
+  std::optional<std::string> attribution;
+  uint32_t minimumLevel;
+  uint32_t maximumLevel;
+  std::optional<CesiumGeospatial::GlobeRectangle> bounds;
+};
+
+} // namespace
+
+class MBTilesTileProvider final : public QuadtreeRasterOverlayTileProvider {
+public:
+  MBTilesTileProvider(
+      const IntrusivePointer<const RasterOverlay>& pOwner,
+      const CesiumAsync::AsyncSystem& asyncSystem,
+      const std::shared_ptr<IAssetAccessor>& pAssetAccessor,
+      std::optional<Credit> credit,
+      const std::shared_ptr<IPrepareRasterOverlayRendererResources>&
+          pPrepareRendererResources,
+      const std::shared_ptr<spdlog::logger>& pLogger,
+      const CesiumGeospatial::Projection& projection,
+      const CesiumGeometry::QuadtreeTilingScheme& tilingScheme,
+      const CesiumGeometry::Rectangle& coverageRectangle,
+      uint32_t width,
+      uint32_t height,
+      uint32_t minimumLevel,
+      uint32_t maximumLevel,
+      const std::shared_ptr<MBTilesDatabase>& pDatabase)
+      : QuadtreeRasterOverlayTileProvider(
+            pOwner,
+            asyncSystem,
+            pAssetAccessor,
+            credit,
+            pPrepareRendererResources,
+            pLogger,
+            projection,
+            tilingScheme,
+            coverageRectangle,
+            minimumLevel,
+            maximumLevel,
+            width,
+            height),
+        _pDatabase(pDatabase) {}
+
+  virtual ~MBTilesTileProvider() {}
+
+protected:
+  virtual CesiumAsync::Future<LoadedRasterOverlayImage> loadQuadtreeTileImage(
+      const CesiumGeometry::QuadtreeTileID& tileID) const override {
+    return this->getAsyncSystem().runInWorkerThread(
+        [pDatabase = this->_pDatabase,
+         tileID,
+         rectangle = this->getTilingScheme().tileToRectangle(tileID),
+         moreDetailAvailable = tileID.level < this->getMaximumLevel(),
+         ktx2TranscodeTargets =
+             this->getOwner().getOptions().ktx2TranscodeTargets]() {
+          std::vector<std::byte> data;
+          if (!pDatabase->readTile(tileID, data) || data.empty()) {
+            // A missing tile is not an error. The package simply doesn't have
+            // imagery this detailed here, so the parent tile is used instead.
+            return LoadedRasterOverlayImage{
+                new CesiumGltf::ImageAsset(),
+                rectangle,
+                {},
+                {},
+                moreDetailAvailable};
+          }
+
+          ImageReaderResult loadedImage =
+              ImageDecoder::readImage(data, ktx2TranscodeTargets);
+
+          if (!loadedImage.errors.empty()) {
+            loadedImage.errors.push_back(fmt::format(
+                "MBTiles tile: level {}, column {}, row {}",
+                tileID.level,
+                tileID.x,
+                tileID.y));
+          }
+
+          return LoadedRasterOverlayImage{
+              loadedImage.pImage,
+              rectangle,
+              {},
+              ErrorList{
+                  std::move(loadedImage.errors),
+                  std::move(loadedImage.warnings)},
+              moreDetailAvailable};
+        });
+  }
+
+private:
+  std::shared_ptr<MBTilesDatabase> _pDatabase;
+};
+
+MBTilesRasterOverlay::MBTilesRasterOverlay(
+    const std::string& name,
+    const std::string& path,
+    const MBTilesRasterOverlayOptions& mbtilesOptions,
+    const RasterOverlayOptions& overlayOptions)
+    : RasterOverlay(name, overlayOptions),
+      _path(path),
+      _options(mbtilesOptions) {}
+
+MBTilesRasterOverlay::~MBTilesRasterOverlay() = default;
+
+Future<RasterOverlay::CreateTileProviderResult>
+MBTilesRasterOverlay::createTileProvider(
+    const CesiumAsync::AsyncSystem& asyncSystem,
+    const std::shared_ptr<CesiumAsync::IAssetAccessor>& pAssetAccessor,
+    const std::shared_ptr<CreditSystem>& pCreditSystem,
+    const std::shared_ptr<IPrepareRasterOverlayRendererResources>&
+        pPrepareRendererResources,
+    const std::shared_ptr<spdlog::logger>& pLogger,
+    CesiumUtility::IntrusivePointer<const RasterOverlay> pOwner) const {
+  pOwner = pOwner ? pOwner : this;
+
+  using OpenResult = nonstd::expected<
+      std::pair<std::shared_ptr<MBTilesDatabase>, MBTilesMetadata>,
+      std::string>;
+
+  return asyncSystem
+      .runInWorkerThread([path = this->_path,
+                          options = this->_options]() -> OpenResult {
+        CESIUM_TRACE("MBTilesRasterOverlay open package");
+        try {
+          std::shared_ptr<MBTilesDatabase> pDatabase =
+              std::make_shared<MBTilesDatabase>(path);
+
+          MBTilesMetadata metadata;
+          metadata.attribution = pDatabase->getMetadata("attribution");
+          metadata.bounds = parseBounds(pDatabase->getMetadata("bounds"));
+
+          std::optional<uint32_t> minimumLevel = options.minimumLevel;
+          if (!minimumLevel) {
+            minimumLevel = parseLevel(pDatabase->getMetadata("minzoom"));
+          }
+
+          std::optional<uint32_t> maximumLevel = options.maximumLevel;
+          if (!maximumLevel) {
+            maximumLevel = parseLevel(pDatabase->getMetadata("maxzoom"));
+          }
+
+          if (!minimumLevel || !maximumLevel) {
+            std::optional<std::pair<uint32_t, uint32_t>> levels =
+                pDatabase->getLevelRange();
+            if (!levels) {
+              return nonstd::make_unexpected(
+                  std::string("The package does not contain any tiles."));
+            }
+            minimumLevel = minimumLevel.value_or(levels->first);
+            maximumLevel = maximumLevel.value_or(levels->second);
+          }
+
+          metadata.minimumLevel = glm::min(*minimumLevel, *maximumLevel);
+          metadata.maximumLevel = *maximumLevel;
+
+          const std::optional<std::string> format =
+              pDatabase->getMetadata("format");
+          if (format && *format == "pbf") {
+            return nonstd::make_unexpected(
+                std::string("Vector tile packages are not supported."));
+          }
+
+          return std::make_pair(std::move(pDatabase), std::move(metadata));
+        } catch (const std::exception& e) {
+          return nonstd::make_unexpected(std::string(e.what()));
+        }
+      })
+      .thenInMainThread(
+          [pOwner,
+           asyncSystem,
+           pAssetAccessor,
+           pCreditSystem,
+           pPrepareRendererResources,
+           pLogger,
+           path = this->_path,
+           options = this->_options](
+              OpenResult&& openResult) -> CreateTileProviderResult {
+            if (!openResult) {
+              return nonstd::make_unexpected(RasterOverlayLoadFailureDetails{
+                  RasterOverlayLoadType::TileProvider,
+                  nullptr,
+                  fmt::format(
+                      "Failed to open MBTiles package {}: {}",
+                      path,
+                      openResult.error())});
+            }
+
+            auto& [pDatabase, metadata] = *openResult;
+
+            std::optional<Credit> credit = std::nullopt;
+            const std::optional<std::string>& creditText =
+                options.credit ? options.credit : metadata.attribution;
+            if (pCreditSystem && creditText) {
+              credit = pCreditSystem->createCredit(
+                  *creditText,
+                  pOwner->getOptions().showCreditsOnScreen);
+            }
+
+            const CesiumGeospatial::Ellipsoid& ellipsoid =
+                pOwner->getOptions().ellipsoid;
+            const CesiumGeospatial::Projection projection =
+                CesiumGeospatial::WebMercatorProjection(ellipsoid);
+            const CesiumGeometry::QuadtreeTilingScheme tilingScheme(
+                projectRectangleSimple(
+                    projection,
+                    CesiumGeospatial::WebMercatorProjection::
+                        MAXIMUM_GLOBE_RECTANGLE),
+                1,
+                1);
+
+            const CesiumGeometry::Rectangle coverageRectangle =
+                projectRectangleSimple(
+                    projection,
+                    metadata.bounds.value_or(
+                        CesiumGeospatial::WebMercatorProjection::
+                            MAXIMUM_GLOBE_RECTANGLE));
+
+            return new MBTilesTileProvider(
+                pOwner,
+                asyncSystem,
+                pAssetAccessor,
+                credit,
+                pPrepareRendererResources,
+                pLogger,
+                projection,
+                tilingScheme,
+                coverageRectangle,
+                options.tileWidth,
+                options.tileHeight,
+                metadata.minimumLevel,
+                metadata.maximumLevel,
+                pDatabase);
+          });
+}
+
+} // namespace CesiumRasterOverlays
@@ -2,10 +2,15 @@
 #include <CesiumGltfContent/ImageManipulation.h>
 #include <CesiumRasterOverlays/QuadtreeRasterOverlayTileProvider.h>
 #include <CesiumRasterOverlays/RasterOverlay.h>
+#include <CesiumRasterOverlays/RasterOverlayImagePool.h>
 #include <CesiumRasterOverlays/RasterOverlayTile.h>
 #include <CesiumUtility/Math.h>
 #include <CesiumUtility/SpanHelper.h>
 
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 using namespace CesiumAsync;
 using namespace CesiumGeometry;
 using namespace CesiumGeospatial;
@@ -52,7 +57,9 @@ QuadtreeRasterOverlayTileProvider::QuadtreeRasterOverlayTileProvider(
       _maximumLevel(maximumLevel),
       _imageWidth(imageWidth),
       _imageHeight(imageHeight),
-      _tilingScheme(tilingScheme) {
+      _tilingScheme(tilingScheme),
+      _tileImageRequestCount(0),
+      _reusedLevelCount(0) {
   auto loadParentTile = [this](const QuadtreeTileID& key)
       -> Future<ResultPointer<LoadedQuadtreeImage>> {
     const Rectangle rectangle = this->getTilingScheme().tileToRectangle(key);
@@ -75,6 +82,7 @@ QuadtreeRasterOverlayTileProvider::QuadtreeRasterOverlayTileProvider(
               pAssetAccessor,
           const QuadtreeTileID& key)
           -> Future<ResultPointer<LoadedQuadtreeImage>> {
+        ++pThis->_tileImageRequestCount;
         return pThis->loadQuadtreeTileImage(key)
             .catchImmediately([](std::exception&& e) {
               // Turn an exception into an error.
@@ -158,23 +166,75 @@ uint32_t QuadtreeRasterOverlayTileProvider::computeLevelFromTargetScreenPixels(
   const glm::dvec2 twoToTheLevelPower =
       totalTileDimensions / targetTileDimensions;
   const glm::dvec2 level = glm::log2(twoToTheLevelPower);
-  const glm::dvec2 rounded = glm::max(glm::round(level), 0.0);
-
-  uint32_t imageryLevel = uint32_t(glm::max(rounded.x, rounded.y));
+  const double idealLevel = glm::max(level.x, level.y);
 
+  const uint32_t minimumLevel = this->getMinimumLevel();
   const uint32_t maximumLevel = this->getMaximumLevel();
-  if (imageryLevel > maximumLevel) {
-    imageryLevel = maximumLevel;
-  }
+  auto clampLevel = [minimumLevel, maximumLevel](double value) {
+    const uint32_t result = uint32_t(glm::max(value, 0.0));
+    return std::max(std::min(result, maximumLevel), minimumLevel);
+  };
 
-  const uint32_t minimumLevel = this->getMinimumLevel();
-  if (imageryLevel < minimumLevel) {
-    imageryLevel = minimumLevel;
+  const uint32_t imageryLevel = clampLevel(glm::round(idealLevel));
+
+  // Near the midpoint between two levels, either level is nearly as good. If
+  // only the other level's tiles are already loaded, use them
+  // rather than requesting new ones. This keeps neighboring geometry tiles
+  // that straddle a level boundary from loading two sets of overlay tiles.
+  const double hysteresis = this->getOwner().getOptions().levelHysteresis;
+  const double fraction = idealLevel - glm::floor(idealLevel);
+  if (hysteresis > 0.0 && glm::abs(fraction - 0.5) < hysteresis) {
+    const uint32_t otherLevel = clampLevel(
+        fraction >= 0.5 ? glm::floor(idealLevel) : glm::ceil(idealLevel));
+    if (otherLevel != imageryLevel &&
+        !this->isLevelInDepot(rectangle, imageryLevel) &&
+        this->isLevelInDepot(rectangle, otherLevel)) {
+      ++this->_reusedLevelCount;
+      return otherLevel;
+    }
   }
 
   return imageryLevel;
 }
 
+bool QuadtreeRasterOverlayTileProvider::isLevelInDepot(
+    const CesiumGeometry::Rectangle& rectangle,
+    uint32_t level) const {
+  // Checking a large number of tiles costs more than it's likely to save.
+  constexpr uint32_t maximumTilesToCheck = 16;
+
+  std::optional<CesiumGeometry::Rectangle> maybeIntersection =
+      rectangle.computeIntersection(this->getCoverageRectangle());
+  if (!maybeIntersection) {
+    return false;
+  }
+
+  const QuadtreeTilingScheme& tilingScheme = this->getTilingScheme();
+  std::optional<QuadtreeTileID> maybeSouthwest =
+      tilingScheme.positionToTile(maybeIntersection->getLowerLeft(), level);
+  std::optional<QuadtreeTileID> maybeNortheast =
+      tilingScheme.positionToTile(maybeIntersection->getUpperRight(), level);
+  if (!maybeSouthwest || !maybeNortheast) {
+    return false;
+  }
+
+  const uint32_t tilesX = maybeNortheast->x - maybeSouthwest->x + 1;
+  const uint32_t tilesY = maybeNortheast->y - maybeSouthwest->y + 1;
+  if (tilesX * tilesY > maximumTilesToCheck) {
+    return false;
+  }
+
+  for (uint32_t y = maybeSouthwest->y; y <= maybeNortheast->y; ++y) {
+    for (uint32_t x = maybeSouthwest->x; x <= maybeNortheast->x; ++x) {
+      if (!this->_pTileDepot->isLoaded(QuadtreeTileID(level, x, y))) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
 std::vector<CesiumAsync::SharedFuture<
     ResultPointer<QuadtreeRasterOverlayTileProvider::LoadedQuadtreeImage>>>
 QuadtreeRasterOverlayTileProvider::mapRasterTilesToGeometryTile(
@@ -404,12 +464,24 @@ PixelRectangle computePixelRectangle(
   return PixelRectangle{x, y, maxX - x, maxY - y};
 }
 
-// Copy part of a source image to part of a target image.
+// A copy of part of a source image to part of a target image.
+struct BlitOperation {
+  const ImageAsset* pSource;
+  PixelRectangle targetPixels;
+  PixelRectangle sourcePixels;
+
+  bool isScaled() const noexcept {
+    return targetPixels.width != sourcePixels.width ||
+           targetPixels.height != sourcePixels.height;
+  }
+};
+
+// Determines the part of a source image to copy to part of a target image.
 // The two rectangles are the extents of each image, and the part of the
 // source image where the source subset rectangle overlaps the target
 // rectangle is copied to the target image.
-void blitImage(
-    ImageAsset& target,
+std::optional<BlitOperation> planBlit(
+    const ImageAsset& target,
     const Rectangle& targetRectangle,
     const ImageAsset& source,
     const Rectangle& sourceRectangle,
@@ -419,17 +491,82 @@ void blitImage(
       targetRectangle.computeIntersection(sourceToCopy);
   if (!overlap) {
     // No overlap, nothing to do.
+    return std::nullopt;
+  }
+
+  return BlitOperation{
+      &source,
+      computePixelRectangle(target, targetRectangle, *overlap),
+      computePixelRectangle(source, sourceRectangle, *overlap)};
+}
+
+// Performs the part of an unscaled blit that lands in target rows
+// [beginRow, endRow). Scaled blits must be performed in full, because the
+// resampling filter reads source pixels beyond the rows it writes.
+void blitRows(
+    ImageAsset& target,
+    const BlitOperation& blit,
+    int32_t beginRow,
+    int32_t endRow) {
+  if (blit.isScaled()) {
+    ImageManipulation::blitImage(
+        target,
+        blit.targetPixels,
+        *blit.pSource,
+        blit.sourcePixels);
     return;
   }
 
-  const PixelRectangle targetPixels =
-      computePixelRectangle(target, targetRectangle, *overlap);
-  const PixelRectangle sourcePixels =
-      computePixelRectangle(source, sourceRectangle, *overlap);
+  const int32_t firstRow = glm::max(beginRow, blit.targetPixels.y);
+  const int32_t lastRow = glm::min(
+      endRow,
+      blit.targetPixels.y + blit.targetPixels.height);
+  if (firstRow >= lastRow) {
+    return;
+  }
 
-  ImageManipulation::blitImage(target, targetPixels, source, sourcePixels);
+  const int32_t rowOffset = firstRow - blit.targetPixels.y;
+  const int32_t rowCount = lastRow - firstRow;
+  ImageManipulation::blitImage(
+      target,
+      PixelRectangle{
+          blit.targetPixels.x,
+          firstRow,
+          blit.targetPixels.width,
+          rowCount},
+      *blit.pSource,
+      PixelRectangle{
+          blit.sourcePixels.x,
+          blit.sourcePixels.y + rowOffset,
+          blit.sourcePixels.width,
+          rowCount});
 }
 
+// Highlight the edges in yellow to show tile boundaries.
+void highlightTileBoundaries([[maybe_unused]] ImageAsset& image) {
+#if SHOW_TILE_BOUNDARIES
+  std::span<uint32_t> pixels =
+      reintepretCastSpan<uint32_t, std::byte>(image.pixelData);
+  for (int32_t j = 0; j < image.height; ++j) {
+    for (int32_t i = 0; i < image.width; ++i) {
+      if (i == 0 || j == 0 || i == image.width - 1 || j == image.height - 1) {
+        pixels[j * image.width + i] = 0xFF00FFFF;
+      }
+    }
+  }
+#endif
+}
+
+// Composites smaller than this many pixels are not worth splitting across
+// worker threads.
+constexpr int64_t minimumPixelsForParallelComposite = 1024 * 1024;
+
+// The fewest target rows that a single compositing task will fill.
+constexpr int32_t minimumRowsPerCompositeTask = 256;
+
+// The most compositing tasks a single combined image is split into.
+constexpr int32_t maximumCompositeTasks = 8;
+
 } // namespace
 
 CesiumAsync::Future<LoadedRasterOverlayImage>
@@ -445,7 +582,9 @@ QuadtreeRasterOverlayTileProvider::loadTileImage(
   return this->getAsyncSystem()
       .all(std::move(tiles))
       .thenInWorkerThread(
-          [projection = this->getProjection(),
+          [asyncSystem = this->getAsyncSystem(),
+           pImagePool = this->getImagePool(),
+           projection = this->getProjection(),
            rectangle = overlayTile.getRectangle()](
               std::vector<ResultPointer<LoadedQuadtreeImage>>&& images) {
             // This set of images is only "useful" if at least one actually has
@@ -472,15 +611,17 @@ QuadtreeRasterOverlayTileProvider::loadTileImage(
                 }
                 errors.merge(image.errors);
               }
-              return LoadedRasterOverlayImage{
+              return asyncSystem.createResolvedFuture(LoadedRasterOverlayImage{
                   new ImageAsset(),
                   Rectangle(),
                   {},
                   std::move(errors),
-                  false};
+                  false});
             }
 
             return QuadtreeRasterOverlayTileProvider::combineImages(
+                asyncSystem,
+                *pImagePool,
                 rectangle,
                 projection,
                 std::move(images));
@@ -609,8 +750,10 @@ QuadtreeRasterOverlayTileProvider::measureCombinedImage(
       bytesPerChannel};
 }
 
-/*static*/ LoadedRasterOverlayImage
+/*static*/ CesiumAsync::Future<LoadedRasterOverlayImage>
 QuadtreeRasterOverlayTileProvider::combineImages(
+    const AsyncSystem& asyncSystem,
+    RasterOverlayImagePool& imagePool,
     const Rectangle& targetRectangle,
     const Projection& /* projection */,
     std::vector<ResultPointer<LoadedQuadtreeImage>>&& images) {
@@ -632,16 +775,25 @@ QuadtreeRasterOverlayTileProvider::combineImages(
       measurements.channels * measurements.bytesPerChannel;
   if (targetImageBytes <= 0) {
     // Target image has no pixels, so our work here is done.
-    return LoadedRasterOverlayImage{
+    return asyncSystem.createResolvedFuture(LoadedRasterOverlayImage{
         nullptr,
         targetRectangle,
         {},
         std::move(errors),
         true // TODO
-    };
+    });
   }
 
-  LoadedRasterOverlayImage result;
+  struct CompositeState {
+    std::vector<ResultPointer<LoadedQuadtreeImage>> images;
+    std::vector<BlitOperation> blits;
+    LoadedRasterOverlayImage result;
+  };
+
+  auto pState = std::make_shared<CompositeState>();
+  pState->images = std::move(images);
+
+  LoadedRasterOverlayImage& result = pState->result;
   result.rectangle = measurements.rectangle;
   result.moreDetailAvailable = false;
   result.errorList = std::move(errors);
@@ -651,10 +803,12 @@ QuadtreeRasterOverlayTileProvider::combineImages(
   target.channels = measurements.channels;
   target.width = measurements.widthPixels;
   target.height = measurements.heightPixels;
-  target.pixelData.resize(size_t(
+  target.pixelData = imagePool.acquire(size_t(
       target.width * target.height * target.channels * target.bytesPerChannel));
 
-  for (auto it = images.begin(); it != images.end(); ++it) {
+  size_t combinedCreditsCount = 0;
+  pState->blits.reserve(pState->images.size());
+  for (auto it = pState->images.begin(); it != pState->images.end(); ++it) {
     if (!it->pValue) {
       continue;
     }
@@ -669,29 +823,21 @@ QuadtreeRasterOverlayTileProvider::combineImages(
       result.moreDetailAvailable |= loaded.moreDetailAvailable;
     }
 
-    blitImage(
+    std::optional<BlitOperation> maybeBlit = planBlit(
         target,
         result.rectangle,
         *loaded.pImage,
         loaded.rectangle,
         it->pValue->subset);
-  }
-
-  size_t combinedCreditsCount = 0;
-  for (auto it = images.begin(); it != images.end(); ++it) {
-    if (!it->pValue) {
-      continue;
-    }
-    const LoadedRasterOverlayImage& loaded = *it->pValue->pLoaded;
-    if (!loaded.pImage) {
-      continue;
+    if (maybeBlit) {
+      pState->blits.emplace_back(*maybeBlit);
     }
 
     combinedCreditsCount += loaded.credits.size();
   }
 
   result.credits.reserve(combinedCreditsCount);
-  for (auto it = images.begin(); it != images.end(); ++it) {
+  for (auto it = pState->images.begin(); it != pState->images.end(); ++it) {
     if (!it->pValue) {
       continue;
     }
@@ -705,21 +851,52 @@ QuadtreeRasterOverlayTileProvider::combineImages(
     }
   }
 
-  // Highlight the edges in yellow to show tile boundaries.
-#if SHOW_TILE_BOUNDARIES
-  std::span<uint32_t> pixels =
-      reintepretCastSpan<uint32_t, std::byte>(result.pImage->pixelData);
-  for (int32_t j = 0; j < result.pImage->height; ++j) {
-    for (int32_t i = 0; i < result.pImage->width; ++i) {
-      if (i == 0 || j == 0 || i == result.pImage->width - 1 ||
-          j == result.pImage->height - 1) {
-        pixels[j * result.pImage->width + i] = 0xFF00FFFF;
-      }
+  // Large composites made only of unscaled copies are split into bands of
+  // rows, each filled by a separate worker thread. Every band applies the
+  // blits in the same order, so the result is identical to a serial
+  // composite.
+  int32_t taskCount = 1;
+  const bool anyScaled = std::any_of(
+      pState->blits.begin(),
+      pState->blits.end(),
+      [](const BlitOperation& blit) { return blit.isScaled(); });
+  if (!anyScaled && int64_t(target.width) * int64_t(target.height) >=
+                        minimumPixelsForParallelComposite) {
+    taskCount = glm::clamp(
+        target.height / minimumRowsPerCompositeTask,
+        1,
+        maximumCompositeTasks);
+  }
+
+  if (taskCount <= 1) {
+    for (const BlitOperation& blit : pState->blits) {
+      blitRows(target, blit, 0, target.height);
     }
+
+    highlightTileBoundaries(target);
+    return asyncSystem.createResolvedFuture(std::move(result));
   }
-#endif
 
-  return result;
+  const int32_t rowsPerTask = (target.height + taskCount - 1) / taskCount;
+
+  std::vector<Future<void>> tasks;
+  tasks.reserve(size_t(taskCount));
+  for (int32_t i = 0; i < taskCount; ++i) {
+    const int32_t beginRow = i * rowsPerTask;
+    const int32_t endRow = glm::min(beginRow + rowsPerTask, target.height);
+    tasks.emplace_back(
+        asyncSystem.runInWorkerThread([pState, beginRow, endRow]() {
+          ImageAsset& image = *pState->result.pImage;
+          for (const BlitOperation& blit : pState->blits) {
+            blitRows(image, blit, beginRow, endRow);
+          }
+        }));
+  }
+
+  return asyncSystem.all(std::move(tasks)).thenImmediately([pState]() {
+    highlightTileBoundaries(*pState->result.pImage);
+    return std::move(pState->result);
+  });
 }
 
 } // namespace CesiumRasterOverlays
@@ -5,6 +5,12 @@
 
 #include <spdlog/fwd.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <vector>
+
 using namespace CesiumAsync;
 using namespace CesiumRasterOverlays;
 using namespace CesiumUtility;
@@ -34,7 +40,10 @@ public:
 RasterOverlay::RasterOverlay(
     const std::string& name,
     const RasterOverlayOptions& options)
-    : _name(name), _options(options), _destructionCompleteDetails{} {}
+    : _name(name),
+      _options(options),
+      _destructionCompleteDetails{},
+      _sharedTileProviders{} {}
 
 RasterOverlay::~RasterOverlay() noexcept {
   if (this->_destructionCompleteDetails.has_value()) {
@@ -73,3 +82,132 @@ RasterOverlay::createPlaceholder(
       pAssetAccessor,
       ellipsoid);
 }
+
+CesiumAsync::SharedFuture<RasterOverlay::CreateTileProviderResult>
+RasterOverlay::getSharedTileProvider(
+    const CesiumAsync::AsyncSystem& asyncSystem,
+    const std::shared_ptr<CesiumAsync::IAssetAccessor>& pAssetAccessor,
+    const std::shared_ptr<CesiumUtility::CreditSystem>& pCreditSystem,
+    const std::shared_ptr<IPrepareRasterOverlayRendererResources>&
+        pPrepareRendererResources,
+    const std::shared_ptr<spdlog::logger>& pLogger) {
+  auto it =
+      this->findSharedTileProvider(asyncSystem, pAssetAccessor, pCreditSystem);
+  if (it != this->_sharedTileProviders.end() && !it->failed) {
+    ++it->users;
+    return it->future;
+  }
+
+  // Create the tile provider, or try again rather than handing out one that
+  // failed to be created.
+  const uint64_t attempt = ++this->_nextSharedTileProviderAttempt;
+  CesiumAsync::SharedFuture<CreateTileProviderResult> future =
+      this->createTileProvider(
+              asyncSystem,
+              pAssetAccessor,
+              pCreditSystem,
+              pPrepareRendererResources,
+              pLogger,
+              nullptr)
+          .share();
+
+  if (it == this->_sharedTileProviders.end()) {
+    this->_sharedTileProviders.emplace_back(SharedTileProvider{
+        asyncSystem,
+        pAssetAccessor,
+        pCreditSystem,
+        future,
+        attempt,
+        false,
+        1});
+  } else {
+    it->future = future;
+    it->attempt = attempt;
+    it->failed = false;
+    ++it->users;
+  }
+
+  this->watchSharedTileProvider(future, attempt);
+
+  return future;
+}
+
+void RasterOverlay::releaseSharedTileProvider(
+    const CesiumAsync::AsyncSystem& asyncSystem,
+    const std::shared_ptr<CesiumAsync::IAssetAccessor>& pAssetAccessor,
+    const std::shared_ptr<CesiumUtility::CreditSystem>&
+        pCreditSystem) noexcept {
+  auto it =
+      this->findSharedTileProvider(asyncSystem, pAssetAccessor, pCreditSystem);
+  CESIUM_ASSERT(it != this->_sharedTileProviders.end());
+  if (it == this->_sharedTileProviders.end()) {
+    return;
+  }
+
+  // The tile provider refers back to this overlay, so it must be dropped when
+  // it's no longer used in order for either of them to be destroyed.
+  --it->users;
+  if (it->users <= 0) {
+    this->_sharedTileProviders.erase(it);
+  }
+}
+
+int32_t RasterOverlay::getSharedTileProviderUsers(
+    const CesiumAsync::AsyncSystem& asyncSystem,
+    const std::shared_ptr<CesiumAsync::IAssetAccessor>& pAssetAccessor,
+    const std::shared_ptr<CesiumUtility::CreditSystem>& pCreditSystem)
+    const noexcept {
+  for (const SharedTileProvider& shared : this->_sharedTileProviders) {
+    if (shared.asyncSystem == asyncSystem &&
+        shared.pAssetAccessor == pAssetAccessor &&
+        shared.pCreditSystem == pCreditSystem) {
+      return shared.users;
+    }
+  }
+
+  return 0;
+}
+
+std::vector<RasterOverlay::SharedTileProvider>::iterator
+RasterOverlay::findSharedTileProvider(
+    const CesiumAsync::AsyncSystem& asyncSystem,
+    const std::shared_ptr<CesiumAsync::IAssetAccessor>& pAssetAccessor,
+    const std::shared_ptr<CesiumUtility::CreditSystem>&
+        pCreditSystem) noexcept {
+  return std::find_if(
+      this->_sharedTileProviders.begin(),
+      this->_sharedTileProviders.end(),
+      [&](const SharedTileProvider& shared) {
+        return shared.asyncSystem == asyncSystem &&
+               shared.pAssetAccessor == pAssetAccessor &&
+               shared.pCreditSystem == pCreditSystem;
+      });
+}
+
+void RasterOverlay::watchSharedTileProvider(
+    CesiumAsync::SharedFuture<CreateTileProviderResult> future,
+    uint64_t attempt) {
+  // Once this attempt fails, the next user should try again. The entry is
+  // found again by its attempt, because it may have been released and even
+  // replaced by then.
+  auto markFailed = [pThis = IntrusivePointer<RasterOverlay>(this),
+                     attempt]() noexcept {
+    for (SharedTileProvider& candidate : pThis->_sharedTileProviders) {
+      if (candidate.attempt == attempt) {
+        candidate.failed = true;
+      }
+    }
+  };
+
+  future
+      .thenInMainThread(
+          [markFailed](const CreateTileProviderResult& result) noexcept {
+            if (!result) {
+              markFailed();
+            }
+          })
+      .catchInMainThread(
+          [markFailed](const std::exception& /* e */) noexcept {
+            markFailed();
+          });
+}
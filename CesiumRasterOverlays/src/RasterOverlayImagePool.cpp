@@ -0,0 +1,137 @@
+#include <CesiumRasterOverlays/RasterOverlayImagePool.h>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace CesiumRasterOverlays {
+
+namespace {
+
+// The size class of a request for this many bytes: the smallest power of two
+// that is greater than or equal to it.
+size_t sizeClassForRequest(size_t byteSize) {
+  return size_t(std::bit_width(byteSize - 1));
+}
+
+// The size class that a buffer with this capacity can serve: the largest
+// power of two that is less than or equal to it.
+size_t sizeClassForCapacity(size_t capacity) {
+  return size_t(std::bit_width(capacity) - 1);
+}
+
+} // namespace
+
+/*static*/ const std::shared_ptr<RasterOverlayImagePool>&
+RasterOverlayImagePool::getDefault() {
+  // Pooled buffers are not included in any reported memory usage, so the
+  // default pool holds none until an application opts in.
+  static const std::shared_ptr<RasterOverlayImagePool> pDefault =
+      std::make_shared<RasterOverlayImagePool>(0);
+  return pDefault;
+}
+
+RasterOverlayImagePool::RasterOverlayImagePool(
+    int64_t maximumPooledBytes) noexcept
+    : _mutex(),
+      _freeBuffers(),
+      _pooledBytes(0),
+      _maximumPooledBytes(maximumPooledBytes) {}
+
+std::vector<std::byte> RasterOverlayImagePool::acquire(size_t byteSize) {
+  std::vector<std::byte> buffer;
+  if (byteSize < MinimumPooledBufferBytes) {
+    buffer.resize(byteSize);
+    return buffer;
+  }
+
+  const size_t sizeClass = sizeClassForRequest(byteSize);
+
+  {
+    std::lock_guard lock(this->_mutex);
+    std::vector<std::vector<std::byte>>& freeBuffers =
+        this->_freeBuffers[sizeClass];
+    if (!freeBuffers.empty()) {
+      buffer = std::move(freeBuffers.back());
+      freeBuffers.pop_back();
+      this->_pooledBytes -= int64_t(buffer.capacity());
+    }
+  }
+
+  if (buffer.capacity() == 0) {
+    buffer.reserve(size_t(1) << sizeClass);
+  }
+
+  // Pooled buffers are empty, so this zero-fills the whole buffer.
+  buffer.resize(byteSize);
+  return buffer;
+}
+
+void RasterOverlayImagePool::release(std::vector<std::byte>&& buffer) {
+  std::vector<std::byte> released = std::move(buffer);
+  buffer.clear();
+
+  const size_t capacity = released.capacity();
+  if (capacity < MinimumPooledBufferBytes) {
+    return;
+  }
+
+  released.clear();
+
+  std::lock_guard lock(this->_mutex);
+  if (this->_pooledBytes + int64_t(capacity) > this->_maximumPooledBytes) {
+    // The pool is full, so free the buffer after releasing the lock.
+    return;
+  }
+
+  this->_freeBuffers[sizeClassForCapacity(capacity)].emplace_back(
+      std::move(released));
+  this->_pooledBytes += int64_t(capacity);
+}
+
+int64_t RasterOverlayImagePool::getPooledBytes() const {
+  std::lock_guard lock(this->_mutex);
+  return this->_pooledBytes;
+}
+
+int64_t RasterOverlayImagePool::getMaximumPooledBytes() const {
+  std::lock_guard lock(this->_mutex);
+  return this->_maximumPooledBytes;
+}
+
+void RasterOverlayImagePool::setMaximumPooledBytes(int64_t maximumPooledBytes) {
+  std::vector<std::vector<std::byte>> freed;
+
+  std::lock_guard lock(this->_mutex);
+  this->_maximumPooledBytes = maximumPooledBytes;
+  this->trim(maximumPooledBytes, freed);
+}
+
+void RasterOverlayImagePool::clear() {
+  std::vector<std::vector<std::byte>> freed;
+
+  std::lock_guard lock(this->_mutex);
+  this->trim(0, freed);
+}
+
+void RasterOverlayImagePool::trim(
+    int64_t maximumPooledBytes,
+    std::vector<std::vector<std::byte>>& freed) {
+  // Free the largest buffers first.
+  for (auto it = this->_freeBuffers.rbegin();
+       it != this->_freeBuffers.rend() &&
+       this->_pooledBytes > maximumPooledBytes;
+       ++it) {
+    while (!it->empty() && this->_pooledBytes > maximumPooledBytes) {
+      this->_pooledBytes -= int64_t(it->back().capacity());
+      freed.emplace_back(std::move(it->back()));
+      it->pop_back();
+    }
+  }
+}
+
+} // namespace CesiumRasterOverlays
@@ -2,6 +2,7 @@
 #include <CesiumAsync/ITaskProcessor.h>
 #include <CesiumRasterOverlays/IPrepareRasterOverlayRendererResources.h>
 #include <CesiumRasterOverlays/RasterOverlay.h>
+#include <CesiumRasterOverlays/RasterOverlayImagePool.h>
 #include <CesiumRasterOverlays/RasterOverlayTile.h>
 #include <CesiumRasterOverlays/RasterOverlayTileProvider.h>
 #include <CesiumUtility/joinToString.h>
@@ -57,6 +58,12 @@ RasterOverlayTile::~RasterOverlayTile() {
         pLoadThreadResult,
         pMainThreadResult);
   }
+
+  // Reuse the image's pixel buffer for a future tile, unless something other
+  // than this tile still references the image.
+  if (this->_pImage && this->_pImage->getReferenceCount() == 1) {
+    tileProvider.getImagePool()->release(std::move(this->_pImage->pixelData));
+  }
 }
 
 RasterOverlay& RasterOverlayTile::getOverlay() noexcept {
@@ -2,6 +2,7 @@
 #include <CesiumGltfReader/ImageDecoder.h>
 #include <CesiumRasterOverlays/IPrepareRasterOverlayRendererResources.h>
 #include <CesiumRasterOverlays/RasterOverlay.h>
+#include <CesiumRasterOverlays/RasterOverlayImagePool.h>
 #include <CesiumRasterOverlays/RasterOverlayTile.h>
 #include <CesiumRasterOverlays/RasterOverlayTileProvider.h>
 #include <CesiumUtility/Tracing.h>
@@ -71,6 +72,20 @@ RasterOverlayTileProvider::~RasterOverlayTileProvider() noexcept {
   }
 }
 
+std::shared_ptr<RasterOverlayImagePool>
+RasterOverlayTileProvider::getImagePool() const {
+  const std::shared_ptr<RasterOverlayImagePool>& pImagePool =
+      this->getOwner().getOptions().pImagePool;
+  return pImagePool ? pImagePool : RasterOverlayImagePool::getDefault();
+}
+
+GpuCompressedPixelFormat
+RasterOverlayTileProvider::getCompressedPixelFormat() const {
+  const RasterOverlayOptions& options = this->getOwner().getOptions();
+  return options.compressImages ? options.ktx2TranscodeTargets.UASTC_RGBA
+                                : GpuCompressedPixelFormat::NONE;
+}
+
 CesiumUtility::IntrusivePointer<RasterOverlayTile>
 RasterOverlayTileProvider::getTile(
     const CesiumGeometry::Rectangle& rectangle,
@@ -243,7 +258,8 @@ static LoadResult createLoadResultFromLoadedImage(
         pPrepareRendererResources,
     const std::shared_ptr<spdlog::logger>& pLogger,
     LoadedRasterOverlayImage&& loadedImage,
-    const std::any& rendererOptions) {
+    const std::any& rendererOptions,
+    GpuCompressedPixelFormat compressedPixelFormat) {
   if (!loadedImage.pImage) {
     loadedImage.errorList.logError(pLogger, "Failed to load image for tile");
     LoadResult result;
@@ -275,6 +291,16 @@ static LoadResult createLoadResultFromLoadedImage(
         std::to_string(image.height) + "x" + std::to_string(image.channels) +
         "x" + std::to_string(image.bytesPerChannel));
 
+    if (compressedPixelFormat != GpuCompressedPixelFormat::NONE &&
+        image.compressedPixelFormat == GpuCompressedPixelFormat::NONE) {
+      std::optional<std::string> error =
+          ImageDecoder::compressImage(image, compressedPixelFormat);
+      if (error) {
+        ErrorList::warning(std::move(*error))
+            .logWarning(pLogger, "Image for tile was not compressed");
+      }
+    }
+
     void* pRendererResources = nullptr;
     if (pPrepareRendererResources) {
       pRendererResources = pPrepareRendererResources->prepareRasterInLoadThread(
@@ -325,13 +351,15 @@ CesiumAsync::Future<TileProviderAndTile> RasterOverlayTileProvider::doLoad(
       .thenInWorkerThread(
           [pPrepareRendererResources = this->getPrepareRendererResources(),
            pLogger = this->getLogger(),
-           rendererOptions = this->_pOwner->getOptions().rendererOptions](
+           rendererOptions = this->_pOwner->getOptions().rendererOptions,
+           compressedPixelFormat = this->getCompressedPixelFormat()](
               LoadedRasterOverlayImage&& loadedImage) {
             return createLoadResultFromLoadedImage(
                 pPrepareRendererResources,
                 pLogger,
                 std::move(loadedImage),
-                rendererOptions);
+                rendererOptions,
+                compressedPixelFormat);
           })
       .thenInMainThread(
           [thiz, pTile, isThrottledLoad](LoadResult&& result) noexcept {
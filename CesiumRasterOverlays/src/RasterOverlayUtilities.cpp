@@ -2,6 +2,7 @@
 #include <CesiumGeospatial/BoundingRegionBuilder.h>
 #include <CesiumGeospatial/Ellipsoid.h>
 #include <CesiumGltf/AccessorWriter.h>
+#include <CesiumGltf/ExtensionKhrDracoMeshCompression.h>
 #include <CesiumGltf/ExtensionModelExtStructuralMetadata.h>
 #include <CesiumGltf/Model.h>
 #include <CesiumGltfContent/GltfUtilities.h>
@@ -12,6 +13,9 @@
 
 #include <algorithm>
 #include <cstring>
+#include <optional>
+#include <span>
+#include <vector>
 
 using namespace CesiumGltf;
 using namespace CesiumGltfContent;
@@ -84,6 +88,13 @@ RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
           CesiumGltf::Mesh& /*mesh*/,
           CesiumGltf::MeshPrimitive& primitive,
           const glm::dmat4& nodeTransform) {
+        // The positions of a primitive that was left Draco-compressed cannot
+        // be read.
+        if (primitive.hasExtension<
+                CesiumGltf::ExtensionKhrDracoMeshCompression>()) {
+          return;
+        }
+
         auto positionIt = primitive.attributes.find("POSITION");
         if (positionIt == primitive.attributes.end()) {
           return;
@@ -201,107 +212,153 @@ RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
           maxs.emplace_back(&uvAccessor.max);
         }
 
-        // Generate texture coordinates for each position.
-        for (int64_t positionIndex = 0; positionIndex < positionView.size();
-             ++positionIndex) {
-          // Get the ECEF position
-          const glm::vec3 position = positionView[positionIndex];
-          const glm::dvec3 positionEcef =
-              glm::dvec3(fullTransform * glm::dvec4(position, 1.0));
-
-          // Convert it to cartographic
-          const std::optional<CesiumGeospatial::Cartographic> cartographic =
-              ellipsoid.cartesianToCartographic(positionEcef);
-          if (!cartographic) {
-            for (CesiumGltf::AccessorWriter<glm::vec2>& uvWriter : uvWriters) {
-              uvWriter[positionIndex] = glm::dvec2(0.0, 0.0);
-            }
-            continue;
+        // Generate texture coordinates for each position. Positions are
+        // converted to cartographic and projected in batches so that these
+        // transformations run in tight loops.
+        constexpr int64_t batchSize = 256;
+        std::vector<glm::dvec3> positionsEcef(static_cast<size_t>(batchSize));
+        std::vector<std::optional<Cartographic>> cartographics(
+            static_cast<size_t>(batchSize));
+        std::vector<Cartographic> validCartographics(
+            static_cast<size_t>(batchSize),
+            Cartographic(0.0, 0.0, 0.0));
+        std::vector<glm::dvec3> projectedPositions(
+            static_cast<size_t>(batchSize) * projections.size());
+
+        for (int64_t batchStart = 0; batchStart < positionView.size();
+             batchStart += batchSize) {
+          const size_t count = size_t(
+              std::min(batchSize, positionView.size() - batchStart));
+
+          // Get the ECEF positions
+          for (size_t i = 0; i < count; ++i) {
+            const glm::vec3 position =
+                positionView[batchStart + int64_t(i)];
+            positionsEcef[i] =
+                glm::dvec3(fullTransform * glm::dvec4(position, 1.0));
           }
 
-          // exclude skirt vertices from bounds
-          if (positionIndex >= vertexBegin && positionIndex < vertexEnd) {
-            computedBounds.expandToIncludePosition(*cartographic);
+          // Convert them to cartographic
+          ellipsoid.cartesianToCartographic(
+              std::span<const glm::dvec3>(positionsEcef.data(), count),
+              std::span<std::optional<Cartographic>>(
+                  cartographics.data(),
+                  count));
+
+          for (size_t i = 0; i < count; ++i) {
+            validCartographics[i] =
+                cartographics[i].value_or(Cartographic(0.0, 0.0, 0.0));
           }
 
-          // Generate texture coordinates at this position for each projection
-          for (size_t projectionIndex = 0; projectionIndex < projections.size();
+          // Project them with each raster overlay projection
+          for (size_t projectionIndex = 0;
+               projectionIndex < projections.size();
                ++projectionIndex) {
-            const CesiumGeospatial::Projection& projection =
-                projections[projectionIndex];
-            const CesiumGeometry::Rectangle& rectangle =
-                rectangles[projectionIndex];
-
-            // Project it with the raster overlay's projection
-            glm::dvec3 projectedPosition =
-                projectPosition(projection, cartographic.value());
-
-            double longitude = cartographic.value().longitude;
-            const double latitude = cartographic.value().latitude;
-            const double ellipsoidHeight = cartographic.value().height;
-
-            // If the position is near the anti-meridian and the projected
-            // position is outside the expected range, try using the equivalent
-            // longitude on the other side of the anti-meridian to see if that
-            // gets us closer.
-            if (glm::abs(
-                    glm::abs(cartographic.value().longitude) -
-                    CesiumUtility::Math::OnePi) <
-                    CesiumUtility::Math::Epsilon5 &&
-                (projectedPosition.x < rectangle.minimumX ||
-                 projectedPosition.x > rectangle.maximumX ||
-                 projectedPosition.y < rectangle.minimumY ||
-                 projectedPosition.y > rectangle.maximumY)) {
-              const double testLongitude = longitude + longitude < 0.0
-                                               ? CesiumUtility::Math::TwoPi
-                                               : -CesiumUtility::Math::TwoPi;
-              const glm::dvec3 projectedPosition2 = projectPosition(
-                  projection,
-                  CesiumGeospatial::Cartographic(
-                      testLongitude,
-                      latitude,
-                      ellipsoidHeight));
-
-              const double distance1 = rectangle.computeSignedDistance(
-                  glm::dvec2(projectedPosition));
-              const double distance2 = rectangle.computeSignedDistance(
-                  glm::dvec2(projectedPosition2));
-
-              if (distance2 < distance1) {
-                projectedPosition = projectedPosition2;
-                longitude = testLongitude;
+            projectPositions(
+                projections[projectionIndex],
+                std::span<const Cartographic>(validCartographics.data(), count),
+                std::span<glm::dvec3>(
+                    projectedPositions.data() + projectionIndex * count,
+                    count));
+          }
+
+          for (size_t i = 0; i < count; ++i) {
+            const int64_t positionIndex = batchStart + int64_t(i);
+            const std::optional<Cartographic>& cartographic = cartographics[i];
+            if (!cartographic) {
+              for (CesiumGltf::AccessorWriter<glm::vec2>& uvWriter :
+                   uvWriters) {
+                uvWriter[positionIndex] = glm::dvec2(0.0, 0.0);
               }
+              continue;
             }
 
-            // Scale to (0.0, 0.0) at the (minimumX, minimumY) corner, and
-            // (1.0, 1.0) at the (maximumX, maximumY) corner. The coordinates
-            // should stay inside these bounds if the input rectangle actually
-            // bounds the vertices, but we'll clamp to be safe.
-            glm::vec2 uv(
-                CesiumUtility::Math::clamp(
-                    (projectedPosition.x - rectangle.minimumX) /
-                        rectangle.computeWidth(),
-                    0.0,
-                    1.0),
-                CesiumUtility::Math::clamp(
-                    (projectedPosition.y - rectangle.minimumY) /
-                        rectangle.computeHeight(),
-                    0.0,
-                    1.0));
-
-            if (invertVCoordinate) {
-              uv.y = 1.0f - uv.y;
+            // exclude skirt vertices from bounds
+            if (positionIndex >= vertexBegin && positionIndex < vertexEnd) {
+              computedBounds.expandToIncludePosition(*cartographic);
             }
 
-            mins[projectionIndex]->at(0) =
-                glm::min(mins[projectionIndex]->at(0), double(uv.x));
-            mins[projectionIndex]->at(1) =
-                glm::min(mins[projectionIndex]->at(1), double(uv.y));
-            maxs[projectionIndex]->at(0) =
-                glm::max(maxs[projectionIndex]->at(0), double(uv.x));
-            maxs[projectionIndex]->at(1) =
-                glm::max(maxs[projectionIndex]->at(1), double(uv.y));
-            uvWriters[projectionIndex][positionIndex] = uv;
+            // Generate texture coordinates at this position for each
+            // projection
+            for (size_t projectionIndex = 0;
+                 projectionIndex < projections.size();
+                 ++projectionIndex) {
+              const CesiumGeospatial::Projection& projection =
+                  projections[projectionIndex];
+              const CesiumGeometry::Rectangle& rectangle =
+                  rectangles[projectionIndex];
+
+              glm::dvec3 projectedPosition =
+                  projectedPositions[projectionIndex * count + i];
+
+              double longitude = cartographic.value().longitude;
+              const double latitude = cartographic.value().latitude;
+              const double ellipsoidHeight = cartographic.value().height;
+
+              // If the position is near the anti-meridian and the projected
+              // position is outside the expected range, try using the
+              // equivalent longitude on the other side of the anti-meridian
+              // to see if that gets us closer.
+              if (glm::abs(
+                      glm::abs(cartographic.value().longitude) -
+                      CesiumUtility::Math::OnePi) <
+                      CesiumUtility::Math::Epsilon5 &&
+                  (projectedPosition.x < rectangle.minimumX ||
+                   projectedPosition.x > rectangle.maximumX ||
+                   projectedPosition.y < rectangle.minimumY ||
+                   projectedPosition.y > rectangle.maximumY)) {
+                const double testLongitude = longitude + longitude < 0.0
+                                                 ? CesiumUtility::Math::TwoPi
+                                                 : -CesiumUtility::Math::TwoPi;
+                const glm::dvec3 projectedPosition2 = projectPosition(
+                    projection,
+                    CesiumGeospatial::Cartographic(
+                        testLongitude,
+                        latitude,
+                        ellipsoidHeight));
+
+                const double distance1 = rectangle.computeSignedDistance(
+                    glm::dvec2(projectedPosition));
+                const double distance2 = rectangle.computeSignedDistance(
+                    glm::dvec2(projectedPosition2));
+
+                if (distance2 < distance1) {
+                  projectedPosition = projectedPosition2;
+                  longitude = testLongitude;
+                }
+              }
+
+              // Scale to (0.0, 0.0) at the (minimumX, minimumY) corner, and
+              // (1.0, 1.0) at the (maximumX, maximumY) corner. The
+              // coordinates should stay inside these bounds if the input
+              // rectangle actually bounds the vertices, but we'll clamp to be
+              // safe.
+              glm::vec2 uv(
+                  CesiumUtility::Math::clamp(
+                      (projectedPosition.x - rectangle.minimumX) /
+                          rectangle.computeWidth(),
+                      0.0,
+                      1.0),
+                  CesiumUtility::Math::clamp(
+                      (projectedPosition.y - rectangle.minimumY) /
+                          rectangle.computeHeight(),
+                      0.0,
+                      1.0));
+
+              if (invertVCoordinate) {
+                uv.y = 1.0f - uv.y;
+              }
+
+              mins[projectionIndex]->at(0) =
+                  glm::min(mins[projectionIndex]->at(0), double(uv.x));
+              mins[projectionIndex]->at(1) =
+                  glm::min(mins[projectionIndex]->at(1), double(uv.y));
+              maxs[projectionIndex]->at(0) =
+                  glm::max(maxs[projectionIndex]->at(0), double(uv.x));
+              maxs[projectionIndex]->at(1) =
+                  glm::max(maxs[projectionIndex]->at(1), double(uv.y));
+              uvWriters[projectionIndex][positionIndex] = uv;
+            }
           }
         }
       };
@@ -327,6 +384,30 @@ struct EdgeIndices {
   std::vector<EdgeVertex> north;
 };
 
+// Flags describing which sides of the texture coordinate midpoints a triangle
+// may extend to. A triangle that does not reach a child's side of both
+// midpoints contributes nothing to that child.
+enum TriangleQuadrant : uint8_t {
+  BelowMidpointU = 1 << 0,
+  AboveMidpointU = 1 << 1,
+  BelowMidpointV = 1 << 2,
+  AboveMidpointV = 1 << 3
+};
+
+// The TriangleQuadrant flags of every triangle of every primitive of a parent
+// model, indexed by mesh, then primitive, then triangle. These are computed
+// while upsampling the first child and reused for its siblings.
+using ModelTriangleQuadrants = std::vector<std::vector<std::vector<uint8_t>>>;
+
+std::optional<Model> upsampleGltf(
+    const Model& parentModel,
+    CesiumGeometry::UpsampledQuadtreeNode childID,
+    bool hasInvertedVCoordinate,
+    const std::string_view& textureCoordinateAttributeBaseName,
+    int32_t textureCoordinateIndex,
+    const CesiumGeospatial::Ellipsoid& ellipsoid,
+    ModelTriangleQuadrants* pTriangleQuadrants);
+
 bool upsamplePrimitiveForRasterOverlays(
     const Model& parentModel,
     Model& model,
@@ -336,7 +417,8 @@ bool upsamplePrimitiveForRasterOverlays(
     bool hasInvertedVCoordinate,
     const std::string_view& textureCoordinateAttributeBaseName,
     int32_t textureCoordinateIndex,
-    const CesiumGeospatial::Ellipsoid& ellipsoid);
+    const CesiumGeospatial::Ellipsoid& ellipsoid,
+    std::vector<uint8_t>* pTriangleQuadrants);
 
 struct FloatVertexAttribute {
   const std::vector<std::byte>& buffer;
@@ -354,6 +436,7 @@ void addClippedPolygon(
     std::vector<FloatVertexAttribute>& attributes,
     std::vector<uint32_t>& vertexMap,
     std::vector<uint32_t>& clipVertexToIndices,
+    std::vector<float>& scratch,
     const std::vector<CesiumGeometry::TriangleClipVertex>& complements,
     const std::vector<CesiumGeometry::TriangleClipVertex>& clipResult);
 
@@ -414,6 +497,57 @@ RasterOverlayUtilities::upsampleGltfForRasterOverlays(
     int32_t textureCoordinateIndex,
     const CesiumGeospatial::Ellipsoid& ellipsoid) {
   CESIUM_TRACE("upsampleGltfForRasterOverlays");
+  return upsampleGltf(
+      parentModel,
+      childID,
+      hasInvertedVCoordinate,
+      textureCoordinateAttributeBaseName,
+      textureCoordinateIndex,
+      ellipsoid,
+      nullptr);
+}
+
+/*static*/ std::vector<std::optional<Model>>
+RasterOverlayUtilities::upsampleGltfForRasterOverlayChildren(
+    const Model& parentModel,
+    const std::span<const UpsampledQuadtreeNode>& childIDs,
+    bool hasInvertedVCoordinate,
+    const std::string_view& textureCoordinateAttributeBaseName,
+    int32_t textureCoordinateIndex,
+    const CesiumGeospatial::Ellipsoid& ellipsoid) {
+  CESIUM_TRACE("upsampleGltfForRasterOverlayChildren");
+
+  ModelTriangleQuadrants triangleQuadrants(parentModel.meshes.size());
+  for (size_t i = 0; i < parentModel.meshes.size(); ++i) {
+    triangleQuadrants[i].resize(parentModel.meshes[i].primitives.size());
+  }
+
+  std::vector<std::optional<Model>> result;
+  result.reserve(childIDs.size());
+  for (const UpsampledQuadtreeNode& childID : childIDs) {
+    result.emplace_back(upsampleGltf(
+        parentModel,
+        childID,
+        hasInvertedVCoordinate,
+        textureCoordinateAttributeBaseName,
+        textureCoordinateIndex,
+        ellipsoid,
+        &triangleQuadrants));
+  }
+
+  return result;
+}
+
+namespace {
+
+std::optional<Model> upsampleGltf(
+    const Model& parentModel,
+    UpsampledQuadtreeNode childID,
+    bool hasInvertedVCoordinate,
+    const std::string_view& textureCoordinateAttributeBaseName,
+    int32_t textureCoordinateIndex,
+    const CesiumGeospatial::Ellipsoid& ellipsoid,
+    ModelTriangleQuadrants* pTriangleQuadrants) {
   Model result;
 
   // Copy the entire parent model except for the buffers, bufferViews, and
@@ -461,8 +595,14 @@ RasterOverlayUtilities::upsampleGltfForRasterOverlays(
 
   bool containsPrimitives = false;
 
-  for (Mesh& mesh : result.meshes) {
-    for (size_t i = 0; i < mesh.primitives.size(); ++i) {
+  for (size_t meshIndex = 0; meshIndex < result.meshes.size(); ++meshIndex) {
+    Mesh& mesh = result.meshes[meshIndex];
+
+    // The index of the primitive in the parent, which differs from `i` once
+    // primitives have been removed.
+    size_t parentPrimitiveIndex = 0;
+    for (size_t i = 0; i < mesh.primitives.size();
+         ++i, ++parentPrimitiveIndex) {
       MeshPrimitive& primitive = mesh.primitives[i];
 
       bool keep = upsamplePrimitiveForRasterOverlays(
@@ -474,7 +614,10 @@ RasterOverlayUtilities::upsampleGltfForRasterOverlays(
           hasInvertedVCoordinate,
           textureCoordinateAttributeBaseName,
           textureCoordinateIndex,
-          ellipsoid);
+          ellipsoid,
+          pTriangleQuadrants
+              ? &(*pTriangleQuadrants)[meshIndex][parentPrimitiveIndex]
+              : nullptr);
 
       // We're assuming here that nothing references primitives by index, so we
       // can remove them without any drama.
@@ -490,6 +633,8 @@ RasterOverlayUtilities::upsampleGltfForRasterOverlays(
                             : std::nullopt;
 }
 
+} // namespace
+
 /*static*/ glm::dvec2 RasterOverlayUtilities::computeDesiredScreenPixels(
     double geometricError,
     double maximumScreenSpaceError,
@@ -554,146 +699,107 @@ RasterOverlayUtilities::upsampleGltfForRasterOverlays(
 
 namespace {
 
-void copyVertexAttributes(
-    std::vector<FloatVertexAttribute>& vertexAttributes,
-    const CesiumGeometry::TriangleClipVertex& vertex,
-    std::vector<float>& output,
-    bool skipMinMaxUpdate = false) {
-  struct Operation {
-    std::vector<FloatVertexAttribute>& vertexAttributes;
-    std::vector<float>& output;
-    bool skipMinMaxUpdate;
-
-    void operator()(int vertexIndex) {
-      for (FloatVertexAttribute& attribute : vertexAttributes) {
-        const float* pInput = reinterpret_cast<const float*>(
-            attribute.buffer.data() + attribute.offset +
-            attribute.stride * vertexIndex);
-        for (int32_t i = 0; i < attribute.numberOfFloatsPerVertex; ++i) {
-          const float value = *pInput;
-          output.push_back(value);
-          if (!skipMinMaxUpdate) {
-            attribute.minimums[static_cast<size_t>(i)] = glm::min(
-                attribute.minimums[static_cast<size_t>(i)],
-                static_cast<double>(value));
-            attribute.maximums[static_cast<size_t>(i)] = glm::max(
-                attribute.maximums[static_cast<size_t>(i)],
-                static_cast<double>(value));
-          }
-          ++pInput;
-        }
-      }
-    }
+// The number of vertices of scratch space needed to compute a clip vertex. A
+// clip vertex may interpolate between two vertices, each of which may itself
+// interpolate between two vertices of the parent primitive.
+constexpr size_t scratchVerticesPerClipVertex = 4;
 
-    void operator()(const CesiumGeometry::InterpolatedVertex& vertex) {
-      for (FloatVertexAttribute& attribute : vertexAttributes) {
-        const float* pInput0 = reinterpret_cast<const float*>(
-            attribute.buffer.data() + attribute.offset +
-            attribute.stride * vertex.first);
-        const float* pInput1 = reinterpret_cast<const float*>(
-            attribute.buffer.data() + attribute.offset +
-            attribute.stride * vertex.second);
-        for (int32_t i = 0; i < attribute.numberOfFloatsPerVertex; ++i) {
-          const float value = glm::mix(*pInput0, *pInput1, vertex.t);
-          output.push_back(value);
-          if (!skipMinMaxUpdate) {
-            attribute.minimums[static_cast<size_t>(i)] = glm::min(
-                attribute.minimums[static_cast<size_t>(i)],
-                static_cast<double>(value));
-            attribute.maximums[static_cast<size_t>(i)] = glm::max(
-                attribute.maximums[static_cast<size_t>(i)],
-                static_cast<double>(value));
-          }
-          ++pInput0;
-          ++pInput1;
-        }
-      }
-    }
-  };
-
-  std::visit(Operation{vertexAttributes, output, skipMinMaxUpdate}, vertex);
-}
-
-void copyVertexAttributes(
-    std::vector<FloatVertexAttribute>& vertexAttributes,
+void computeVertexAttributes(
+    const std::vector<FloatVertexAttribute>& vertexAttributes,
     const std::vector<CesiumGeometry::TriangleClipVertex>& complements,
     const CesiumGeometry::TriangleClipVertex& vertex,
-    std::vector<float>& output) {
+    std::span<float> output,
+    std::span<float> scratch) {
   struct Operation {
-    std::vector<FloatVertexAttribute>& vertexAttributes;
+    const std::vector<FloatVertexAttribute>& vertexAttributes;
     const std::vector<CesiumGeometry::TriangleClipVertex>& complements;
-    std::vector<float>& output;
+    std::span<float> output;
+    std::span<float> scratch;
 
     void operator()(int vertexIndex) {
       if (vertexIndex < 0) {
-        copyVertexAttributes(
+        computeVertexAttributes(
             vertexAttributes,
+            complements,
             complements[static_cast<size_t>(~vertexIndex)],
-            output);
-      } else {
-        copyVertexAttributes(vertexAttributes, vertexIndex, output);
+            output,
+            scratch);
+        return;
+      }
+
+      // Attributes are tightly packed in the output, so each one is a single
+      // copy from the parent's buffer.
+      float* pOutput = output.data();
+      for (const FloatVertexAttribute& attribute : vertexAttributes) {
+        const std::byte* pInput = attribute.buffer.data() + attribute.offset +
+                                  attribute.stride * vertexIndex;
+        const size_t floats = size_t(attribute.numberOfFloatsPerVertex);
+        std::memcpy(pOutput, pInput, floats * sizeof(float));
+        pOutput += floats;
       }
     }
 
     void operator()(const CesiumGeometry::InterpolatedVertex& vertex) {
-      size_t outputIndex0 = output.size();
+      const size_t vertexSizeFloats = output.size();
+      CESIUM_ASSERT(scratch.size() >= 2 * vertexSizeFloats);
 
-      // Copy the two vertices into the output array
-      if (vertex.first < 0) {
-        copyVertexAttributes(
-            vertexAttributes,
-            complements[static_cast<size_t>(~vertex.first)],
-            output,
-            true);
-      } else {
-        copyVertexAttributes(vertexAttributes, vertex.first, output, true);
-      }
+      const std::span<float> first = scratch.subspan(0, vertexSizeFloats);
+      const std::span<float> second =
+          scratch.subspan(vertexSizeFloats, vertexSizeFloats);
+      const std::span<float> remaining =
+          scratch.subspan(2 * vertexSizeFloats);
 
-      size_t outputIndex1 = output.size();
-
-      if (vertex.second < 0) {
-        copyVertexAttributes(
-            vertexAttributes,
-            complements[static_cast<size_t>(~vertex.second)],
-            output,
-            true);
-      } else {
-        copyVertexAttributes(vertexAttributes, vertex.second, output, true);
-      }
+      computeVertexAttributes(
+          vertexAttributes,
+          complements,
+          vertex.first,
+          first,
+          remaining);
+      computeVertexAttributes(
+          vertexAttributes,
+          complements,
+          vertex.second,
+          second,
+          remaining);
 
-      // Interpolate between them and overwrite the first with the result.
-      for (FloatVertexAttribute& attribute : vertexAttributes) {
-        for (int32_t i = 0; i < attribute.numberOfFloatsPerVertex; ++i) {
-          float value =
-              glm::mix(output[outputIndex0], output[outputIndex1], vertex.t);
-          output[outputIndex0] = value;
-          attribute.minimums[static_cast<size_t>(i)] = glm::min(
-              attribute.minimums[static_cast<size_t>(i)],
-              static_cast<double>(value));
-          attribute.maximums[static_cast<size_t>(i)] = glm::max(
-              attribute.maximums[static_cast<size_t>(i)],
-              static_cast<double>(value));
-          ++outputIndex0;
-          ++outputIndex1;
-        }
+      for (size_t i = 0; i < vertexSizeFloats; ++i) {
+        output[i] = glm::mix(first[i], second[i], vertex.t);
       }
-
-      // Remove the temporary second, which is now pointed to be outputIndex0.
-      output.erase(
-          output.begin() +
-              static_cast<std::vector<float>::iterator::difference_type>(
-                  outputIndex0),
-          output.end());
     }
   };
 
-  std::visit(
-      Operation{
-          vertexAttributes,
-          complements,
-          output,
-      },
-      vertex);
+  std::visit(Operation{vertexAttributes, complements, output, scratch}, vertex);
+}
+
+void copyVertexAttributes(
+    std::vector<FloatVertexAttribute>& vertexAttributes,
+    const std::vector<CesiumGeometry::TriangleClipVertex>& complements,
+    const CesiumGeometry::TriangleClipVertex& vertex,
+    std::vector<float>& output,
+    std::vector<float>& scratch) {
+  const size_t vertexSizeFloats = scratch.size() / scratchVerticesPerClipVertex;
+  const size_t outputIndex = output.size();
+  output.resize(outputIndex + vertexSizeFloats);
+
+  const std::span<float> newVertex(
+      output.data() + outputIndex,
+      vertexSizeFloats);
+  computeVertexAttributes(
+      vertexAttributes,
+      complements,
+      vertex,
+      newVertex,
+      scratch);
+
+  const float* pValue = newVertex.data();
+  for (FloatVertexAttribute& attribute : vertexAttributes) {
+    for (size_t i = 0; i < size_t(attribute.numberOfFloatsPerVertex); ++i) {
+      const double value = static_cast<double>(*pValue);
+      attribute.minimums[i] = glm::min(attribute.minimums[i], value);
+      attribute.maximums[i] = glm::max(attribute.maximums[i], value);
+      ++pValue;
+    }
+  }
 }
 
 template <class T>
@@ -763,6 +869,42 @@ T getVertexValue(
   return std::visit(Operation{accessor, complements}, vertex);
 }
 
+template <class TIndex>
+void computeTriangleQuadrants(
+    const AccessorView<glm::vec2>& uvView,
+    const AccessorView<TIndex>& indicesView,
+    int64_t indicesBegin,
+    int64_t indicesCount,
+    std::vector<uint8_t>& result) {
+  result.clear();
+  result.reserve(size_t(indicesCount / 3 + 1));
+
+  // A triangle touching a midpoint is included on both sides of it, so that a
+  // triangle is only skipped if clipping it would have discarded it anyway.
+  for (int64_t i = indicesBegin; i < indicesBegin + indicesCount; i += 3) {
+    const glm::vec2 uv0 = uvView[indicesView[i]];
+    const glm::vec2 uv1 = uvView[indicesView[i + 1]];
+    const glm::vec2 uv2 = uvView[indicesView[i + 2]];
+    const glm::vec2 minimum = glm::min(glm::min(uv0, uv1), uv2);
+    const glm::vec2 maximum = glm::max(glm::max(uv0, uv1), uv2);
+
+    uint8_t quadrants = 0;
+    if (minimum.x <= 0.5f) {
+      quadrants |= BelowMidpointU;
+    }
+    if (maximum.x >= 0.5f) {
+      quadrants |= AboveMidpointU;
+    }
+    if (minimum.y <= 0.5f) {
+      quadrants |= BelowMidpointV;
+    }
+    if (maximum.y >= 0.5f) {
+      quadrants |= AboveMidpointV;
+    }
+    result.emplace_back(quadrants);
+  }
+}
+
 template <class TIndex>
 bool upsamplePrimitiveForRasterOverlays(
     const Model& parentModel,
@@ -773,7 +915,8 @@ bool upsamplePrimitiveForRasterOverlays(
     bool hasInvertedVCoordinate,
     const std::string_view& textureCoordinateAttributeBaseName,
     int32_t textureCoordinateIndex,
-    const CesiumGeospatial::Ellipsoid& ellipsoid) {
+    const CesiumGeospatial::Ellipsoid& ellipsoid,
+    std::vector<uint8_t>* pTriangleQuadrants) {
   CESIUM_TRACE("upsamplePrimitiveForRasterOverlays");
 
   // Add up the per-vertex size of all attributes and create buffers,
@@ -921,6 +1064,23 @@ bool upsamplePrimitiveForRasterOverlays(
     indicesCount = parentSkirtMeshMetadata->noSkirtIndicesCount;
   }
 
+  // Triangles that do not reach this child's side of both midpoints are
+  // skipped without clipping them. The flags are shared with the siblings of
+  // this child, if any, so they're computed only once.
+  if (pTriangleQuadrants && pTriangleQuadrants->empty()) {
+    computeTriangleQuadrants(
+        uvView,
+        indicesView,
+        indicesBegin,
+        indicesCount,
+        *pTriangleQuadrants);
+  }
+
+  const uint8_t childQuadrantU = keepAboveU ? AboveMidpointU : BelowMidpointU;
+  const uint8_t childQuadrantV =
+      (hasInvertedVCoordinate ? !keepAboveV : keepAboveV) ? AboveMidpointV
+                                                          : BelowMidpointV;
+
   std::vector<uint32_t> clipVertexToIndices;
   std::vector<CesiumGeometry::TriangleClipVertex> clippedA;
   std::vector<CesiumGeometry::TriangleClipVertex> clippedB;
@@ -930,15 +1090,28 @@ bool upsamplePrimitiveForRasterOverlays(
       size_t(uvView.size()),
       std::numeric_limits<uint32_t>::max());
 
-  // std::vector<unsigned char> newVertexBuffer(vertexSizeFloats *
-  // sizeof(float)); std::span<float>
-  // newVertexFloats(reinterpret_cast<float*>(newVertexBuffer.data()),
-  // newVertexBuffer.size() / sizeof(float));
+  std::vector<float> scratch(
+      scratchVerticesPerClipVertex * size_t(vertexSizeFloats));
+
+  // Each child covers roughly a quarter of the parent, plus the vertices
+  // created along the clip lines.
   std::vector<float> newVertexFloats;
+  newVertexFloats.reserve(
+      (size_t(uvView.size()) / 4 + 16) * size_t(vertexSizeFloats));
   std::vector<uint32_t> indices;
+  indices.reserve(size_t(indicesCount) / 4 + 16);
   EdgeIndices edgeIndices;
 
   for (int64_t i = indicesBegin; i < indicesBegin + indicesCount; i += 3) {
+    if (pTriangleQuadrants) {
+      const uint8_t quadrants =
+          (*pTriangleQuadrants)[size_t((i - indicesBegin) / 3)];
+      if ((quadrants & childQuadrantU) == 0 ||
+          (quadrants & childQuadrantV) == 0) {
+        continue;
+      }
+    }
+
     TIndex i0 = indicesView[i];
     TIndex i1 = indicesView[i + 1];
     TIndex i2 = indicesView[i + 2];
@@ -986,6 +1159,7 @@ bool upsamplePrimitiveForRasterOverlays(
         attributes,
         vertexMap,
         clipVertexToIndices,
+        scratch,
         clippedA,
         clippedB);
     if (hasSkirt) {
@@ -1025,6 +1199,7 @@ bool upsamplePrimitiveForRasterOverlays(
           attributes,
           vertexMap,
           clipVertexToIndices,
+          scratch,
           clippedA,
           clippedB);
       if (hasSkirt) {
@@ -1096,17 +1271,20 @@ bool upsamplePrimitiveForRasterOverlays(
   // Populate the buffers
   Buffer& vertexBuffer = model.buffers[vertexBufferIndex];
   vertexBuffer.cesium.data.resize(newVertexFloats.size() * sizeof(float));
-  float* pAsFloats = reinterpret_cast<float*>(vertexBuffer.cesium.data.data());
-  std::copy(newVertexFloats.begin(), newVertexFloats.end(), pAsFloats);
+  std::memcpy(
+      vertexBuffer.cesium.data.data(),
+      newVertexFloats.data(),
+      vertexBuffer.cesium.data.size());
   vertexBuffer.byteLength = vertexBufferView.byteLength =
       int64_t(vertexBuffer.cesium.data.size());
   vertexBufferView.byteStride = vertexSizeFloats * int64_t(sizeof(float));
 
   Buffer& indexBuffer = model.buffers[indexBufferIndex];
   indexBuffer.cesium.data.resize(indices.size() * sizeof(uint32_t));
-  uint32_t* pAsUint32s =
-      reinterpret_cast<uint32_t*>(indexBuffer.cesium.data.data());
-  std::copy(indices.begin(), indices.end(), pAsUint32s);
+  std::memcpy(
+      indexBuffer.cesium.data.data(),
+      indices.data(),
+      indexBuffer.cesium.data.size());
   indexBuffer.byteLength = indexBufferView.byteLength =
       int64_t(indexBuffer.cesium.data.size());
 
@@ -1179,6 +1357,7 @@ uint32_t getOrCreateVertex(
     std::vector<float>& output,
     std::vector<FloatVertexAttribute>& attributes,
     std::vector<uint32_t>& vertexMap,
+    std::vector<float>& scratch,
     const std::vector<CesiumGeometry::TriangleClipVertex>& complements,
     const CesiumGeometry::TriangleClipVertex& clipVertex) {
   const int* pIndex = std::get_if<int>(&clipVertex);
@@ -1188,6 +1367,7 @@ uint32_t getOrCreateVertex(
           output,
           attributes,
           vertexMap,
+          scratch,
           complements,
           complements[static_cast<size_t>(~(*pIndex))]);
     }
@@ -1199,7 +1379,7 @@ uint32_t getOrCreateVertex(
   }
 
   const uint32_t beforeOutput = static_cast<uint32_t>(output.size());
-  copyVertexAttributes(attributes, complements, clipVertex, output);
+  copyVertexAttributes(attributes, complements, clipVertex, output, scratch);
   uint32_t newIndex =
       beforeOutput / (static_cast<uint32_t>(output.size()) - beforeOutput);
 
@@ -1216,6 +1396,7 @@ void addClippedPolygon(
     std::vector<FloatVertexAttribute>& attributes,
     std::vector<uint32_t>& vertexMap,
     std::vector<uint32_t>& clipVertexToIndices,
+    std::vector<float>& scratch,
     const std::vector<CesiumGeometry::TriangleClipVertex>& complements,
     const std::vector<CesiumGeometry::TriangleClipVertex>& clipResult) {
   if (clipResult.size() < 3) {
@@ -1226,18 +1407,21 @@ void addClippedPolygon(
       output,
       attributes,
       vertexMap,
+      scratch,
       complements,
       clipResult[0]);
   const uint32_t i1 = getOrCreateVertex(
       output,
       attributes,
       vertexMap,
+      scratch,
       complements,
       clipResult[1]);
   const uint32_t i2 = getOrCreateVertex(
       output,
       attributes,
       vertexMap,
+      scratch,
       complements,
       clipResult[2]);
 
@@ -1254,6 +1438,7 @@ void addClippedPolygon(
         output,
         attributes,
         vertexMap,
+        scratch,
         complements,
         clipResult[3]);
 
@@ -1566,7 +1751,8 @@ bool upsamplePrimitiveForRasterOverlays(
     bool hasInvertedVCoordinate,
     const std::string_view& textureCoordinateAttributeBaseName,
     int32_t textureCoordinateIndex,
-    const CesiumGeospatial::Ellipsoid& ellipsoid) {
+    const CesiumGeospatial::Ellipsoid& ellipsoid,
+    std::vector<uint8_t>* pTriangleQuadrants) {
   if (primitive.mode != MeshPrimitive::Mode::TRIANGLES ||
       primitive.indices < 0 ||
       primitive.indices >= static_cast<int>(parentModel.accessors.size())) {
@@ -1588,7 +1774,8 @@ bool upsamplePrimitiveForRasterOverlays(
         hasInvertedVCoordinate,
         textureCoordinateAttributeBaseName,
         textureCoordinateIndex,
-        ellipsoid);
+        ellipsoid,
+        pTriangleQuadrants);
   } else if (
       indicesAccessorGltf.componentType ==
       Accessor::ComponentType::UNSIGNED_SHORT) {
@@ -1601,7 +1788,8 @@ bool upsamplePrimitiveForRasterOverlays(
         hasInvertedVCoordinate,
         textureCoordinateAttributeBaseName,
         textureCoordinateIndex,
-        ellipsoid);
+        ellipsoid,
+        pTriangleQuadrants);
   } else if (
       indicesAccessorGltf.componentType ==
       Accessor::ComponentType::UNSIGNED_INT) {
@@ -1614,7 +1802,8 @@ bool upsamplePrimitiveForRasterOverlays(
         hasInvertedVCoordinate,
         textureCoordinateAttributeBaseName,
         textureCoordinateIndex,
-        ellipsoid);
+        ellipsoid,
+        pTriangleQuadrants);
   }
 
   return false;
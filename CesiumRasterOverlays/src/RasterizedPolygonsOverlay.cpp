@@ -1,15 +1,19 @@
 #include <CesiumAsync/AsyncSystem.h>
 #include <CesiumAsync/IAssetAccessor.h>
 #include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumRasterOverlays/RasterOverlayImagePool.h>
 #include <CesiumRasterOverlays/RasterOverlayTile.h>
 #include <CesiumRasterOverlays/RasterOverlayTileProvider.h>
 #include <CesiumRasterOverlays/RasterizedPolygonsOverlay.h>
 #include <CesiumUtility/IntrusivePointer.h>
+#include <CesiumUtility/Math.h>
 
 #include <spdlog/fwd.h>
 
+#include <algorithm>
 #include <memory>
 #include <string>
+#include <vector>
 
 using namespace CesiumGeometry;
 using namespace CesiumGeospatial;
@@ -17,12 +21,149 @@ using namespace CesiumUtility;
 
 namespace CesiumRasterOverlays {
 namespace {
+// A polygon edge in pixel coordinates. It crosses the centers of the rows in
+// [beginRow, endRow), and `x` is where it crosses the center of the current
+// row.
+struct ScanlineEdge {
+  int32_t beginRow;
+  int32_t endRow;
+  double x;
+  double dxdy;
+};
+
+// Returns the index of the first pixel whose center is at or after the given
+// coordinate, clamped to [0, size].
+int32_t firstPixelCenterAtOrAfter(double coordinate, int32_t size) {
+  return int32_t(glm::clamp(glm::ceil(coordinate - 0.5), 0.0, double(size)));
+}
+
+// Fills the pixels whose centers are inside the polygon, using an edge table
+// and the even-odd rule one row at a time. The polygon's longitudes are
+// normalized relative to its first vertex, like its triangulation, and then
+// shifted by a full turn if necessary to be near the rectangle, so polygons
+// crossing the anti-meridian are handled.
+void rasterizePolygon(
+    CesiumGltf::ImageAsset& image,
+    const CesiumGeospatial::GlobeRectangle& rectangle,
+    const CartographicPolygon& polygon,
+    std::byte insideColor,
+    std::vector<ScanlineEdge>& edges,
+    std::vector<ScanlineEdge>& activeEdges,
+    std::vector<double>& crossings) {
+  const std::vector<glm::dvec2>& vertices = polygon.getVertices();
+  if (vertices.size() < 3) {
+    return;
+  }
+
+  const double firstLongitude = vertices[0].x;
+  double longitudeShift = 0.0;
+  const double centerOffset =
+      rectangle.computeCenter().longitude - firstLongitude;
+  if (centerOffset > Math::OnePi) {
+    longitudeShift = Math::TwoPi;
+  } else if (centerOffset < -Math::OnePi) {
+    longitudeShift = -Math::TwoPi;
+  }
+
+  const double pixelsPerRadianX =
+      double(image.width) / rectangle.computeWidth();
+  const double pixelsPerRadianY =
+      double(image.height) / rectangle.computeHeight();
+
+  auto toPixel = [&](const glm::dvec2& vertex) {
+    double longitude = vertex.x - firstLongitude;
+    if (longitude > Math::OnePi) {
+      longitude -= Math::TwoPi;
+    } else if (longitude < -Math::OnePi) {
+      longitude += Math::TwoPi;
+    }
+    longitude += firstLongitude + longitudeShift;
+
+    return glm::dvec2(
+        (longitude - rectangle.getWest()) * pixelsPerRadianX,
+        (rectangle.getNorth() - vertex.y) * pixelsPerRadianY);
+  };
+
+  // Build the edge table.
+  edges.clear();
+  glm::dvec2 previous = toPixel(vertices.back());
+  for (const glm::dvec2& vertex : vertices) {
+    const glm::dvec2 current = toPixel(vertex);
+    const glm::dvec2 top = previous.y < current.y ? previous : current;
+    const glm::dvec2 bottom = previous.y < current.y ? current : previous;
+    previous = current;
+
+    if (top.y == bottom.y) {
+      continue;
+    }
+
+    const int32_t beginRow = firstPixelCenterAtOrAfter(top.y, image.height);
+    const int32_t endRow = firstPixelCenterAtOrAfter(bottom.y, image.height);
+    if (beginRow >= endRow) {
+      continue;
+    }
+
+    const double dxdy = (bottom.x - top.x) / (bottom.y - top.y);
+    const double x = top.x + (double(beginRow) + 0.5 - top.y) * dxdy;
+    edges.emplace_back(ScanlineEdge{beginRow, endRow, x, dxdy});
+  }
+
+  if (edges.empty()) {
+    return;
+  }
+
+  std::sort(
+      edges.begin(),
+      edges.end(),
+      [](const ScanlineEdge& a, const ScanlineEdge& b) {
+        return a.beginRow < b.beginRow;
+      });
+
+  // Walk the rows, maintaining the list of edges that cross each one.
+  activeEdges.clear();
+  size_t nextEdge = 0;
+  for (int32_t row = edges.front().beginRow;
+       nextEdge < edges.size() || !activeEdges.empty();
+       ++row) {
+    activeEdges.erase(
+        std::remove_if(
+            activeEdges.begin(),
+            activeEdges.end(),
+            [row](const ScanlineEdge& edge) { return edge.endRow <= row; }),
+        activeEdges.end());
+
+    while (nextEdge < edges.size() && edges[nextEdge].beginRow == row) {
+      activeEdges.emplace_back(edges[nextEdge]);
+      ++nextEdge;
+    }
+
+    crossings.clear();
+    for (ScanlineEdge& edge : activeEdges) {
+      crossings.emplace_back(edge.x);
+      edge.x += edge.dxdy;
+    }
+    std::sort(crossings.begin(), crossings.end());
+
+    std::byte* pRow =
+        image.pixelData.data() + size_t(row) * size_t(image.width);
+    for (size_t i = 1; i < crossings.size(); i += 2) {
+      const int32_t begin =
+          firstPixelCenterAtOrAfter(crossings[i - 1], image.width);
+      const int32_t end = firstPixelCenterAtOrAfter(crossings[i], image.width);
+      if (begin < end) {
+        std::fill(pRow + begin, pRow + end, insideColor);
+      }
+    }
+  }
+}
+
 void rasterizePolygons(
     LoadedRasterOverlayImage& loaded,
     const CesiumGeospatial::GlobeRectangle& rectangle,
     const glm::dvec2& textureSize,
-    const std::vector<CartographicPolygon>& cartographicPolygons,
-    bool invertSelection) {
+    const CartographicPolygonIndex& polygonIndex,
+    bool invertSelection,
+    RasterOverlayImagePool& imagePool) {
 
   CesiumGltf::ImageAsset& image = loaded.pImage.emplace();
 
@@ -37,10 +178,18 @@ void rasterizePolygons(
     outsideColor = static_cast<std::byte>(0);
   }
 
+  // Only polygons with bounding rectangles that overlap this tile matter.
+  std::vector<const CartographicPolygon*> polygons;
+  polygonIndex.findPolygons(rectangle, polygons);
+
   // create a 1x1 mask if the rectangle is completely inside a polygon
-  if (CartographicPolygon::rectangleIsWithinPolygons(
-          rectangle,
-          cartographicPolygons)) {
+  const bool completelyInsidePolygon = std::any_of(
+      polygons.begin(),
+      polygons.end(),
+      [&rectangle](const CartographicPolygon* pPolygon) {
+        return pPolygon->containsRectangle(rectangle);
+      });
+  if (completelyInsidePolygon) {
     loaded.moreDetailAvailable = false;
     image.width = 1;
     image.height = 1;
@@ -50,20 +199,8 @@ void rasterizePolygons(
     return;
   }
 
-  bool completelyOutsidePolygons = true;
-  for (const CartographicPolygon& selection : cartographicPolygons) {
-    const std::optional<CesiumGeospatial::GlobeRectangle>& boundingRectangle =
-        selection.getBoundingRectangle();
-
-    if (boundingRectangle &&
-        rectangle.computeIntersection(*boundingRectangle)) {
-      completelyOutsidePolygons = false;
-      break;
-    }
-  }
-
   // create a 1x1 mask if the rectangle is completely outside all polygons
-  if (completelyOutsidePolygons) {
+  if (polygons.empty()) {
     loaded.moreDetailAvailable = false;
     image.width = 1;
     image.height = 1;
@@ -73,83 +210,33 @@ void rasterizePolygons(
     return;
   }
 
-  const double rectangleWidth = rectangle.computeWidth();
-  const double rectangleHeight = rectangle.computeHeight();
-
   // create source image
   loaded.moreDetailAvailable = true;
   image.width = int32_t(glm::round(textureSize.x));
   image.height = int32_t(glm::round(textureSize.y));
   image.channels = 1;
   image.bytesPerChannel = 1;
-  image.pixelData.resize(size_t(image.width * image.height), outsideColor);
-
-  // TODO: this is naive approach, use line-triangle
-  // intersections to rasterize one row at a time
-  // NOTE: also completely ignores antimeridian (really these
-  // calculations should be normalized to the first vertex)
-  for (const CartographicPolygon& polygon : cartographicPolygons) {
-    const std::vector<glm::dvec2>& vertices = polygon.getVertices();
-    const std::vector<uint32_t>& indices = polygon.getIndices();
-    for (size_t triangle = 0; triangle < indices.size() / 3; ++triangle) {
-      const glm::dvec2& a = vertices[indices[3 * triangle]];
-      const glm::dvec2& b = vertices[indices[3 * triangle + 1]];
-      const glm::dvec2& c = vertices[indices[3 * triangle + 2]];
-
-      // TODO: deal with the corner cases here
-      const double minX = glm::min(a.x, glm::min(b.x, c.x));
-      const double minY = glm::min(a.y, glm::min(b.y, c.y));
-      const double maxX = glm::max(a.x, glm::max(b.x, c.x));
-      const double maxY = glm::max(a.y, glm::max(b.y, c.y));
-
-      const CesiumGeospatial::GlobeRectangle triangleBounds(
-          minX,
-          minY,
-          maxX,
-          maxY);
-
-      // skip this triangle if it is entirely outside the tile bounds
-      if (!rectangle.computeIntersection(triangleBounds)) {
-        continue;
-      }
+  if (image.width <= 0 || image.height <= 0) {
+    return;
+  }
 
-      const glm::dvec2 ab = b - a;
-      const glm::dvec2 ab_perp(-ab.y, ab.x);
-      const glm::dvec2 bc = c - b;
-      const glm::dvec2 bc_perp(-bc.y, bc.x);
-      const glm::dvec2 ca = a - c;
-      const glm::dvec2 ca_perp(-ca.y, ca.x);
-
-      size_t width = size_t(image.width);
-      size_t height = size_t(image.height);
-
-      for (size_t j = 0; j < height; ++j) {
-        const double pixelY =
-            rectangle.getSouth() +
-            rectangleHeight * (1.0 - (double(j) + 0.5) / double(height));
-        for (size_t i = 0; i < width; ++i) {
-          const double pixelX = rectangle.getWest() + rectangleWidth *
-                                                          (double(i) + 0.5) /
-                                                          double(width);
-          const glm::dvec2 v(pixelX, pixelY);
-
-          const glm::dvec2 av = v - a;
-          const glm::dvec2 cv = v - c;
-
-          const double v_proj_ab_perp = glm::dot(av, ab_perp);
-          const double v_proj_bc_perp = glm::dot(cv, bc_perp);
-          const double v_proj_ca_perp = glm::dot(cv, ca_perp);
-
-          // will determine in or out, irrespective of winding
-          if ((v_proj_ab_perp >= 0.0 && v_proj_ca_perp >= 0.0 &&
-               v_proj_bc_perp >= 0.0) ||
-              (v_proj_ab_perp <= 0.0 && v_proj_ca_perp <= 0.0 &&
-               v_proj_bc_perp <= 0.0)) {
-            image.pixelData[width * j + i] = insideColor;
-          }
-        }
-      }
-    }
+  image.pixelData = imagePool.acquire(size_t(image.width * image.height));
+  if (outsideColor != std::byte(0)) {
+    std::fill(image.pixelData.begin(), image.pixelData.end(), outsideColor);
+  }
+
+  std::vector<ScanlineEdge> edges;
+  std::vector<ScanlineEdge> activeEdges;
+  std::vector<double> crossings;
+  for (const CartographicPolygon* pPolygon : polygons) {
+    rasterizePolygon(
+        image,
+        rectangle,
+        *pPolygon,
+        insideColor,
+        edges,
+        activeEdges,
+        crossings);
   }
 }
 } // namespace
@@ -158,7 +245,7 @@ class CESIUMRASTEROVERLAYS_API RasterizedPolygonsTileProvider final
     : public RasterOverlayTileProvider {
 
 private:
-  std::vector<CartographicPolygon> _polygons;
+  CartographicPolygonIndex _polygonIndex;
   bool _invertSelection;
 
 public:
@@ -170,7 +257,7 @@ public:
           pPrepareRendererResources,
       const std::shared_ptr<spdlog::logger>& pLogger,
       const CesiumGeospatial::Projection& projection,
-      const std::vector<CartographicPolygon>& polygons,
+      const CartographicPolygonIndex& polygonIndex,
       bool invertSelection)
       : RasterOverlayTileProvider(
             pOwner,
@@ -184,7 +271,7 @@ public:
             projectRectangleSimple(
                 projection,
                 CesiumGeospatial::GlobeRectangle::MAXIMUM)),
-        _polygons(polygons),
+        _polygonIndex(polygonIndex),
         _invertSelection(invertSelection) {}
 
   virtual CesiumAsync::Future<LoadedRasterOverlayImage>
@@ -197,8 +284,9 @@ public:
         glm::dvec2(options.maximumTextureSize));
 
     return this->getAsyncSystem().runInWorkerThread(
-        [&polygons = this->_polygons,
+        [&polygonIndex = this->_polygonIndex,
          invertSelection = this->_invertSelection,
+         pImagePool = this->getImagePool(),
          projection = this->getProjection(),
          rectangle = overlayTile.getRectangle(),
          textureSize]() -> LoadedRasterOverlayImage {
@@ -212,8 +300,9 @@ public:
               result,
               tileRectangle,
               textureSize,
-              polygons,
-              invertSelection);
+              polygonIndex,
+              invertSelection,
+              *pImagePool);
 
           return result;
         });
@@ -228,7 +317,7 @@ RasterizedPolygonsOverlay::RasterizedPolygonsOverlay(
     const CesiumGeospatial::Projection& projection,
     const RasterOverlayOptions& overlayOptions)
     : RasterOverlay(name, overlayOptions),
-      _polygons(polygons),
+      _polygonIndex(polygons),
       _invertSelection(invertSelection),
       _ellipsoid(ellipsoid),
       _projection(projection) {}
@@ -256,7 +345,7 @@ RasterizedPolygonsOverlay::createTileProvider(
               pPrepareRendererResources,
               pLogger,
               this->_projection,
-              this->_polygons,
+              this->_polygonIndex,
               this->_invertSelection)));
 }
 
@@ -0,0 +1,112 @@
+#include <CesiumGeometry/Rectangle.h>
+#include <CesiumNativeTests/SimpleAssetAccessor.h>
+#include <CesiumNativeTests/SimpleTaskProcessor.h>
+#include <CesiumNativeTests/waitForFuture.h>
+#include <CesiumRasterOverlays/MBTilesRasterOverlay.h>
+#include <CesiumRasterOverlays/RasterOverlayTile.h>
+#include <CesiumRasterOverlays/RasterOverlayTileProvider.h>
+#include <CesiumUtility/CreditSystem.h>
+#include <CesiumUtility/StringHelpers.h>
+
+#include <catch2/catch.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <filesystem>
+
+using namespace CesiumGltf;
+using namespace CesiumNativeTests;
+using namespace CesiumRasterOverlays;
+using namespace CesiumUtility;
+
+TEST_CASE("MBTilesRasterOverlay") {
+  std::filesystem::path dataDir(CesiumRasterOverlays_TEST_DATA_DIR);
+  auto pTaskProcessor = std::make_shared<SimpleTaskProcessor>();
+  CesiumAsync::AsyncSystem asyncSystem{pTaskProcessor};
+  auto pAssetAccessor = std::make_shared<SimpleAssetAccessor>(
+      std::map<std::string, std::shared_ptr<SimpleAssetRequest>>());
+  auto pCreditSystem = std::make_shared<CreditSystem>();
+
+  // The package has a red tile at level 0 and a green tile for the
+  // south-west quadrant at level 1. Its tiles are 16x16 pixels.
+  const std::string path = StringHelpers::toStringUtf8(
+      (dataDir / "mbtiles" / "test.mbtiles").generic_u8string());
+  MBTilesRasterOverlayOptions options;
+  options.tileWidth = 16;
+  options.tileHeight = 16;
+
+  auto createTileProvider =
+      [&](const IntrusivePointer<RasterOverlay>& pOverlay) {
+        return waitForFuture(
+            asyncSystem,
+            pOverlay->createTileProvider(
+                asyncSystem,
+                pAssetAccessor,
+                pCreditSystem,
+                nullptr,
+                spdlog::default_logger(),
+                nullptr));
+      };
+
+  SECTION("reads the package metadata") {
+    RasterOverlay::CreateTileProviderResult result =
+        createTileProvider(new MBTilesRasterOverlay("test", path, options));
+    REQUIRE(result);
+
+    IntrusivePointer<RasterOverlayTileProvider> pProvider = *result;
+    REQUIRE(pProvider->getCredit());
+    CHECK(
+        pCreditSystem->getHtml(*pProvider->getCredit()) == "test attribution");
+  }
+
+  SECTION("loads tiles from the package") {
+    RasterOverlay::CreateTileProviderResult result =
+        createTileProvider(new MBTilesRasterOverlay("test", path, options));
+    REQUIRE(result);
+    IntrusivePointer<RasterOverlayTileProvider> pProvider = *result;
+
+    const CesiumGeometry::Rectangle& coverage =
+        pProvider->getCoverageRectangle();
+    const glm::dvec2 center = coverage.getCenter();
+
+    auto loadImage = [&](const CesiumGeometry::Rectangle& rectangle) {
+      IntrusivePointer<RasterOverlayTile> pTile =
+          pProvider->getTile(rectangle, glm::dvec2(16.0, 16.0));
+      REQUIRE(pTile);
+      waitForFuture(asyncSystem, pProvider->loadTile(*pTile));
+      REQUIRE(pTile->getImage());
+      REQUIRE(pTile->getImage()->width > 0);
+      return pTile->getImage();
+    };
+
+    // The south-west quadrant is in the package at level 1.
+    IntrusivePointer<const ImageAsset> pSouthWest = loadImage(
+        CesiumGeometry::Rectangle(
+            coverage.minimumX,
+            coverage.minimumY,
+            center.x,
+            center.y));
+    CHECK(pSouthWest->pixelData[0] == std::byte(0));
+    CHECK(pSouthWest->pixelData[1] == std::byte(255));
+
+    // The north-east quadrant is not, so the level 0 tile is used instead.
+    IntrusivePointer<const ImageAsset> pNorthEast = loadImage(
+        CesiumGeometry::Rectangle(
+            center.x,
+            center.y,
+            coverage.maximumX,
+            coverage.maximumY));
+    CHECK(pNorthEast->pixelData[0] == std::byte(255));
+    CHECK(pNorthEast->pixelData[1] == std::byte(0));
+  }
+
+  SECTION("reports an error for a missing package") {
+    RasterOverlay::CreateTileProviderResult result = createTileProvider(
+        new MBTilesRasterOverlay(
+            "test",
+            StringHelpers::toStringUtf8(
+                (dataDir / "mbtiles" / "missing.mbtiles").generic_u8string())));
+    REQUIRE(!result);
+    CHECK(result.error().type == RasterOverlayLoadType::TileProvider);
+  }
+}
@@ -5,6 +5,7 @@
 #include <CesiumGeospatial/WebMercatorProjection.h>
 #include <CesiumNativeTests/SimpleAssetAccessor.h>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch.hpp>
 #include <catch2/catch_test_macros.hpp>
 
@@ -126,6 +127,36 @@ public:
   virtual void startTask(std::function<void()> f) { std::thread(f).detach(); }
 };
 
+// Returns a rectangle that covers a square of `tilesAcross` by `tilesAcross`
+// tiles at the given level. The rectangle is inset by a small fraction of a
+// pixel so that it does not touch any neighboring tiles.
+Rectangle computeTileBlockRectangle(
+    const QuadtreeTilingScheme& tilingScheme,
+    const glm::dvec2& position,
+    uint32_t level,
+    uint32_t tilesAcross) {
+  std::optional<QuadtreeTileID> maybeFirstID =
+      tilingScheme.positionToTile(position, level);
+  REQUIRE(maybeFirstID);
+
+  const QuadtreeTileID lastID(
+      level,
+      maybeFirstID->x + tilesAcross - 1,
+      maybeFirstID->y + tilesAcross - 1);
+
+  const Rectangle first = tilingScheme.tileToRectangle(*maybeFirstID);
+  const Rectangle last = tilingScheme.tileToRectangle(lastID);
+  const Rectangle block = first.computeUnion(last);
+
+  const double insetX = first.computeWidth() / 1024.0;
+  const double insetY = first.computeHeight() / 1024.0;
+  return Rectangle(
+      block.minimumX + insetX,
+      block.minimumY + insetY,
+      block.maximumX - insetX,
+      block.maximumY - insetY);
+}
+
 } // namespace
 
 TEST_CASE("QuadtreeRasterOverlayTileProvider getTile") {
@@ -248,4 +279,170 @@ TEST_CASE("QuadtreeRasterOverlayTileProvider getTile") {
         image.pixelData.end(),
         [](std::byte b) { return b == std::byte(8); }));
   }
+
+  SECTION("composites a large image from many tiles") {
+    TestTileProvider* pTestProvider =
+        static_cast<TestTileProvider*>(pProvider.get());
+
+    // A rectangle spanning 8x8 tiles at level 8 produces a 2048x2048 image,
+    // large enough to be composited by several worker threads.
+    const uint32_t expectedLevel = 8;
+    const uint32_t tilesAcross = 8;
+    Rectangle tileRectangle = computeTileBlockRectangle(
+        pTestProvider->getTilingScheme(),
+        glm::dvec2(0.1, 0.2),
+        expectedLevel,
+        tilesAcross);
+
+    uint32_t rasterSSE = 2;
+    glm::dvec2 targetScreenPixels = glm::dvec2(
+        pTestProvider->getWidth() * tilesAcross * rasterSSE,
+        pTestProvider->getHeight() * tilesAcross * rasterSSE);
+
+    IntrusivePointer<RasterOverlayTile> pTile =
+        pProvider->getTile(tileRectangle, targetScreenPixels);
+    pProvider->loadTile(*pTile);
+
+    while (pTile->getState() != RasterOverlayTile::LoadState::Loaded) {
+      asyncSystem.dispatchMainThreadTasks();
+    }
+
+    REQUIRE(pTile->getImage());
+
+    const ImageAsset& image = *pTile->getImage();
+    CHECK(image.width == int32_t(pTestProvider->getWidth() * tilesAcross));
+    CHECK(image.height == int32_t(pTestProvider->getHeight() * tilesAcross));
+
+    // Every pixel should be covered by a level 8 tile.
+    CHECK(std::all_of(
+        image.pixelData.begin(),
+        image.pixelData.end(),
+        [](std::byte b) { return b == std::byte(8); }));
+  }
+
+  SECTION("reuses loaded tiles near a level boundary") {
+    TestTileProvider* pTestProvider =
+        static_cast<TestTileProvider*>(pProvider.get());
+    pOverlay->getOptions().levelHysteresis = 0.25;
+
+    Rectangle tileRectangle = computeTileBlockRectangle(
+        pTestProvider->getTilingScheme(),
+        glm::dvec2(0.1, 0.2),
+        8,
+        1);
+
+    uint32_t rasterSSE = 2;
+    glm::dvec2 levelEightPixels = glm::dvec2(
+        pTestProvider->getWidth() * rasterSSE,
+        pTestProvider->getHeight() * rasterSSE);
+
+    auto loadTile = [&](const glm::dvec2& targetScreenPixels) {
+      IntrusivePointer<RasterOverlayTile> pTile =
+          pProvider->getTile(tileRectangle, targetScreenPixels);
+      pProvider->loadTile(*pTile);
+
+      while (pTile->getState() != RasterOverlayTile::LoadState::Loaded) {
+        asyncSystem.dispatchMainThreadTasks();
+      }
+
+      REQUIRE(pTile->getImage());
+      return pTile;
+    };
+
+    IntrusivePointer<RasterOverlayTile> pLevelEight =
+        loadTile(levelEightPixels);
+    CHECK(pTestProvider->getTileImageRequestCount() == 1);
+    CHECK(pTestProvider->getReusedLevelCount() == 0);
+
+    // The ideal level is now 8.6, which would normally round to 9. But the
+    // level 8 tile is already loaded, so it is used again.
+    const glm::dvec2 betweenLevelsPixels =
+        levelEightPixels * glm::pow(2.0, 0.6);
+    IntrusivePointer<RasterOverlayTile> pBetween =
+        loadTile(betweenLevelsPixels);
+    CHECK(pTestProvider->getTileImageRequestCount() == 1);
+    CHECK(pTestProvider->getReusedLevelCount() == 1);
+
+    const ImageAsset& image = *pBetween->getImage();
+    CHECK(std::all_of(
+        image.pixelData.begin(),
+        image.pixelData.end(),
+        [](std::byte b) { return b == std::byte(8); }));
+
+    // Farther from the midpoint, the nearest level is used.
+    CHECK(
+        pTestProvider->computeLevelFromTargetScreenPixels(
+            tileRectangle,
+            levelEightPixels * glm::pow(2.0, 0.9)) == 9);
+
+    // Without hysteresis, the nearest level is always used.
+    pOverlay->getOptions().levelHysteresis = 0.0;
+    CHECK(
+        pTestProvider->computeLevelFromTargetScreenPixels(
+            tileRectangle,
+            betweenLevelsPixels) == 9);
+  }
+}
+
+TEST_CASE(
+    "QuadtreeRasterOverlayTileProvider compositing throughput",
+    "[.][benchmark]") {
+  auto pTaskProcessor = std::make_shared<MockTaskProcessor>();
+  auto pAssetAccessor = std::make_shared<SimpleAssetAccessor>(
+      std::map<std::string, std::shared_ptr<SimpleAssetRequest>>());
+
+  AsyncSystem asyncSystem(pTaskProcessor);
+  RasterOverlayOptions options;
+  options.maximumTextureSize = 4096;
+  IntrusivePointer<TestRasterOverlay> pOverlay =
+      new TestRasterOverlay("Test", options);
+
+  IntrusivePointer<RasterOverlayTileProvider> pProvider = nullptr;
+
+  pOverlay
+      ->createTileProvider(
+          asyncSystem,
+          pAssetAccessor,
+          nullptr,
+          nullptr,
+          spdlog::default_logger(),
+          nullptr)
+      .thenInMainThread(
+          [&pProvider](RasterOverlay::CreateTileProviderResult&& created) {
+            pProvider = *created;
+          });
+
+  asyncSystem.dispatchMainThreadTasks();
+  REQUIRE(pProvider);
+
+  TestTileProvider* pTestProvider =
+      static_cast<TestTileProvider*>(pProvider.get());
+
+  const uint32_t tilesAcross = 16;
+  Rectangle tileRectangle = computeTileBlockRectangle(
+      pTestProvider->getTilingScheme(),
+      glm::dvec2(0.1, 0.2),
+      10,
+      tilesAcross);
+  glm::dvec2 targetScreenPixels = glm::dvec2(
+      pTestProvider->getWidth() * tilesAcross * 2,
+      pTestProvider->getHeight() * tilesAcross * 2);
+
+  auto loadCompositeTile = [&]() {
+    IntrusivePointer<RasterOverlayTile> pTile =
+        pProvider->getTile(tileRectangle, targetScreenPixels);
+    pProvider->loadTile(*pTile);
+
+    while (pTile->getState() != RasterOverlayTile::LoadState::Loaded) {
+      asyncSystem.dispatchMainThreadTasks();
+    }
+
+    return pTile;
+  };
+
+  // Load once up front so that the benchmark measures compositing rather than
+  // loading the individual quadtree tiles.
+  loadCompositeTile();
+
+  BENCHMARK("4096x4096 composite of 256 tiles") { return loadCompositeTile(); };
 }
@@ -0,0 +1,200 @@
+#include <CesiumNativeTests/SimpleAssetAccessor.h>
+#include <CesiumNativeTests/SimpleTaskProcessor.h>
+#include <CesiumRasterOverlays/RasterOverlay.h>
+#include <CesiumRasterOverlays/RasterOverlayLoadFailureDetails.h>
+#include <CesiumRasterOverlays/RasterOverlayTileProvider.h>
+
+#include <catch2/catch.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <spdlog/logger.h>
+
+#include <memory>
+
+using namespace CesiumAsync;
+using namespace CesiumNativeTests;
+using namespace CesiumRasterOverlays;
+using namespace CesiumUtility;
+
+namespace {
+
+class CountingRasterOverlay : public RasterOverlay {
+public:
+  CountingRasterOverlay() : RasterOverlay("Counting") {}
+
+  mutable int32_t tileProvidersCreated = 0;
+  mutable bool failToCreateTileProvider = false;
+
+  virtual CesiumAsync::Future<CreateTileProviderResult> createTileProvider(
+      const CesiumAsync::AsyncSystem& asyncSystem,
+      const std::shared_ptr<CesiumAsync::IAssetAccessor>& pAssetAccessor,
+      const std::shared_ptr<CreditSystem>& /* pCreditSystem */,
+      const std::shared_ptr<IPrepareRasterOverlayRendererResources>&
+      /* pPrepareRendererResources */,
+      const std::shared_ptr<spdlog::logger>& /* pLogger */,
+      CesiumUtility::IntrusivePointer<const RasterOverlay> /* pOwner */)
+      const override {
+    ++this->tileProvidersCreated;
+    if (this->failToCreateTileProvider) {
+      return asyncSystem.createResolvedFuture<CreateTileProviderResult>(
+          nonstd::make_unexpected(RasterOverlayLoadFailureDetails{
+              RasterOverlayLoadType::Unknown,
+              nullptr,
+              "Failed"}));
+    }
+
+    return asyncSystem.createResolvedFuture<CreateTileProviderResult>(
+        this->createPlaceholder(asyncSystem, pAssetAccessor));
+  }
+};
+
+} // namespace
+
+TEST_CASE("RasterOverlay::getSharedTileProvider") {
+  AsyncSystem asyncSystem(std::make_shared<SimpleTaskProcessor>());
+  auto pAssetAccessor = std::make_shared<SimpleAssetAccessor>(
+      std::map<std::string, std::shared_ptr<SimpleAssetRequest>>());
+  auto pLogger = spdlog::default_logger();
+
+  IntrusivePointer<CountingRasterOverlay> pOverlay =
+      new CountingRasterOverlay();
+  const int32_t initialReferenceCount = pOverlay->getReferenceCount();
+
+  auto getProvider = [&](const std::shared_ptr<IAssetAccessor>& pAccessor) {
+    RasterOverlay::CreateTileProviderResult result =
+        pOverlay
+            ->getSharedTileProvider(
+                asyncSystem,
+                pAccessor,
+                nullptr,
+                nullptr,
+                pLogger)
+            .waitInMainThread();
+    REQUIRE(result);
+    return *result;
+  };
+
+  auto release = [&](const std::shared_ptr<IAssetAccessor>& pAccessor) {
+    pOverlay->releaseSharedTileProvider(asyncSystem, pAccessor, nullptr);
+  };
+
+  SECTION("shares one tile provider among users with the same parameters") {
+    IntrusivePointer<RasterOverlayTileProvider> pFirst =
+        getProvider(pAssetAccessor);
+    IntrusivePointer<RasterOverlayTileProvider> pSecond =
+        getProvider(pAssetAccessor);
+    CHECK(pFirst == pSecond);
+    CHECK(pOverlay->tileProvidersCreated == 1);
+
+    release(pAssetAccessor);
+    CHECK(getProvider(pAssetAccessor) == pFirst);
+    CHECK(pOverlay->tileProvidersCreated == 1);
+
+    release(pAssetAccessor);
+    release(pAssetAccessor);
+  }
+
+  SECTION("creates separate tile providers for different parameters") {
+    auto pOtherAssetAccessor = std::make_shared<SimpleAssetAccessor>(
+        std::map<std::string, std::shared_ptr<SimpleAssetRequest>>());
+
+    IntrusivePointer<RasterOverlayTileProvider> pFirst =
+        getProvider(pAssetAccessor);
+    IntrusivePointer<RasterOverlayTileProvider> pSecond =
+        getProvider(pOtherAssetAccessor);
+    CHECK(pFirst != pSecond);
+    CHECK(pOverlay->tileProvidersCreated == 2);
+
+    release(pAssetAccessor);
+    release(pOtherAssetAccessor);
+  }
+
+  SECTION("shares the tile provider regardless of the renderer resources and "
+          "logger") {
+    IntrusivePointer<RasterOverlayTileProvider> pFirst =
+        getProvider(pAssetAccessor);
+
+    RasterOverlay::CreateTileProviderResult result =
+        pOverlay
+            ->getSharedTileProvider(
+                asyncSystem,
+                pAssetAccessor,
+                nullptr,
+                nullptr,
+                std::make_shared<spdlog::logger>("other"))
+            .waitInMainThread();
+    REQUIRE(result);
+    CHECK(*result == pFirst);
+    CHECK(pOverlay->tileProvidersCreated == 1);
+
+    release(pAssetAccessor);
+    release(pAssetAccessor);
+  }
+
+  SECTION("counts the users of each tile provider") {
+    CHECK(
+        pOverlay->getSharedTileProviderUsers(
+            asyncSystem,
+            pAssetAccessor,
+            nullptr) == 0);
+
+    getProvider(pAssetAccessor);
+    getProvider(pAssetAccessor);
+    CHECK(
+        pOverlay->getSharedTileProviderUsers(
+            asyncSystem,
+            pAssetAccessor,
+            nullptr) == 2);
+
+    release(pAssetAccessor);
+    CHECK(
+        pOverlay->getSharedTileProviderUsers(
+            asyncSystem,
+            pAssetAccessor,
+            nullptr) == 1);
+
+    release(pAssetAccessor);
+  }
+
+  SECTION("creates the tile provider again after it fails") {
+    pOverlay->failToCreateTileProvider = true;
+    RasterOverlay::CreateTileProviderResult failed =
+        pOverlay
+            ->getSharedTileProvider(
+                asyncSystem,
+                pAssetAccessor,
+                nullptr,
+                nullptr,
+                pLogger)
+            .waitInMainThread();
+    CHECK(!failed);
+    asyncSystem.dispatchMainThreadTasks();
+
+    // The failed user still holds its share until it releases it.
+    pOverlay->failToCreateTileProvider = false;
+    getProvider(pAssetAccessor);
+    CHECK(pOverlay->tileProvidersCreated == 2);
+    CHECK(
+        pOverlay->getSharedTileProviderUsers(
+            asyncSystem,
+            pAssetAccessor,
+            nullptr) == 2);
+
+    release(pAssetAccessor);
+    release(pAssetAccessor);
+  }
+
+  SECTION("drops the tile provider once every user releases it") {
+    IntrusivePointer<RasterOverlayTileProvider> pProvider =
+        getProvider(pAssetAccessor);
+    release(pAssetAccessor);
+    pProvider = nullptr;
+    asyncSystem.dispatchMainThreadTasks();
+
+    // Nothing refers to the overlay anymore except this test.
+    CHECK(pOverlay->getReferenceCount() == initialReferenceCount);
+
+    getProvider(pAssetAccessor);
+    CHECK(pOverlay->tileProvidersCreated == 2);
+    release(pAssetAccessor);
+  }
+}
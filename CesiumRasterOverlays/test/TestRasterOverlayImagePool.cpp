@@ -0,0 +1,78 @@
+#include <CesiumRasterOverlays/RasterOverlayImagePool.h>
+
+#include <catch2/catch.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+using namespace CesiumRasterOverlays;
+
+TEST_CASE("The default RasterOverlayImagePool keeps no buffers") {
+  const std::shared_ptr<RasterOverlayImagePool>& pPool =
+      RasterOverlayImagePool::getDefault();
+  CHECK(pPool->getMaximumPooledBytes() == 0);
+
+  pPool->release(pPool->acquire(256 * 256));
+  CHECK(pPool->getPooledBytes() == 0);
+}
+
+TEST_CASE("RasterOverlayImagePool") {
+  RasterOverlayImagePool pool(1024 * 1024);
+
+  SECTION("reuses a released buffer for a request of a similar size") {
+    std::vector<std::byte> buffer = pool.acquire(256 * 256);
+    CHECK(buffer.size() == 256 * 256);
+    std::fill(buffer.begin(), buffer.end(), std::byte(0xff));
+    const std::byte* pData = buffer.data();
+
+    pool.release(std::move(buffer));
+    CHECK(buffer.empty());
+    CHECK(pool.getPooledBytes() >= 256 * 256);
+
+    std::vector<std::byte> reused = pool.acquire(256 * 256 - 100);
+    CHECK(reused.data() == pData);
+    CHECK(reused.size() == 256 * 256 - 100);
+    CHECK(pool.getPooledBytes() == 0);
+
+    // Reused buffers are zeroed.
+    CHECK(std::all_of(reused.begin(), reused.end(), [](std::byte b) {
+      return b == std::byte(0);
+    }));
+  }
+
+  SECTION("does not reuse a buffer for a larger size class") {
+    pool.release(pool.acquire(64 * 1024));
+    std::vector<std::byte> larger = pool.acquire(128 * 1024 + 1);
+    CHECK(larger.size() == 128 * 1024 + 1);
+    CHECK(pool.getPooledBytes() == 64 * 1024);
+  }
+
+  SECTION("does not pool small buffers") {
+    pool.release(std::vector<std::byte>(100));
+    CHECK(pool.getPooledBytes() == 0);
+  }
+
+  SECTION("frees buffers that do not fit") {
+    std::vector<std::byte> a = pool.acquire(512 * 1024);
+    std::vector<std::byte> b = pool.acquire(512 * 1024);
+    std::vector<std::byte> c = pool.acquire(512 * 1024);
+    pool.release(std::move(a));
+    pool.release(std::move(b));
+    pool.release(std::move(c));
+    CHECK(pool.getPooledBytes() >= 512 * 1024);
+    CHECK(pool.getPooledBytes() <= pool.getMaximumPooledBytes());
+
+    pool.setMaximumPooledBytes(0);
+    CHECK(pool.getPooledBytes() == 0);
+  }
+
+  SECTION("clear frees all buffers") {
+    pool.release(pool.acquire(64 * 1024));
+    CHECK(pool.getPooledBytes() > 0);
+    pool.clear();
+    CHECK(pool.getPooledBytes() == 0);
+  }
+}
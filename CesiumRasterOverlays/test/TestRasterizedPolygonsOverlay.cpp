@@ -0,0 +1,103 @@
+#include <CesiumGeospatial/CartographicPolygon.h>
+#include <CesiumGeospatial/Ellipsoid.h>
+#include <CesiumGeospatial/GeographicProjection.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumGeospatial/Projection.h>
+#include <CesiumNativeTests/SimpleAssetAccessor.h>
+#include <CesiumNativeTests/SimpleTaskProcessor.h>
+#include <CesiumNativeTests/waitForFuture.h>
+#include <CesiumRasterOverlays/RasterOverlayTile.h>
+#include <CesiumRasterOverlays/RasterOverlayTileProvider.h>
+#include <CesiumRasterOverlays/RasterizedPolygonsOverlay.h>
+
+#include <catch2/catch.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <glm/vec2.hpp>
+
+#include <cstddef>
+#include <vector>
+
+using namespace CesiumGeospatial;
+using namespace CesiumGltf;
+using namespace CesiumNativeTests;
+using namespace CesiumRasterOverlays;
+using namespace CesiumUtility;
+
+TEST_CASE("RasterizedPolygonsOverlay") {
+  auto pTaskProcessor = std::make_shared<SimpleTaskProcessor>();
+  CesiumAsync::AsyncSystem asyncSystem{pTaskProcessor};
+  auto pAssetAccessor = std::make_shared<SimpleAssetAccessor>(
+      std::map<std::string, std::shared_ptr<SimpleAssetRequest>>());
+
+  // Covers the western half of the tile below, and extends beyond it to the
+  // north and south.
+  const CartographicPolygon polygon(std::vector<glm::dvec2>{
+      glm::dvec2(0.05, 0.05),
+      glm::dvec2(0.2, 0.05),
+      glm::dvec2(0.2, 0.35),
+      glm::dvec2(0.05, 0.35)});
+
+  const GeographicProjection projection(Ellipsoid::WGS84);
+
+  IntrusivePointer<RasterizedPolygonsOverlay> pOverlay =
+      new RasterizedPolygonsOverlay(
+          "test",
+          {polygon},
+          false,
+          Ellipsoid::WGS84,
+          projection);
+
+  RasterOverlay::CreateTileProviderResult result = waitForFuture(
+      asyncSystem,
+      pOverlay->createTileProvider(
+          asyncSystem,
+          pAssetAccessor,
+          nullptr,
+          nullptr,
+          spdlog::default_logger(),
+          nullptr));
+  REQUIRE(result);
+  IntrusivePointer<RasterOverlayTileProvider> pProvider = *result;
+
+  auto loadImage = [&](const GlobeRectangle& rectangle) {
+    // With the default maximum screen-space error of 2, this produces a
+    // 64x64 image.
+    IntrusivePointer<RasterOverlayTile> pTile = pProvider->getTile(
+        projectRectangleSimple(projection, rectangle),
+        glm::dvec2(128.0, 128.0));
+    REQUIRE(pTile);
+    waitForFuture(asyncSystem, pProvider->loadTile(*pTile));
+    REQUIRE(pTile->getImage());
+    return pTile->getImage();
+  };
+
+  SECTION("rasterizes a polygon partially covering a tile") {
+    IntrusivePointer<const ImageAsset> pImage =
+        loadImage(GlobeRectangle(0.1, 0.1, 0.3, 0.3));
+    REQUIRE(pImage->width == 64);
+    REQUIRE(pImage->height == 64);
+
+    for (int32_t j = 0; j < pImage->height; ++j) {
+      for (int32_t i = 0; i < pImage->width; ++i) {
+        const std::byte expected = i < 32 ? std::byte(0xff) : std::byte(0);
+        CHECK(pImage->pixelData[size_t(j * pImage->width + i)] == expected);
+      }
+    }
+  }
+
+  SECTION("produces a 1x1 image for a tile inside a polygon") {
+    IntrusivePointer<const ImageAsset> pImage =
+        loadImage(GlobeRectangle(0.1, 0.1, 0.15, 0.15));
+    REQUIRE(pImage->width == 1);
+    REQUIRE(pImage->height == 1);
+    CHECK(pImage->pixelData[0] == std::byte(0xff));
+  }
+
+  SECTION("produces a 1x1 image for a tile outside all polygons") {
+    IntrusivePointer<const ImageAsset> pImage =
+        loadImage(GlobeRectangle(0.5, 0.5, 0.6, 0.6));
+    REQUIRE(pImage->width == 1);
+    REQUIRE(pImage->height == 1);
+    CHECK(pImage->pixelData[0] == std::byte(0));
+  }
+}
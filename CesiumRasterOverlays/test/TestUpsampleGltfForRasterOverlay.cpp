@@ -6,11 +6,16 @@
 #include <CesiumRasterOverlays/RasterOverlayUtilities.h>
 #include <CesiumUtility/Math.h>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <glm/trigonometric.hpp>
+#include <glm/vector_relational.hpp>
 
+#include <cstddef>
 #include <cstring>
+#include <limits>
+#include <optional>
 #include <vector>
 
 using namespace CesiumUtility;
@@ -40,6 +45,103 @@ static void checkSkirt(
       Math::equalsEpsilon(expectedPosition.z, skirtPosition.z, Math::Epsilon7));
 }
 
+// Creates a model with a single primitive that is a regular grid of
+// `across` x `across` quads, with positions and texture coordinates
+// interleaved in a single buffer.
+static Model createGridModel(size_t across) {
+  struct Vertex {
+    glm::vec3 position;
+    glm::vec2 uv;
+  };
+
+  const size_t verticesAcross = across + 1;
+  std::vector<Vertex> vertices;
+  vertices.reserve(verticesAcross * verticesAcross);
+  for (size_t j = 0; j < verticesAcross; ++j) {
+    for (size_t i = 0; i < verticesAcross; ++i) {
+      const glm::vec2 uv(
+          static_cast<float>(i) / static_cast<float>(across),
+          static_cast<float>(j) / static_cast<float>(across));
+      vertices.push_back(Vertex{glm::vec3(uv * 1000.0f, uv.x * uv.y), uv});
+    }
+  }
+
+  std::vector<uint32_t> indices;
+  indices.reserve(across * across * 6);
+  for (size_t j = 0; j < across; ++j) {
+    for (size_t i = 0; i < across; ++i) {
+      const uint32_t lowerLeft = static_cast<uint32_t>(j * verticesAcross + i);
+      const uint32_t upperLeft = lowerLeft + uint32_t(verticesAcross);
+      indices.insert(
+          indices.end(),
+          {lowerLeft,
+           lowerLeft + 1,
+           upperLeft + 1,
+           lowerLeft,
+           upperLeft + 1,
+           upperLeft});
+    }
+  }
+
+  Model model;
+
+  Buffer& vertexBuffer = model.buffers.emplace_back();
+  vertexBuffer.cesium.data.resize(vertices.size() * sizeof(Vertex));
+  std::memcpy(
+      vertexBuffer.cesium.data.data(),
+      vertices.data(),
+      vertexBuffer.cesium.data.size());
+  vertexBuffer.byteLength = int64_t(vertexBuffer.cesium.data.size());
+
+  Buffer& indexBuffer = model.buffers.emplace_back();
+  indexBuffer.cesium.data.resize(indices.size() * sizeof(uint32_t));
+  std::memcpy(
+      indexBuffer.cesium.data.data(),
+      indices.data(),
+      indexBuffer.cesium.data.size());
+  indexBuffer.byteLength = int64_t(indexBuffer.cesium.data.size());
+
+  BufferView& vertexBufferView = model.bufferViews.emplace_back();
+  vertexBufferView.buffer = 0;
+  vertexBufferView.byteLength = vertexBuffer.byteLength;
+  vertexBufferView.byteStride = int64_t(sizeof(Vertex));
+
+  BufferView& indexBufferView = model.bufferViews.emplace_back();
+  indexBufferView.buffer = 1;
+  indexBufferView.byteLength = indexBuffer.byteLength;
+
+  Accessor& positionAccessor = model.accessors.emplace_back();
+  positionAccessor.bufferView = 0;
+  positionAccessor.byteOffset = int64_t(offsetof(Vertex, position));
+  positionAccessor.count = int64_t(vertices.size());
+  positionAccessor.componentType = Accessor::ComponentType::FLOAT;
+  positionAccessor.type = Accessor::Type::VEC3;
+
+  Accessor& uvAccessor = model.accessors.emplace_back();
+  uvAccessor.bufferView = 0;
+  uvAccessor.byteOffset = int64_t(offsetof(Vertex, uv));
+  uvAccessor.count = int64_t(vertices.size());
+  uvAccessor.componentType = Accessor::ComponentType::FLOAT;
+  uvAccessor.type = Accessor::Type::VEC2;
+
+  Accessor& indexAccessor = model.accessors.emplace_back();
+  indexAccessor.bufferView = 1;
+  indexAccessor.count = int64_t(indices.size());
+  indexAccessor.componentType = Accessor::ComponentType::UNSIGNED_INT;
+  indexAccessor.type = Accessor::Type::SCALAR;
+
+  MeshPrimitive& primitive =
+      model.meshes.emplace_back().primitives.emplace_back();
+  primitive.mode = MeshPrimitive::Mode::TRIANGLES;
+  primitive.attributes["POSITION"] = 0;
+  primitive.attributes["_CESIUMOVERLAY_0"] = 1;
+  primitive.indices = 2;
+
+  model.nodes.emplace_back().mesh = 0;
+
+  return model;
+}
+
 TEST_CASE("upsampleGltfForRasterOverlay with UNSIGNED_SHORT indices") {
   const Ellipsoid& ellipsoid = CesiumGeospatial::Ellipsoid::WGS84;
   Cartographic bottomLeftCart{glm::radians(110.0), glm::radians(32.0), 0.0};
@@ -1274,3 +1376,124 @@ TEST_CASE("upsampleGltfForRasterOverlay with UNSIGNED_BYTE indices") {
           (upsampledPosition[4] + positions[1]) * 0.5f,
           glm::vec3(static_cast<float>(Math::Epsilon7))) == glm::bvec3(true));
 }
+
+TEST_CASE("upsampleGltfForRasterOverlay with interleaved attributes") {
+  const Model model = createGridModel(10);
+
+  for (uint32_t x = 0; x < 2; ++x) {
+    for (uint32_t y = 0; y < 2; ++y) {
+      const CesiumGeometry::UpsampledQuadtreeNode child{
+          CesiumGeometry::QuadtreeTileID(1, x, y)};
+      std::optional<Model> maybeUpsampled =
+          RasterOverlayUtilities::upsampleGltfForRasterOverlays(
+              model,
+              child,
+              false);
+      REQUIRE(maybeUpsampled);
+
+      const MeshPrimitive& primitive =
+          maybeUpsampled->meshes.back().primitives.back();
+      const int32_t positionAccessorIndex = primitive.attributes.at("POSITION");
+      AccessorView<glm::vec3> positions(*maybeUpsampled, positionAccessorIndex);
+      REQUIRE(positions.status() == AccessorViewStatus::Valid);
+      REQUIRE(positions.size() > 0);
+
+      // Every vertex is within the child, and the accessor bounds are exact.
+      const glm::vec3 childMinimum(500.0f * float(x), 500.0f * float(y), 0.0f);
+      const glm::vec3 childMaximum =
+          childMinimum + glm::vec3(500.0f, 500.0f, 1.0f);
+      glm::vec3 minimum(std::numeric_limits<float>::max());
+      glm::vec3 maximum(std::numeric_limits<float>::lowest());
+      for (int64_t i = 0; i < positions.size(); ++i) {
+        const glm::vec3 position = positions[i];
+        CHECK(glm::all(glm::greaterThanEqual(position, childMinimum - 1e-3f)));
+        CHECK(glm::all(glm::lessThanEqual(position, childMaximum + 1e-3f)));
+        minimum = glm::min(minimum, position);
+        maximum = glm::max(maximum, position);
+      }
+
+      const Accessor& accessor =
+          maybeUpsampled->accessors[size_t(positionAccessorIndex)];
+      REQUIRE(accessor.min.size() == 3);
+      REQUIRE(accessor.max.size() == 3);
+      for (glm::length_t i = 0; i < 3; ++i) {
+        CHECK(accessor.min[size_t(i)] == double(minimum[i]));
+        CHECK(accessor.max[size_t(i)] == double(maximum[i]));
+      }
+    }
+  }
+}
+
+TEST_CASE("upsampleGltfForRasterOverlayChildren") {
+  const Model model = createGridModel(10);
+
+  const std::vector<CesiumGeometry::UpsampledQuadtreeNode> childIDs{
+      {CesiumGeometry::QuadtreeTileID(1, 0, 0)},
+      {CesiumGeometry::QuadtreeTileID(1, 1, 0)},
+      {CesiumGeometry::QuadtreeTileID(1, 0, 1)},
+      {CesiumGeometry::QuadtreeTileID(1, 1, 1)}};
+
+  for (bool hasInvertedVCoordinate : {false, true}) {
+    std::vector<std::optional<Model>> children =
+        RasterOverlayUtilities::upsampleGltfForRasterOverlayChildren(
+            model,
+            childIDs,
+            hasInvertedVCoordinate);
+    REQUIRE(children.size() == childIDs.size());
+
+    // Each child is identical to the one created on its own.
+    for (size_t i = 0; i < childIDs.size(); ++i) {
+      std::optional<Model> expected =
+          RasterOverlayUtilities::upsampleGltfForRasterOverlays(
+              model,
+              childIDs[i],
+              hasInvertedVCoordinate);
+      REQUIRE(expected);
+      REQUIRE(children[i]);
+      REQUIRE(children[i]->buffers.size() == expected->buffers.size());
+      for (size_t j = 0; j < expected->buffers.size(); ++j) {
+        CHECK(
+            children[i]->buffers[j].cesium.data ==
+            expected->buffers[j].cesium.data);
+      }
+    }
+  }
+}
+
+TEST_CASE("upsampleGltfForRasterOverlay throughput", "[.][benchmark]") {
+  const Model model = createGridModel(255);
+  const CesiumGeometry::UpsampledQuadtreeNode child{
+      CesiumGeometry::QuadtreeTileID(1, 0, 0)};
+
+  BENCHMARK("one child of a 255x255 grid") {
+    return RasterOverlayUtilities::upsampleGltfForRasterOverlays(
+        model,
+        child,
+        false);
+  };
+
+  const std::vector<CesiumGeometry::UpsampledQuadtreeNode> childIDs{
+      {CesiumGeometry::QuadtreeTileID(1, 0, 0)},
+      {CesiumGeometry::QuadtreeTileID(1, 1, 0)},
+      {CesiumGeometry::QuadtreeTileID(1, 0, 1)},
+      {CesiumGeometry::QuadtreeTileID(1, 1, 1)}};
+
+  BENCHMARK("four children of a 255x255 grid, separately") {
+    std::vector<std::optional<Model>> children;
+    for (const CesiumGeometry::UpsampledQuadtreeNode& childID : childIDs) {
+      children.emplace_back(
+          RasterOverlayUtilities::upsampleGltfForRasterOverlays(
+              model,
+              childID,
+              false));
+    }
+    return children;
+  };
+
+  BENCHMARK("four children of a 255x255 grid, together") {
+    return RasterOverlayUtilities::upsampleGltfForRasterOverlayChildren(
+        model,
+        childIDs,
+        false);
+  };
+}
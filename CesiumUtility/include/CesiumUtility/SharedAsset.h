@@ -66,6 +66,13 @@ public:
    */
   void releaseReference() const noexcept { this->releaseReference(false); }
 
+  /**
+   * @brief Returns the current reference count of this instance.
+   */
+  std::int32_t getReferenceCount() const noexcept {
+    return this->_referenceCount;
+  }
+
   /**
    * @brief Gets the shared asset depot that owns this asset, or nullptr if this
    * asset is independent of an asset depot.
@@ -198,7 +198,7 @@ function generate(options, schema, writers) {
             ` : ""}
 
           protected:
-            IJsonHandler* readObjectKey${name}(const std::string& objectType, const std::string_view& str, ${namespace}::${name}& o);
+            IJsonHandler* readObjectKey${name}(const std::string_view& objectType, const std::string_view& str, ${namespace}::${name}& o);
 
           private:
             ${indent(readerLocalTypes.join("\n\n"), 12)}
@@ -385,8 +385,8 @@ function generate(options, schema, writers) {
         }
         ` : ""}
 
-        CesiumJsonReader::IJsonHandler* ${name}JsonHandler::readObjectKey${name}(const std::string& objectType, const std::string_view& str, ${namespace}::${name}& o) {
-          using namespace std::string_literals;
+        CesiumJsonReader::IJsonHandler* ${name}JsonHandler::readObjectKey${name}(const std::string_view& objectType, const std::string_view& str, ${namespace}::${name}& o) {
+          using namespace std::string_view_literals;
 
           ${properties.length > 0 ? `
           ${indent(
@@ -607,7 +607,7 @@ function formatReaderProperty(property) {
 }
 
 function formatReaderPropertyImpl(property) {
-  return `if ("${property.name}"s == str) { return property("${property.name}", this->_${property.cppSafeName}, o.${property.cppSafeName}); }`;
+  return `if ("${property.name}"sv == str) { return property("${property.name}", this->_${property.cppSafeName}, o.${property.cppSafeName}); }`;
 }
 
 function formatWriterPropertyImpl(property) {
@@ -812,7 +812,7 @@ function createEnumReaderTypeImpl(parentName, enumName, propertyName, enums) {
 
     CesiumJsonReader::IJsonHandler* ${parentName}JsonHandler::${enumName}JsonHandler::readString(const std::string_view& str) {
       // NOLINTNEXTLINE(misc-include-cleaner)
-      using std::string_literals::operator""s;
+      using std::string_view_literals::operator""sv;
 
       assert(this->_pEnum);
 
@@ -821,7 +821,7 @@ function createEnumReaderTypeImpl(parentName, enumName, propertyName, enums) {
       .map((e) => {
         const enumValue = getEnumValue(e);
         return enumValue !== undefined
-          ? `if ("${enumValue}"s == str) *this->_pEnum = ${parentName}::${enumName}::${makeIdentifier(
+          ? `if ("${enumValue}"sv == str) *this->_pEnum = ${parentName}::${enumName}::${makeIdentifier(
             enumValue
           )};`
           : undefined;